@@ -0,0 +1,133 @@
+#include "orion-utils/arena.h"
+#include "orion-utils/small_vector.h"
+
+#include <cstdlib>         // std::malloc, std::free
+#include <memory_resource> // std::pmr::monotonic_buffer_resource
+#include <vector>          // std::vector
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    constexpr std::size_t allocation_size = 32;
+
+    // Batch of small short-lived allocations released together, e.g. per-frame scratch objects
+    void churn_sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->RangeMultiplier(8)->Range(64, 4096);
+    }
+
+    void new_delete(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        std::vector<std::byte*> pointers(count);
+        for (auto _ : state) {
+            for (auto& ptr : pointers) {
+                ptr = new std::byte[allocation_size];
+                benchmark::DoNotOptimize(ptr);
+            }
+            for (auto* ptr : pointers) {
+                delete[] ptr;
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+    void malloc_free(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        std::vector<void*> pointers(count);
+        for (auto _ : state) {
+            for (auto& ptr : pointers) {
+                ptr = std::malloc(allocation_size);
+                benchmark::DoNotOptimize(ptr);
+            }
+            for (auto* ptr : pointers) {
+                std::free(ptr);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+    void monotonic_buffer(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        std::pmr::monotonic_buffer_resource resource;
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < count; ++i) {
+                benchmark::DoNotOptimize(resource.allocate(allocation_size, alignof(std::max_align_t)));
+            }
+            resource.release();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+    void arena_reset(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        orion::Arena arena;
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < count; ++i) {
+                benchmark::DoNotOptimize(arena.allocate(allocation_size, alignof(std::max_align_t)));
+            }
+            arena.reset();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+    void fixed_arena_reset(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        orion::FixedArena<4096 * allocation_size> arena;
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < count; ++i) {
+                benchmark::DoNotOptimize(arena.allocate(allocation_size, alignof(std::max_align_t)));
+            }
+            arena.reset();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+    // Scratch containers that outgrow their inline storage
+    template<typename Vector, typename... Args>
+    void fill_vectors(std::size_t count, Args&... args)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            Vector vector(args...);
+            for (int value = 0; value < 16; ++value) {
+                vector.push_back(value);
+            }
+            benchmark::DoNotOptimize(vector.data());
+        }
+    }
+
+    void small_vector_heap(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        for (auto _ : state) {
+            fill_vectors<orion::small_vector<int, 4>>(count);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+    void small_vector_arena(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        orion::Arena arena;
+        orion::ArenaAllocator<int> allocator(arena);
+        for (auto _ : state) {
+            fill_vectors<orion::small_vector<int, 4, orion::ArenaAllocator<int>>>(count, allocator);
+            arena.reset();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+    BENCHMARK(new_delete)->Apply(churn_sizes);
+    BENCHMARK(malloc_free)->Apply(churn_sizes);
+    BENCHMARK(monotonic_buffer)->Apply(churn_sizes);
+    BENCHMARK(arena_reset)->Apply(churn_sizes);
+    BENCHMARK(fixed_arena_reset)->Apply(churn_sizes);
+
+    BENCHMARK(small_vector_heap)->Apply(churn_sizes);
+    BENCHMARK(small_vector_arena)->Apply(churn_sizes);
+} // namespace
@@ -0,0 +1,169 @@
+// Compare the code ORION_ASSERT generates in static_vector hot paths against the previous inline
+// expansion. Every measured function is placed in its own section, the linker defines __start_ and
+// __stop_ symbols for those, so each benchmark reports the exact size of the code it ran
+#define ORION_ASSERTION_LEVEL 1
+#include "orion-utils/static_vector.h"
+
+#include <algorithm> // std::shuffle
+#include <array>     // std::array
+#include <cstdio>    // std::puts
+#include <cstdlib>   // std::abort
+#include <numeric>   // std::iota
+#include <random>    // std::mt19937
+#include <vector>    // std::vector
+
+#include <benchmark/benchmark.h>
+
+// ORION_ASSERT before the out-of-line handler, formats and prints the message at every call site
+#define LEGACY_ASSERT(condition)                                                                                         \
+    do {                                                                                                                 \
+        if (!(condition)) {                                                                                              \
+            std::puts(fmt::format("Assertion failed ({}:{} {}): {}", __FILE__, __LINE__, __func__, #condition).c_str()); \
+            std::abort();                                                                                                \
+        }                                                                                                                \
+    } while (0)
+
+// NOLINTBEGIN(bugprone-reserved-identifier, cppcoreguidelines-macro-usage): linker defined section bounds
+#define HOT_PATH(name)                       \
+    extern "C" const char __start_##name[]; \
+    extern "C" const char __stop_##name[];  \
+    [[gnu::noinline, gnu::section(#name)]]
+#define CODE_SIZE(name) static_cast<double>(__stop_##name - __start_##name)
+// NOLINTEND(bugprone-reserved-identifier, cppcoreguidelines-macro-usage)
+
+namespace
+{
+    constexpr std::size_t capacity = 1024;
+    using Vector = orion::static_vector<int, capacity>;
+
+    // Same layout, size type and checks as static_vector<int, capacity> with the legacy expansion
+    class LegacyVector
+    {
+    public:
+        int& operator[](Vector::size_type n)
+        {
+            LEGACY_ASSERT(n < capacity);
+            return values_[n];
+        }
+        int& front()
+        {
+            LEGACY_ASSERT(size_ != 0);
+            return values_[0];
+        }
+        int& back()
+        {
+            LEGACY_ASSERT(size_ != 0);
+            return values_[size_ - 1];
+        }
+        void emplace_back(int value)
+        {
+            LEGACY_ASSERT(size_ < capacity);
+            values_[size_++] = value;
+        }
+        void clear() { size_ = 0; }
+
+    private:
+        std::array<int, capacity> values_;
+        Vector::size_type size_ = 0;
+    };
+
+    std::vector<Vector::size_type> make_indices()
+    {
+        std::mt19937 engine{42}; // NOLINT(cert-msc32-c, cert-msc51-cpp): deterministic on purpose
+        std::vector<Vector::size_type> indices(capacity);
+        std::iota(indices.begin(), indices.end(), Vector::size_type{0});
+        std::shuffle(indices.begin(), indices.end(), engine);
+        return indices;
+    }
+
+    HOT_PATH(orion_index_cold) int index_cold(Vector& vector, const std::vector<Vector::size_type>& indices)
+    {
+        int sum = 0;
+        for (auto index : indices) {
+            sum += vector[index];
+        }
+        return sum;
+    }
+    HOT_PATH(orion_index_legacy) int index_legacy(LegacyVector& vector, const std::vector<Vector::size_type>& indices)
+    {
+        int sum = 0;
+        for (auto index : indices) {
+            sum += vector[index];
+        }
+        return sum;
+    }
+
+    HOT_PATH(orion_ends_cold) int ends_cold(Vector& vector)
+    {
+        return vector.front() + vector.back();
+    }
+    HOT_PATH(orion_ends_legacy) int ends_legacy(LegacyVector& vector)
+    {
+        return vector.front() + vector.back();
+    }
+
+    HOT_PATH(orion_fill_cold) void fill_cold(Vector& vector)
+    {
+        vector.clear();
+        for (int i = 0; i < static_cast<int>(capacity); ++i) {
+            vector.emplace_back(i);
+        }
+    }
+    HOT_PATH(orion_fill_legacy) void fill_legacy(LegacyVector& vector)
+    {
+        vector.clear();
+        for (int i = 0; i < static_cast<int>(capacity); ++i) {
+            vector.emplace_back(i);
+        }
+    }
+
+    template<typename VectorType>
+    void checked_index(benchmark::State& state, void (*fill)(VectorType&), int (*index)(VectorType&, const std::vector<Vector::size_type>&), double code_bytes)
+    {
+        const auto indices = make_indices();
+        VectorType vector;
+        fill(vector);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(index(vector, indices));
+        }
+        state.counters["code_bytes"] = code_bytes;
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(capacity));
+    }
+
+    template<typename VectorType>
+    void front_back(benchmark::State& state, void (*fill)(VectorType&), int (*ends)(VectorType&), double code_bytes)
+    {
+        VectorType vector;
+        fill(vector);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(ends(vector));
+        }
+        state.counters["code_bytes"] = code_bytes;
+    }
+
+    template<typename VectorType>
+    void emplace_back(benchmark::State& state, void (*fill)(VectorType&), double code_bytes)
+    {
+        VectorType vector;
+        for (auto _ : state) {
+            fill(vector);
+            benchmark::DoNotOptimize(&vector);
+        }
+        state.counters["code_bytes"] = code_bytes;
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(capacity));
+    }
+
+    void checked_index_cold(benchmark::State& state) { checked_index(state, fill_cold, index_cold, CODE_SIZE(orion_index_cold)); }
+    void checked_index_legacy(benchmark::State& state) { checked_index(state, fill_legacy, index_legacy, CODE_SIZE(orion_index_legacy)); }
+    void front_back_cold(benchmark::State& state) { front_back(state, fill_cold, ends_cold, CODE_SIZE(orion_ends_cold)); }
+    void front_back_legacy(benchmark::State& state) { front_back(state, fill_legacy, ends_legacy, CODE_SIZE(orion_ends_legacy)); }
+    void emplace_back_cold(benchmark::State& state) { emplace_back(state, fill_cold, CODE_SIZE(orion_fill_cold)); }
+    void emplace_back_legacy(benchmark::State& state) { emplace_back(state, fill_legacy, CODE_SIZE(orion_fill_legacy)); }
+
+    BENCHMARK(checked_index_cold);
+    BENCHMARK(checked_index_legacy);
+    BENCHMARK(front_back_cold);
+    BENCHMARK(front_back_legacy);
+    BENCHMARK(emplace_back_cold);
+    BENCHMARK(emplace_back_legacy);
+} // namespace
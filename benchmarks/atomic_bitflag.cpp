@@ -0,0 +1,89 @@
+#include "orion-utils/atomic_bitflag.h"
+
+#include <atomic>  // std::atomic, std::memory_order
+#include <cstdint> // std::uint64_t
+#include <mutex>   // std::mutex, std::scoped_lock
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    enum class Flag : std::uint64_t {};
+    using Flags = orion::Bitflag<Flag>;
+
+    constexpr std::int64_t operations = 1024;
+
+    // The mutex-wrapped Bitflag this replaces
+    class LockedBitflag
+    {
+    public:
+        bool test_and_set(Flag bit, std::memory_order /* order */)
+        {
+            std::scoped_lock lock(mutex_);
+            const bool was_set = flags_.has(bit);
+            flags_ |= bit;
+            return was_set;
+        }
+
+        bool test_and_clear(Flag bit, std::memory_order /* order */)
+        {
+            std::scoped_lock lock(mutex_);
+            const bool was_set = flags_.has(bit);
+            flags_ &= ~Flags{bit};
+            return was_set;
+        }
+
+    private:
+        std::mutex mutex_;
+        Flags flags_;
+    };
+
+    // Read-modify-write through a compare-exchange loop, what a generic atomic update of the mask costs
+    class CasBitflag
+    {
+    public:
+        bool test_and_set(Flag bit, std::memory_order order)
+        {
+            return update(bit, order, [bit](Flags flags) { return flags | bit; });
+        }
+
+        bool test_and_clear(Flag bit, std::memory_order order)
+        {
+            return update(bit, order, [bit](Flags flags) { return flags & ~Flags{bit}; });
+        }
+
+    private:
+        template<typename Update>
+        bool update(Flag bit, std::memory_order order, Update update)
+        {
+            auto current = flags_.load(std::memory_order_relaxed);
+            while (!flags_.compare_exchange_weak(current, update(current), order, std::memory_order_relaxed)) {
+            }
+            return current.has(bit);
+        }
+
+        orion::AtomicBitflag<Flag> flags_;
+    };
+
+    // Every thread flips its own bit of one shared mask, the state flags of a single resource being updated
+    // from several threads. Items per second is the aggregate over all threads
+    template<typename Bitflag>
+    void own_bit(benchmark::State& state)
+    {
+        static Bitflag flags;
+        const auto bit = static_cast<Flag>(state.thread_index());
+        for (auto _ : state) {
+            for (std::int64_t i = 0; i < operations; ++i) {
+                benchmark::DoNotOptimize(flags.test_and_set(bit, std::memory_order_acq_rel));
+                benchmark::DoNotOptimize(flags.test_and_clear(bit, std::memory_order_acq_rel));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * operations * 2);
+    }
+
+    using AtomicBitflag = orion::AtomicBitflag<Flag>;
+
+    BENCHMARK_TEMPLATE(own_bit, AtomicBitflag)->ThreadRange(1, 16)->UseRealTime();
+    BENCHMARK_TEMPLATE(own_bit, CasBitflag)->ThreadRange(1, 16)->UseRealTime();
+    BENCHMARK_TEMPLATE(own_bit, LockedBitflag)->ThreadRange(1, 16)->UseRealTime();
+} // namespace
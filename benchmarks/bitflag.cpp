@@ -0,0 +1,159 @@
+#include "orion-utils/bitflag.h"
+
+#include <cstdint> // std::uint32_t
+#include <random>  // std::mt19937, std::uniform_int_distribution
+#include <vector>  // std::vector
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    enum class Flag : std::uint32_t {};
+    using Flags = orion::Bitflag<Flag>;
+
+    constexpr std::size_t flag_count = 32;
+    constexpr std::size_t sample_count = 4096;
+
+    std::vector<Flag> make_bits()
+    {
+        std::mt19937 engine{42}; // NOLINT(cert-msc32-c, cert-msc51-cpp): deterministic on purpose
+        std::uniform_int_distribution<std::uint32_t> distribution{0, flag_count - 1};
+        std::vector<Flag> bits(sample_count);
+        for (auto& bit : bits) {
+            bit = static_cast<Flag>(distribution(engine));
+        }
+        return bits;
+    }
+
+    std::vector<Flags> make_flags()
+    {
+        std::mt19937 engine{1337}; // NOLINT(cert-msc32-c, cert-msc51-cpp): deterministic on purpose
+        std::vector<Flags> flags(sample_count);
+        for (auto& flag : flags) {
+            flag = Flags{static_cast<std::uint32_t>(engine())};
+        }
+        return flags;
+    }
+
+    void set(benchmark::State& state)
+    {
+        const auto bits = make_bits();
+        for (auto _ : state) {
+            auto flags = Flags::none();
+            for (auto bit : bits) {
+                flags |= bit;
+            }
+            benchmark::DoNotOptimize(flags);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sample_count));
+    }
+    BENCHMARK(set);
+
+    void test(benchmark::State& state)
+    {
+        const auto bits = make_bits();
+        const auto flags = make_flags();
+        for (auto _ : state) {
+            std::size_t hits = 0;
+            for (std::size_t i = 0; i < sample_count; ++i) {
+                hits += flags[i].has(bits[i]) ? 1u : 0u;
+            }
+            benchmark::DoNotOptimize(hits);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sample_count));
+    }
+    BENCHMARK(test);
+
+    // Walks every possible flag and calls has(), which is how set flags are enumerated today
+    void iterate_set(benchmark::State& state)
+    {
+        const auto flags = make_flags();
+        for (auto _ : state) {
+            std::uint32_t sum = 0;
+            for (auto flag : flags) {
+                for (std::uint32_t bit = 0; bit < flag_count; ++bit) {
+                    if (flag.has(static_cast<Flag>(bit))) {
+                        sum += bit;
+                    }
+                }
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sample_count));
+    }
+    BENCHMARK(iterate_set);
+
+    void iterate_set_bits(benchmark::State& state)
+    {
+        const auto flags = make_flags();
+        for (auto _ : state) {
+            std::uint32_t sum = 0;
+            for (auto flag : flags) {
+                for (auto bit : flag.set_bits()) {
+                    sum += static_cast<std::uint32_t>(bit);
+                }
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sample_count));
+    }
+    BENCHMARK(iterate_set_bits);
+
+    void for_each_set(benchmark::State& state)
+    {
+        const auto flags = make_flags();
+        for (auto _ : state) {
+            std::uint32_t sum = 0;
+            for (auto flag : flags) {
+                flag.for_each_set([&sum](Flag bit) { sum += static_cast<std::uint32_t>(bit); });
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sample_count));
+    }
+    BENCHMARK(for_each_set);
+
+    // Changed flags between consecutive states, the render state diffing pattern
+    void diff_changed(benchmark::State& state)
+    {
+        const auto flags = make_flags();
+        for (auto _ : state) {
+            int changed = 0;
+            for (std::size_t i = 1; i < sample_count; ++i) {
+                changed += (flags[i] ^ flags[i - 1]).count();
+            }
+            benchmark::DoNotOptimize(changed);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sample_count));
+    }
+    BENCHMARK(diff_changed);
+
+    void combine(benchmark::State& state)
+    {
+        const auto flags = make_flags();
+        for (auto _ : state) {
+            auto any = Flags::none();
+            auto all = Flags::all();
+            auto diff = Flags::none();
+            for (auto flag : flags) {
+                any |= flag;
+                all &= flag;
+                diff ^= flag;
+            }
+            benchmark::DoNotOptimize(any);
+            benchmark::DoNotOptimize(all);
+            benchmark::DoNotOptimize(diff);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sample_count));
+    }
+    BENCHMARK(combine);
+
+    void disjunction(benchmark::State& state)
+    {
+        for (auto _ : state) {
+            auto flags = Flags::disjunction({Flag{0}, Flag{3}, Flag{7}, Flag{12}, Flag{31}});
+            benchmark::DoNotOptimize(flags);
+        }
+    }
+    BENCHMARK(disjunction);
+} // namespace
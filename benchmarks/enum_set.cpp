@@ -0,0 +1,146 @@
+#include "orion-utils/enum_set.h"
+
+#include <bitset>  // std::bitset
+#include <cstdint> // std::uint16_t
+#include <random>  // std::mt19937
+#include <vector>  // std::vector
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    enum class Value : std::uint16_t {};
+
+    constexpr std::size_t sample_count = 1024;
+
+    template<std::size_t N>
+    std::vector<orion::EnumSet<Value, N>> make_sets()
+    {
+        std::mt19937_64 engine{42}; // NOLINT(cert-msc32-c, cert-msc51-cpp): deterministic on purpose
+        std::vector<orion::EnumSet<Value, N>> sets;
+        sets.reserve(sample_count);
+        for (std::size_t i = 0; i < sample_count; ++i) {
+            typename orion::EnumSet<Value, N>::words_type words;
+            for (auto& word : words) {
+                // Sparse words, a quarter of the bits set
+                word = engine() & engine();
+            }
+            sets.emplace_back(words);
+        }
+        return sets;
+    }
+
+    template<std::size_t N>
+    std::vector<std::bitset<N>> make_bitsets()
+    {
+        std::vector<std::bitset<N>> bitsets;
+        bitsets.reserve(sample_count);
+        for (const auto& set : make_sets<N>()) {
+            std::bitset<N> bitset;
+            set.for_each_set([&bitset](Value value) { bitset.set(static_cast<std::size_t>(value)); });
+            bitsets.push_back(bitset);
+        }
+        return bitsets;
+    }
+
+    // a = (a | b) & ~c ^ d over every set
+    template<std::size_t N>
+    void combine(benchmark::State& state)
+    {
+        auto sets = make_sets<N>();
+        for (auto _ : state) {
+            for (std::size_t i = 0; i + 3 < sets.size(); ++i) {
+                sets[i] = (sets[i] | sets[i + 1]).and_not(sets[i + 2]) ^ sets[i + 3];
+            }
+            benchmark::DoNotOptimize(sets.data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sample_count));
+    }
+
+    template<std::size_t N>
+    void combine_bitset(benchmark::State& state)
+    {
+        auto bitsets = make_bitsets<N>();
+        for (auto _ : state) {
+            for (std::size_t i = 0; i + 3 < bitsets.size(); ++i) {
+                bitsets[i] = ((bitsets[i] | bitsets[i + 1]) & ~bitsets[i + 2]) ^ bitsets[i + 3];
+            }
+            benchmark::DoNotOptimize(bitsets.data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sample_count));
+    }
+
+    template<std::size_t N>
+    void count(benchmark::State& state)
+    {
+        const auto sets = make_sets<N>();
+        for (auto _ : state) {
+            int total = 0;
+            for (const auto& set : sets) {
+                total += set.count();
+            }
+            benchmark::DoNotOptimize(total);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sample_count));
+    }
+
+    template<std::size_t N>
+    void count_bitset(benchmark::State& state)
+    {
+        const auto bitsets = make_bitsets<N>();
+        for (auto _ : state) {
+            std::size_t total = 0;
+            for (const auto& bitset : bitsets) {
+                total += bitset.count();
+            }
+            benchmark::DoNotOptimize(total);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sample_count));
+    }
+
+    template<std::size_t N>
+    void iterate(benchmark::State& state)
+    {
+        const auto sets = make_sets<N>();
+        for (auto _ : state) {
+            std::size_t sum = 0;
+            for (const auto& set : sets) {
+                set.for_each_set([&sum](Value value) { sum += static_cast<std::size_t>(value); });
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sample_count));
+    }
+
+    // std::bitset has no set-bit iteration, test every position
+    template<std::size_t N>
+    void iterate_bitset(benchmark::State& state)
+    {
+        const auto bitsets = make_bitsets<N>();
+        for (auto _ : state) {
+            std::size_t sum = 0;
+            for (const auto& bitset : bitsets) {
+                for (std::size_t i = 0; i < N; ++i) {
+                    if (bitset.test(i)) {
+                        sum += i;
+                    }
+                }
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sample_count));
+    }
+
+    BENCHMARK(combine<256>);
+    BENCHMARK(combine_bitset<256>);
+    BENCHMARK(combine<512>);
+    BENCHMARK(combine_bitset<512>);
+    BENCHMARK(count<256>);
+    BENCHMARK(count_bitset<256>);
+    BENCHMARK(count<512>);
+    BENCHMARK(count_bitset<512>);
+    BENCHMARK(iterate<256>);
+    BENCHMARK(iterate_bitset<256>);
+    BENCHMARK(iterate<512>);
+    BENCHMARK(iterate_bitset<512>);
+} // namespace
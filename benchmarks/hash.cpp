@@ -0,0 +1,87 @@
+#include "orion-utils/hash.h"
+#include "orion-utils/string_id.h"
+
+#include <cstddef>       // std::size_t
+#include <functional>    // std::hash, std::equal_to
+#include <string>        // std::string
+#include <string_view>   // std::string_view
+#include <unordered_map> // std::unordered_map
+#include <utility>       // std::move
+#include <vector>        // std::vector
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    using namespace orion::literals;
+
+    constexpr std::size_t key_count = 16;
+
+    // Keys of state.range(0) bytes, several of them so consecutive hashes don't see the same input
+    std::vector<std::string> make_keys(std::size_t size)
+    {
+        std::vector<std::string> keys;
+        for (char first = 'a'; keys.size() < key_count; ++first) {
+            std::string key(size, 'x');
+            key.front() = first;
+            key.back() = first;
+            keys.push_back(std::move(key));
+        }
+        return keys;
+    }
+
+    template<typename Hash>
+    void hash_keys(benchmark::State& state, Hash hash)
+    {
+        const auto keys = make_keys(static_cast<std::size_t>(state.range(0)));
+        std::size_t index = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(hash(std::string_view{keys[index]}));
+            index = (index + 1) % key_count;
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
+    void std_hash(benchmark::State& state)
+    {
+        hash_keys(state, std::hash<std::string_view>{});
+    }
+
+    void orion_hash(benchmark::State& state)
+    {
+        hash_keys(state, [](std::string_view key) { return orion::hash_bytes(key); });
+    }
+
+    BENCHMARK(std_hash)->RangeMultiplier(4)->Range(4, 1 << 16);
+    BENCHMARK(orion_hash)->RangeMultiplier(4)->Range(4, 1 << 16);
+
+    // Looking up a component by name, the string id is hashed at compile time
+    constexpr std::string_view names[] = {"transform", "mesh_renderer", "rigid_body", "collider", "audio_source", "camera", "light", "animator"};
+
+    void lookup_by_string(benchmark::State& state)
+    {
+        std::unordered_map<std::string, int, orion::string_hash, std::equal_to<>> components;
+        for (int i = 0; const auto name : names) {
+            components.emplace(name, i++);
+        }
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(components.find("rigid_body")->second);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void lookup_by_string_id(benchmark::State& state)
+    {
+        std::unordered_map<orion::string_id, int> components;
+        for (int i = 0; const auto name : names) {
+            components.emplace(orion::string_id{name}, i++);
+        }
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(components.find("rigid_body"_sid)->second);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(lookup_by_string);
+    BENCHMARK(lookup_by_string_id);
+} // namespace
@@ -0,0 +1,80 @@
+#include "orion-utils/hierarchical_bitset.h"
+
+#include <array>    // std::array
+#include <bit>      // std::countr_one
+#include <cstdint>  // std::uint64_t
+#include <memory>   // std::make_unique
+#include <optional> // std::optional
+#include <random>   // std::mt19937
+#include <vector>   // std::vector
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    constexpr std::size_t capacity = 1 << 18;
+
+    // Scans the words from the start for the first free index, what pools do today
+    class LinearAllocator
+    {
+    public:
+        using size_type = std::size_t;
+
+        std::optional<std::size_t> allocate() noexcept
+        {
+            for (std::size_t word = 0; word < words_.size(); ++word) {
+                if (words_[word] != ~std::uint64_t{0}) {
+                    const auto bit = static_cast<std::size_t>(std::countr_one(words_[word]));
+                    words_[word] |= std::uint64_t{1} << bit;
+                    return word * 64 + bit;
+                }
+            }
+            return std::nullopt;
+        }
+
+        void free(std::size_t index) noexcept
+        {
+            words_[index / 64] &= ~(std::uint64_t{1} << (index % 64));
+        }
+
+    private:
+        std::array<std::uint64_t, capacity / 64> words_{};
+    };
+
+    using IndexAllocator = orion::index_allocator<capacity>;
+
+    // From a pool that fits in L1 to one spanning three levels
+    void sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->RangeMultiplier(8)->Range(512, capacity);
+    }
+
+    // Fills a pool of the given size, then frees random indices and allocates the lowest free one again.
+    // The freed indices are spread over the whole pool, like objects dying in a long-running pool
+    template<typename Allocator>
+    void churn(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        auto allocator = std::make_unique<Allocator>();
+        for (std::size_t i = 0; i < count; ++i) {
+            benchmark::DoNotOptimize(allocator->allocate());
+        }
+        std::mt19937 engine{42}; // NOLINT(cert-msc32-c, cert-msc51-cpp): deterministic on purpose
+        std::uniform_int_distribution<std::size_t> distribution{0, count - 1};
+        std::vector<std::size_t> frees(4096);
+        for (auto& index : frees) {
+            index = distribution(engine);
+        }
+
+        for (auto _ : state) {
+            for (auto index : frees) {
+                allocator->free(static_cast<typename Allocator::size_type>(index));
+                benchmark::DoNotOptimize(allocator->allocate());
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(frees.size()));
+    }
+
+    BENCHMARK_TEMPLATE(churn, IndexAllocator)->Apply(sizes);
+    BENCHMARK_TEMPLATE(churn, LinearAllocator)->Apply(sizes);
+} // namespace
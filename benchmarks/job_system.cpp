@@ -0,0 +1,96 @@
+#include "orion-utils/job_system.h"
+
+#include <algorithm> // std::max
+#include <atomic>    // std::atomic
+#include <cmath>     // std::sqrt
+#include <thread>    // std::thread::hardware_concurrency
+#include <vector>    // std::vector
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    // Worker counts from none (calling thread only) up to one per hardware thread
+    void worker_counts(benchmark::internal::Benchmark* benchmark)
+    {
+        const auto hardware_threads = static_cast<int>(std::max(std::thread::hardware_concurrency(), 4u));
+        for (int workers = 0; workers < hardware_threads; workers = std::max(workers * 2, workers + 1)) {
+            benchmark->Arg(workers);
+        }
+        benchmark->Arg(hardware_threads - 1);
+        benchmark->UseRealTime();
+    }
+
+    constexpr std::size_t element_count = 1 << 20;
+
+    void serial_for(benchmark::State& state)
+    {
+        std::vector<float> values(element_count, 2.0f);
+        for (auto _ : state) {
+            for (auto& value : values) {
+                value = std::sqrt(value * value + 1.0f);
+            }
+            benchmark::DoNotOptimize(values.data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(element_count));
+    }
+
+    void parallel_for(benchmark::State& state)
+    {
+        orion::JobSystem jobs(static_cast<std::size_t>(state.range(0)));
+        std::vector<float> values(element_count, 2.0f);
+        for (auto _ : state) {
+            jobs.parallel_for(values, 4096, [](float& value) { value = std::sqrt(value * value + 1.0f); });
+            benchmark::DoNotOptimize(values.data());
+        }
+        state.counters["workers"] = static_cast<double>(state.range(0));
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(element_count));
+    }
+
+    // Many tiny independent jobs started from outside the pool
+    void run_wait(benchmark::State& state)
+    {
+        constexpr int job_count = 1000;
+        orion::JobSystem jobs(static_cast<std::size_t>(state.range(0)));
+        std::atomic<int> sum = 0;
+        for (auto _ : state) {
+            orion::JobCounter counter;
+            for (int i = 0; i < job_count; ++i) {
+                jobs.run([&sum]() { sum.fetch_add(1, std::memory_order_relaxed); }, counter);
+            }
+            jobs.wait(counter);
+        }
+        benchmark::DoNotOptimize(sum.load());
+        state.counters["workers"] = static_cast<double>(state.range(0));
+        state.SetItemsProcessed(state.iterations() * job_count);
+    }
+
+    // Recursive fork-join, jobs spawn jobs and most work is found by stealing
+    int fibonacci(orion::JobSystem& jobs, int n)
+    {
+        if (n < 16) {
+            return n < 2 ? n : fibonacci(jobs, n - 1) + fibonacci(jobs, n - 2);
+        }
+        int a = 0;
+        int b = 0;
+        orion::JobCounter counter;
+        jobs.run([&jobs, &a, n]() { a = fibonacci(jobs, n - 1); }, counter);
+        b = fibonacci(jobs, n - 2);
+        jobs.wait(counter);
+        return a + b;
+    }
+
+    void fork_join(benchmark::State& state)
+    {
+        orion::JobSystem jobs(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(fibonacci(jobs, 28));
+        }
+        state.counters["workers"] = static_cast<double>(state.range(0));
+    }
+
+    BENCHMARK(serial_for)->UseRealTime();
+    BENCHMARK(parallel_for)->Apply(worker_counts);
+    BENCHMARK(run_wait)->Apply(worker_counts);
+    BENCHMARK(fork_join)->Apply(worker_counts)->Unit(benchmark::kMillisecond);
+} // namespace
@@ -0,0 +1,85 @@
+#include "orion-utils/mpmc_queue.h"
+
+#include <deque>    // std::deque
+#include <mutex>    // std::mutex, std::scoped_lock
+#include <optional> // std::optional
+#include <thread>   // std::this_thread::yield
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    constexpr std::size_t capacity = 1024;
+    constexpr std::int64_t operations = 1024;
+
+    // Global lock baseline
+    template<typename T>
+    class LockedQueue
+    {
+    public:
+        bool try_push(const T& value)
+        {
+            std::scoped_lock lock(mutex_);
+            if (queue_.size() == capacity) {
+                return false;
+            }
+            queue_.push_back(value);
+            return true;
+        }
+
+        std::optional<T> try_pop()
+        {
+            std::scoped_lock lock(mutex_);
+            if (queue_.empty()) {
+                return std::nullopt;
+            }
+            auto value = queue_.front();
+            queue_.pop_front();
+            return value;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::deque<T> queue_;
+    };
+
+    // Every thread is both a producer and a consumer of one shared queue. Items per second is the
+    // aggregate over all threads, divide by the thread count for throughput per core
+    template<typename Queue>
+    void push_pop(benchmark::State& state)
+    {
+        static Queue queue;
+        for (auto _ : state) {
+            for (std::int64_t i = 0; i < operations; ++i) {
+                while (!queue.try_push(i)) {
+                    std::this_thread::yield();
+                }
+                std::optional<std::int64_t> value;
+                while (!(value = queue.try_pop())) {
+                    std::this_thread::yield();
+                }
+                benchmark::DoNotOptimize(value);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * operations);
+    }
+
+    // Same as push_pop with the blocking functions
+    void push_pop_blocking(benchmark::State& state)
+    {
+        static orion::mpmc_queue<std::int64_t, capacity> queue;
+        for (auto _ : state) {
+            for (std::int64_t i = 0; i < operations; ++i) {
+                queue.push(i);
+                benchmark::DoNotOptimize(queue.pop());
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * operations);
+    }
+
+    using MpmcQueue = orion::mpmc_queue<std::int64_t, capacity>;
+
+    BENCHMARK_TEMPLATE(push_pop, MpmcQueue)->ThreadRange(1, 16)->UseRealTime();
+    BENCHMARK_TEMPLATE(push_pop, LockedQueue<std::int64_t>)->ThreadRange(1, 16)->UseRealTime();
+    BENCHMARK(push_pop_blocking)->ThreadRange(1, 16)->UseRealTime();
+} // namespace
@@ -0,0 +1,96 @@
+#include "orion-utils/object_pool.h"
+
+#include <mutex>  // std::mutex
+#include <vector> // std::vector
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    // Stand-in for an entity or command struct
+    struct Command {
+        explicit Command(int v)
+            : id(v)
+        {
+        }
+
+        int id;
+        float payload[7]{};
+    };
+
+    void churn_sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->RangeMultiplier(8)->Range(64, 4096);
+    }
+
+    // Allocates a batch of objects and frees them again, the pattern of per-frame commands
+    template<typename Allocator>
+    void churn(benchmark::State& state, Allocator& allocator)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        std::vector<Command*> objects(count);
+        for (auto _ : state) {
+            int id = 0;
+            for (auto& object : objects) {
+                object = allocator.create(id++);
+            }
+            benchmark::DoNotOptimize(objects.data());
+            for (auto* object : objects) {
+                allocator.destroy(object);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+    struct NewDelete {
+        static Command* create(int id) { return new Command(id); }
+        static void destroy(Command* command) { delete command; }
+    };
+
+    void new_delete(benchmark::State& state)
+    {
+        NewDelete allocator;
+        churn(state, allocator);
+    }
+
+    void object_pool(benchmark::State& state)
+    {
+        orion::ObjectPool<Command> pool;
+        churn(state, pool);
+    }
+
+    void locked_object_pool(benchmark::State& state)
+    {
+        orion::ObjectPool<Command, 64, std::mutex> pool;
+        churn(state, pool);
+    }
+
+    BENCHMARK(new_delete)->Apply(churn_sizes);
+    BENCHMARK(object_pool)->Apply(churn_sizes);
+    BENCHMARK(locked_object_pool)->Apply(churn_sizes);
+
+    // Every thread churns through one shared pool, directly or through its own magazine
+    using SharedPool = orion::ObjectPool<Command, 256, std::mutex>;
+    SharedPool shared_pool;
+
+    void shared_new_delete(benchmark::State& state)
+    {
+        NewDelete allocator;
+        churn(state, allocator);
+    }
+
+    void shared_object_pool(benchmark::State& state)
+    {
+        churn(state, shared_pool);
+    }
+
+    void shared_object_pool_magazine(benchmark::State& state)
+    {
+        SharedPool::Magazine magazine(shared_pool, 64);
+        churn(state, magazine);
+    }
+
+    BENCHMARK(shared_new_delete)->Arg(512)->ThreadRange(1, 8)->UseRealTime();
+    BENCHMARK(shared_object_pool)->Arg(512)->ThreadRange(1, 8)->UseRealTime();
+    BENCHMARK(shared_object_pool_magazine)->Arg(512)->ThreadRange(1, 8)->UseRealTime();
+} // namespace
@@ -0,0 +1,95 @@
+#define ORION_PROFILING 1
+#include "orion-utils/profiler.h"
+
+#include <cstdint> // std::uint64_t
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    // Drains the ring before it fills up, outside the measured time
+    void collect_when_half_full(benchmark::State& state, std::uint64_t iteration)
+    {
+        if (iteration % (orion::Profiler::buffer_capacity / 2) == 0) {
+            state.PauseTiming();
+            orion::Profiler::instance().clear();
+            state.ResumeTiming();
+        }
+    }
+
+    // What every zone compiles to without ORION_PROFILING
+    void zone_compiled_out(benchmark::State& state)
+    {
+        std::uint64_t iteration = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(++iteration);
+        }
+    }
+
+    void zone_disabled(benchmark::State& state)
+    {
+        orion::Profiler::set_enabled(false);
+        std::uint64_t iteration = 0;
+        for (auto _ : state) {
+            ORION_PROFILE_SCOPE("zone");
+            benchmark::DoNotOptimize(++iteration);
+        }
+        orion::Profiler::set_enabled(true);
+    }
+
+    void zone_enabled(benchmark::State& state)
+    {
+        std::uint64_t iteration = 0;
+        for (auto _ : state) {
+            {
+                ORION_PROFILE_SCOPE("zone");
+                benchmark::DoNotOptimize(++iteration);
+            }
+            collect_when_half_full(state, iteration);
+        }
+    }
+
+    void nested_zones_enabled(benchmark::State& state)
+    {
+        std::uint64_t iteration = 0;
+        for (auto _ : state) {
+            {
+                ORION_PROFILE_SCOPE("outer");
+                ORION_PROFILE_SCOPE("inner");
+                benchmark::DoNotOptimize(++iteration);
+            }
+            collect_when_half_full(state, iteration * 2);
+        }
+    }
+
+    // An enabled zone reads the clock twice
+    void clock(benchmark::State& state)
+    {
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(orion::Profiler::now());
+        }
+    }
+
+    BENCHMARK(clock);
+    BENCHMARK(zone_compiled_out);
+    BENCHMARK(zone_disabled);
+    BENCHMARK(zone_enabled);
+    BENCHMARK(nested_zones_enabled);
+
+    // Collecting on a separate thread while every benchmark thread records zones
+    void zone_enabled_threads(benchmark::State& state)
+    {
+        std::uint64_t iteration = 0;
+        for (auto _ : state) {
+            {
+                ORION_PROFILE_SCOPE("zone");
+                benchmark::DoNotOptimize(++iteration);
+            }
+            if (state.thread_index() == 0) {
+                collect_when_half_full(state, iteration);
+            }
+        }
+    }
+
+    BENCHMARK(zone_enabled_threads)->ThreadRange(1, 4);
+} // namespace
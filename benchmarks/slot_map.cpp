@@ -0,0 +1,137 @@
+#include "orion-utils/slot_map.h"
+
+#include <algorithm>     // std::shuffle
+#include <concepts>      // std::same_as
+#include <cstdint>       // std::uint32_t
+#include <random>        // std::mt19937
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector, std::erase_if
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    constexpr std::size_t capacity = 1 << 14;
+
+    // Typical engine component, a transform and a few flags
+    struct Object {
+        float position[3];
+        float rotation[4];
+        float scale[3];
+        std::uint32_t flags;
+    };
+
+    using SlotMap = orion::slot_map<Object, capacity>;
+    using DynamicSlotMap = orion::dynamic_slot_map<Object>;
+    using UnorderedMap = std::unordered_map<std::uint32_t, Object>;
+
+    void sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->RangeMultiplier(8)->Range(64, capacity);
+    }
+
+    std::mt19937& engine()
+    {
+        static std::mt19937 engine{42}; // NOLINT(cert-msc32-c, cert-msc51-cpp): deterministic on purpose
+        return engine;
+    }
+
+    Object make_object(std::size_t i)
+    {
+        return Object{.position = {static_cast<float>(i), 0, 0}, .rotation = {0, 0, 0, 1}, .scale = {1, 1, 1}, .flags = 1};
+    }
+
+    // Fills the container and erases every fourth element so the storage has holes, like after some churn.
+    // Returns the keys of live elements in random order
+    template<typename Container>
+    auto populate(Container& container, std::size_t count)
+    {
+        if constexpr (std::same_as<Container, UnorderedMap>) {
+            std::vector<std::uint32_t> keys;
+            for (std::uint32_t i = 0; i < count; ++i) {
+                container.emplace(i, make_object(i));
+                keys.push_back(i);
+            }
+            std::erase_if(keys, [&container](std::uint32_t key) { return key % 4 == 0 && container.erase(key) != 0; });
+            std::shuffle(keys.begin(), keys.end(), engine());
+            return keys;
+        } else {
+            std::vector<typename Container::handle_type> keys;
+            for (std::size_t i = 0; i < count; ++i) {
+                keys.push_back(container.insert(make_object(i)));
+            }
+            std::erase_if(keys, [&container, i = 0](auto handle) mutable { return i++ % 4 == 0 && container.erase(handle); });
+            std::shuffle(keys.begin(), keys.end(), engine());
+            return keys;
+        }
+    }
+
+    template<typename Container>
+    void lookup(benchmark::State& state)
+    {
+        Container container;
+        const auto keys = populate(container, static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state) {
+            float sum = 0;
+            for (auto key : keys) {
+                if constexpr (std::same_as<Container, UnorderedMap>) {
+                    sum += container.find(key)->second.position[0];
+                } else {
+                    sum += container.find(key)->position[0];
+                }
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(keys.size()));
+    }
+
+    template<typename Container>
+    void iterate(benchmark::State& state)
+    {
+        Container container;
+        const auto keys = populate(container, static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state) {
+            for (auto& element : container) {
+                if constexpr (std::same_as<Container, UnorderedMap>) {
+                    element.second.position[0] += 1.0f;
+                } else {
+                    element.position[0] += 1.0f;
+                }
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(keys.size()));
+    }
+
+    // Erase and re-insert every live element
+    template<typename Container>
+    void churn(benchmark::State& state)
+    {
+        Container container;
+        auto keys = populate(container, static_cast<std::size_t>(state.range(0)));
+        std::uint32_t next_key = static_cast<std::uint32_t>(state.range(0));
+        for (auto _ : state) {
+            for (auto& key : keys) {
+                container.erase(key);
+                if constexpr (std::same_as<Container, UnorderedMap>) {
+                    key = next_key++;
+                    container.emplace(key, make_object(key));
+                } else {
+                    key = container.insert(make_object(0));
+                }
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(keys.size()));
+    }
+
+    BENCHMARK_TEMPLATE(lookup, SlotMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(lookup, DynamicSlotMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(lookup, UnorderedMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(iterate, SlotMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(iterate, DynamicSlotMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(iterate, UnorderedMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(churn, SlotMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(churn, DynamicSlotMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(churn, UnorderedMap)->Apply(sizes);
+} // namespace
@@ -0,0 +1,105 @@
+#include "orion-utils/small_vector.h"
+#include "orion-utils/static_vector.h"
+
+#include "types.h"
+
+#include <vector> // std::vector
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    using namespace orion::benchmarks;
+
+    constexpr std::size_t inline_capacity = 16;
+
+    template<typename T>
+    using SmallVector = orion::small_vector<T, inline_capacity>;
+    template<typename T>
+    using StaticVector = orion::static_vector<T, inline_capacity>;
+    template<typename T>
+    using Vector = std::vector<T>;
+
+    // Sizes that fit inline
+    void inline_sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->Arg(4)->Arg(inline_capacity);
+    }
+
+    // Sizes that spill to the heap
+    void spill_sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->RangeMultiplier(8)->Range(64, 4096);
+    }
+
+    // A fresh container per iteration, the typical use of a local scratch list
+    template<typename Container>
+    void fill(benchmark::State& state)
+    {
+        using value_type = typename Container::value_type;
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto values = make_values<value_type>(count);
+        for (auto _ : state) {
+            Container container;
+            for (const auto& value : values) {
+                container.push_back(value);
+            }
+            benchmark::DoNotOptimize(container.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+    template<typename Container>
+    void iterate(benchmark::State& state)
+    {
+        using value_type = typename Container::value_type;
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto values = make_values<value_type>(count);
+        const Container container(values.begin(), values.end());
+        for (auto _ : state) {
+            int sum = 0;
+            for (const auto& value : container) {
+                if constexpr (std::is_same_v<value_type, NonTrivial>) {
+                    sum += static_cast<int>(value.value.size());
+                } else {
+                    sum += value.value;
+                }
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+    template<typename Container>
+    void copy(benchmark::State& state)
+    {
+        using value_type = typename Container::value_type;
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto values = make_values<value_type>(count);
+        const Container source(values.begin(), values.end());
+        for (auto _ : state) {
+            Container copy(source);
+            benchmark::DoNotOptimize(copy.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+#define ORION_BENCHMARK_SMALL_VECTOR(function, type)                        \
+    BENCHMARK_TEMPLATE(function, SmallVector<type>)->Apply(inline_sizes);  \
+    BENCHMARK_TEMPLATE(function, StaticVector<type>)->Apply(inline_sizes); \
+    BENCHMARK_TEMPLATE(function, Vector<type>)->Apply(inline_sizes);       \
+    BENCHMARK_TEMPLATE(function, SmallVector<type>)->Apply(spill_sizes);   \
+    BENCHMARK_TEMPLATE(function, Vector<type>)->Apply(spill_sizes)
+
+    ORION_BENCHMARK_SMALL_VECTOR(fill, Trivial);
+    ORION_BENCHMARK_SMALL_VECTOR(fill, Relocatable);
+    ORION_BENCHMARK_SMALL_VECTOR(fill, NonTrivial);
+
+    ORION_BENCHMARK_SMALL_VECTOR(iterate, Trivial);
+    ORION_BENCHMARK_SMALL_VECTOR(iterate, NonTrivial);
+
+    ORION_BENCHMARK_SMALL_VECTOR(copy, Trivial);
+    ORION_BENCHMARK_SMALL_VECTOR(copy, NonTrivial);
+} // namespace
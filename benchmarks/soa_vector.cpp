@@ -0,0 +1,129 @@
+#include "orion-utils/soa_vector.h"
+#include "orion-utils/static_vector.h"
+
+#include <cstdint> // std::uint32_t
+#include <memory>  // std::make_unique
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    constexpr std::size_t capacity = 1 << 16;
+
+    struct Vec3 {
+        float x, y, z;
+    };
+
+    struct Vec4 {
+        float x, y, z, w;
+    };
+
+    // 64 bytes per particle, the update pass only needs position and velocity
+    struct Particle {
+        Vec3 position;
+        Vec3 velocity;
+        Vec4 rotation;
+        float lifetime;
+        float size;
+        std::uint32_t color;
+        std::uint32_t flags;
+        float padding[2];
+    };
+    static_assert(sizeof(Particle) == 64);
+
+    using ParticleArray = orion::static_vector<Particle, capacity>;
+    using ParticleColumns = orion::static_soa_vector<capacity, Vec3, Vec3, Vec4, float, float, std::uint32_t, std::uint32_t>;
+
+    void sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->RangeMultiplier(8)->Range(512, capacity);
+    }
+
+    Particle make_particle(std::size_t i)
+    {
+        const auto f = static_cast<float>(i);
+        return Particle{.position = {f, 0, 0}, .velocity = {0, 1, f}, .rotation = {0, 0, 0, 1}, .lifetime = 1, .size = 1, .color = 0xFFFFFFFF, .flags = 0, .padding = {}};
+    }
+
+    constexpr float dt = 1.0f / 60.0f;
+
+    void update_aos(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        auto particles = std::make_unique<ParticleArray>();
+        for (std::size_t i = 0; i < count; ++i) {
+            particles->push_back(make_particle(i));
+        }
+        for (auto _ : state) {
+            for (auto& particle : *particles) {
+                particle.position.x += particle.velocity.x * dt;
+                particle.position.y += particle.velocity.y * dt;
+                particle.position.z += particle.velocity.z * dt;
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(Particle)));
+    }
+
+    void update_soa(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        auto particles = std::make_unique<ParticleColumns>();
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto particle = make_particle(i);
+            particles->emplace_back(particle.position, particle.velocity, particle.rotation, particle.lifetime, particle.size, particle.color, particle.flags);
+        }
+        for (auto _ : state) {
+            const auto positions = particles->column<0>();
+            const auto velocities = particles->column<1>();
+            for (std::size_t i = 0; i < positions.size(); ++i) {
+                positions[i].x += velocities[i].x * dt;
+                positions[i].y += velocities[i].y * dt;
+                positions[i].z += velocities[i].z * dt;
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(2 * sizeof(Vec3)));
+    }
+
+    // Single field pass, where the difference in touched bytes is largest
+    void age_aos(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        auto particles = std::make_unique<ParticleArray>();
+        for (std::size_t i = 0; i < count; ++i) {
+            particles->push_back(make_particle(i));
+        }
+        for (auto _ : state) {
+            for (auto& particle : *particles) {
+                particle.lifetime -= dt;
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void age_soa(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        auto particles = std::make_unique<ParticleColumns>();
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto particle = make_particle(i);
+            particles->emplace_back(particle.position, particle.velocity, particle.rotation, particle.lifetime, particle.size, particle.color, particle.flags);
+        }
+        for (auto _ : state) {
+            for (auto& lifetime : particles->column<3>()) {
+                lifetime -= dt;
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK(update_aos)->Apply(sizes);
+    BENCHMARK(update_soa)->Apply(sizes);
+    BENCHMARK(age_aos)->Apply(sizes);
+    BENCHMARK(age_soa)->Apply(sizes);
+} // namespace
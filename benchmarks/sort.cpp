@@ -0,0 +1,138 @@
+#include "orion-utils/sort.h"
+#include "orion-utils/static_vector.h"
+
+#include <algorithm> // std::sort, std::copy
+#include <cstdint>   // std::uint32_t, std::uint64_t
+#include <random>    // std::mt19937_64
+#include <span>      // std::span
+#include <vector>    // std::vector
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    std::mt19937_64& engine()
+    {
+        static std::mt19937_64 engine{42}; // NOLINT(cert-msc32-c, cert-msc51-cpp): deterministic on purpose
+        return engine;
+    }
+
+    template<typename T>
+    std::vector<T> random_keys(std::size_t count)
+    {
+        std::vector<T> keys(count);
+        for (auto& key : keys) {
+            key = static_cast<T>(engine()());
+        }
+        return keys;
+    }
+
+    void sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->RangeMultiplier(8)->Range(16, 1 << 20);
+    }
+
+    // Every iteration sorts a fresh copy of the same random keys, the copy is part of every measurement
+    template<typename T, typename Sort>
+    void sort_keys(benchmark::State& state, Sort sort)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto source = random_keys<T>(count);
+        std::vector<T> keys(count);
+        for (auto _ : state) {
+            std::copy(source.begin(), source.end(), keys.begin());
+            sort(keys);
+            benchmark::DoNotOptimize(keys.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template<typename T>
+    void std_sort(benchmark::State& state)
+    {
+        sort_keys<T>(state, [](std::vector<T>& keys) { std::sort(keys.begin(), keys.end()); });
+    }
+
+    template<typename T>
+    void radix_sort(benchmark::State& state)
+    {
+        std::vector<T> scratch(static_cast<std::size_t>(state.range(0)));
+        sort_keys<T>(state, [&scratch](std::vector<T>& keys) { orion::radix_sort(keys, scratch); });
+    }
+
+    BENCHMARK_TEMPLATE(std_sort, std::uint32_t)->Apply(sizes);
+    BENCHMARK_TEMPLATE(radix_sort, std::uint32_t)->Apply(sizes);
+    BENCHMARK_TEMPLATE(std_sort, std::uint64_t)->Apply(sizes);
+    BENCHMARK_TEMPLATE(radix_sort, std::uint64_t)->Apply(sizes);
+
+    // Many different small arrays, where the front end uses sorting networks. Sorting the same keys in every
+    // iteration would let the branch predictor learn the comparisons std::sort makes
+    template<typename Sort>
+    void sort_small_arrays(benchmark::State& state, Sort sort)
+    {
+        constexpr std::size_t array_count = 1024;
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto source = random_keys<std::uint32_t>(count * array_count);
+        std::vector<std::uint32_t> keys(source.size());
+        for (auto _ : state) {
+            std::copy(source.begin(), source.end(), keys.begin());
+            for (std::size_t first = 0; first < keys.size(); first += count) {
+                sort(std::span<std::uint32_t>{keys.data() + first, count});
+            }
+            benchmark::DoNotOptimize(keys.data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(keys.size()));
+    }
+
+    void small_std_sort(benchmark::State& state)
+    {
+        sort_small_arrays(state, [](std::span<std::uint32_t> keys) { std::sort(keys.begin(), keys.end()); });
+    }
+
+    void small_orion_sort(benchmark::State& state)
+    {
+        sort_small_arrays(state, [](std::span<std::uint32_t> keys) { orion::sort(keys); });
+    }
+
+    BENCHMARK(small_std_sort)->Arg(4)->Arg(8)->Arg(16)->Arg(32);
+    BENCHMARK(small_orion_sort)->Arg(4)->Arg(8)->Arg(16)->Arg(32);
+
+    struct DrawKey {
+        std::uint64_t key;
+        std::uint32_t index;
+    };
+
+    constexpr std::size_t draw_list_capacity = 4096;
+    using DrawList = orion::static_vector<DrawKey, draw_list_capacity>;
+
+    // A frame's draw list sorted by its key
+    template<typename Sort>
+    void sort_draw_list(benchmark::State& state, Sort sort)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        DrawList source;
+        for (std::uint32_t i = 0; i < count; ++i) {
+            source.push_back(DrawKey{engine()(), i});
+        }
+        DrawList draws;
+        for (auto _ : state) {
+            draws = source;
+            sort(draws);
+            benchmark::DoNotOptimize(draws.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void draw_list_std_sort(benchmark::State& state)
+    {
+        sort_draw_list(state, [](DrawList& draws) { std::sort(draws.begin(), draws.end(), [](const DrawKey& lhs, const DrawKey& rhs) { return lhs.key < rhs.key; }); });
+    }
+
+    void draw_list_orion_sort(benchmark::State& state)
+    {
+        sort_draw_list(state, [](DrawList& draws) { orion::sort(draws, {}, &DrawKey::key); });
+    }
+
+    BENCHMARK(draw_list_std_sort)->RangeMultiplier(4)->Range(16, draw_list_capacity);
+    BENCHMARK(draw_list_orion_sort)->RangeMultiplier(4)->Range(16, draw_list_capacity);
+} // namespace
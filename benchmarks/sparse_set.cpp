@@ -0,0 +1,145 @@
+#include "orion-utils/sparse_set.h"
+
+#include <algorithm>     // std::shuffle
+#include <cstdint>       // std::uint32_t
+#include <numeric>       // std::iota
+#include <random>        // std::mt19937
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    enum class Entity : std::uint32_t {};
+
+    struct Position {
+        float x, y, z;
+    };
+    struct Velocity {
+        float x, y, z;
+    };
+    struct Health {
+        float value;
+    };
+
+    constexpr std::uint32_t entity_count = 1'000'000;
+
+    // Every entity has a position, every second one a velocity and every fifth one health. Components are
+    // added in random entity order, like a world that has seen spawns and despawns
+    struct World {
+        World()
+        {
+            std::vector<std::uint32_t> ids(entity_count);
+            std::iota(ids.begin(), ids.end(), std::uint32_t{0});
+            std::mt19937 engine{42}; // NOLINT(cert-msc32-c, cert-msc51-cpp): deterministic on purpose
+            std::shuffle(ids.begin(), ids.end(), engine);
+            for (auto id : ids) {
+                const auto entity = static_cast<Entity>(id);
+                positions.insert(entity, {static_cast<float>(id), 0, 0});
+                position_map.emplace(id, Position{static_cast<float>(id), 0, 0});
+                if (id % 2 == 0) {
+                    velocities.insert(entity, {1, 2, 3});
+                    velocity_map.emplace(id, Velocity{1, 2, 3});
+                }
+                if (id % 5 == 0) {
+                    healths.insert(entity, {100});
+                    health_map.emplace(id, Health{100});
+                }
+            }
+        }
+
+        orion::sparse_set<Entity, Position> positions;
+        orion::sparse_set<Entity, Velocity> velocities;
+        orion::sparse_set<Entity, Health> healths;
+        std::unordered_map<std::uint32_t, Position> position_map;
+        std::unordered_map<std::uint32_t, Velocity> velocity_map;
+        std::unordered_map<std::uint32_t, Health> health_map;
+    };
+
+    World& world()
+    {
+        static World world;
+        return world;
+    }
+
+    void integrate(Position& position, const Velocity& velocity)
+    {
+        position.x += velocity.x;
+        position.y += velocity.y;
+        position.z += velocity.z;
+    }
+
+    void join2_view(benchmark::State& state)
+    {
+        auto& [positions, velocities, healths, position_map, velocity_map, health_map] = world();
+        for (auto _ : state) {
+            orion::view(positions, velocities).each([](Entity, Position& position, const Velocity& velocity) { integrate(position, velocity); });
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(velocities.size()));
+    }
+
+    // Positions sorted to match velocities, both dense arrays are walked front to back
+    void join2_view_sorted(benchmark::State& state)
+    {
+        auto& [positions, velocities, healths, position_map, velocity_map, health_map] = world();
+        velocities.sort([](Entity lhs, Entity rhs) { return lhs < rhs; });
+        positions.sort_as(velocities);
+        for (auto _ : state) {
+            orion::view(positions, velocities).each([](Entity, Position& position, const Velocity& velocity) { integrate(position, velocity); });
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(velocities.size()));
+    }
+
+    void join2_unordered_map(benchmark::State& state)
+    {
+        auto& [positions, velocities, healths, position_map, velocity_map, health_map] = world();
+        for (auto _ : state) {
+            for (const auto& [id, velocity] : velocity_map) {
+                if (auto position = position_map.find(id); position != position_map.end()) {
+                    integrate(position->second, velocity);
+                }
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(velocity_map.size()));
+    }
+
+    void join3_view(benchmark::State& state)
+    {
+        auto& [positions, velocities, healths, position_map, velocity_map, health_map] = world();
+        for (auto _ : state) {
+            orion::view(positions, velocities, healths).each([](Entity, Position& position, const Velocity& velocity, Health& health) {
+                integrate(position, velocity);
+                health.value -= 0.5f;
+            });
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(healths.size()));
+    }
+
+    void join3_unordered_map(benchmark::State& state)
+    {
+        auto& [positions, velocities, healths, position_map, velocity_map, health_map] = world();
+        for (auto _ : state) {
+            for (auto& [id, health] : health_map) {
+                auto position = position_map.find(id);
+                auto velocity = velocity_map.find(id);
+                if (position != position_map.end() && velocity != velocity_map.end()) {
+                    integrate(position->second, velocity->second);
+                    health.value -= 0.5f;
+                }
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(health_map.size()));
+    }
+
+    BENCHMARK(join2_view)->Unit(benchmark::kMillisecond);
+    BENCHMARK(join2_view_sorted)->Unit(benchmark::kMillisecond);
+    BENCHMARK(join2_unordered_map)->Unit(benchmark::kMillisecond);
+    BENCHMARK(join3_view)->Unit(benchmark::kMillisecond);
+    BENCHMARK(join3_unordered_map)->Unit(benchmark::kMillisecond);
+} // namespace
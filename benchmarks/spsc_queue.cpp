@@ -0,0 +1,160 @@
+#include "orion-utils/spsc_queue.h"
+
+#include <algorithm> // std::min
+#include <array>     // std::array
+#include <deque>     // std::deque
+#include <mutex>     // std::mutex, std::scoped_lock
+#include <optional>  // std::optional
+#include <thread>    // std::thread, std::this_thread::yield
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    constexpr std::size_t capacity = 1024;
+    constexpr std::int64_t messages = 1 << 20;
+
+    // Yield while waiting so the benchmark also makes progress on machines with fewer cores than threads
+    void wait()
+    {
+        std::this_thread::yield();
+    }
+
+    // What the simulation and IO threads used before: a deque behind a mutex
+    template<typename T>
+    class LockedQueue
+    {
+    public:
+        bool try_push(const T& value)
+        {
+            std::scoped_lock lock(mutex_);
+            if (queue_.size() == capacity) {
+                return false;
+            }
+            queue_.push_back(value);
+            return true;
+        }
+
+        std::optional<T> try_pop()
+        {
+            std::scoped_lock lock(mutex_);
+            if (queue_.empty()) {
+                return std::nullopt;
+            }
+            auto value = queue_.front();
+            queue_.pop_front();
+            return value;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::deque<T> queue_;
+    };
+
+    // Producer thread pushes one message at a time, the benchmark thread pops them
+    template<typename Queue>
+    void throughput(benchmark::State& state)
+    {
+        for (auto _ : state) {
+            Queue queue;
+            std::thread producer([&queue]() {
+                for (std::int64_t i = 0; i < messages; ++i) {
+                    while (!queue.try_push(i)) {
+                        wait();
+                    }
+                }
+            });
+            std::int64_t sum = 0;
+            for (std::int64_t received = 0; received < messages;) {
+                if (auto value = queue.try_pop()) {
+                    sum += *value;
+                    ++received;
+                } else {
+                    wait();
+                }
+            }
+            producer.join();
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * messages);
+    }
+
+    // Both sides move messages in batches of state.range(0)
+    void throughput_batched(benchmark::State& state)
+    {
+        const auto batch_size = static_cast<std::size_t>(state.range(0));
+        for (auto _ : state) {
+            orion::spsc_queue<std::int64_t, capacity> queue;
+            std::thread producer([&queue, batch_size]() {
+                std::array<std::int64_t, 64> batch{};
+                for (std::int64_t next = 0; next < messages;) {
+                    const auto count = std::min(batch_size, static_cast<std::size_t>(messages - next));
+                    for (std::size_t i = 0; i < count; ++i) {
+                        batch[i] = next + static_cast<std::int64_t>(i);
+                    }
+                    const auto pushed = queue.try_push_n(batch.begin(), count);
+                    if (pushed == 0) {
+                        wait();
+                    }
+                    next += static_cast<std::int64_t>(pushed);
+                }
+            });
+            std::array<std::int64_t, 64> batch{};
+            std::int64_t sum = 0;
+            for (std::int64_t received = 0; received < messages;) {
+                const auto count = queue.try_pop_n(batch.begin(), batch_size);
+                if (count == 0) {
+                    wait();
+                }
+                for (std::size_t i = 0; i < count; ++i) {
+                    sum += batch[i];
+                }
+                received += static_cast<std::int64_t>(count);
+            }
+            producer.join();
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * messages);
+    }
+
+    // Round trip of one message through a pair of queues, measures latency rather than throughput
+    template<typename Queue>
+    void ping_pong(benchmark::State& state)
+    {
+        constexpr std::int64_t round_trips = 1 << 14;
+        for (auto _ : state) {
+            Queue ping;
+            Queue pong;
+            std::thread echo([&ping, &pong]() {
+                for (std::int64_t i = 0; i < round_trips; ++i) {
+                    std::optional<std::int64_t> value;
+                    while (!(value = ping.try_pop())) {
+                        wait();
+                    }
+                    while (!pong.try_push(*value)) {
+                        wait();
+                    }
+                }
+            });
+            for (std::int64_t i = 0; i < round_trips; ++i) {
+                while (!ping.try_push(i)) {
+                    wait();
+                }
+                while (!pong.try_pop()) {
+                    wait();
+                }
+            }
+            echo.join();
+        }
+        state.SetItemsProcessed(state.iterations() * round_trips);
+    }
+
+    using SpscQueue = orion::spsc_queue<std::int64_t, capacity>;
+
+    BENCHMARK_TEMPLATE(throughput, SpscQueue)->UseRealTime()->Unit(benchmark::kMillisecond);
+    BENCHMARK_TEMPLATE(throughput, LockedQueue<std::int64_t>)->UseRealTime()->Unit(benchmark::kMillisecond);
+    BENCHMARK(throughput_batched)->Arg(8)->Arg(64)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_TEMPLATE(ping_pong, SpscQueue)->UseRealTime();
+    BENCHMARK_TEMPLATE(ping_pong, LockedQueue<std::int64_t>)->UseRealTime();
+} // namespace
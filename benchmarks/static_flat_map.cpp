@@ -0,0 +1,94 @@
+#include "orion-utils/static_flat_map.h"
+
+#include <algorithm> // std::shuffle, std::ranges::lower_bound
+#include <cstdint>   // std::uint32_t
+#include <map>       // std::map
+#include <memory>    // std::make_unique
+#include <random>    // std::mt19937
+#include <vector>    // std::vector
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    constexpr std::size_t capacity = 1 << 16;
+
+    using FlatMap = orion::static_flat_map<std::uint32_t, std::uint32_t, capacity>;
+    using EytzingerMap = orion::eytzinger_flat_map<std::uint32_t, std::uint32_t, capacity>;
+    using Map = std::map<std::uint32_t, std::uint32_t>;
+
+    // From a table that fits in L1 to one that spills out of L2
+    void sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->RangeMultiplier(8)->Range(16, capacity);
+    }
+
+    std::mt19937& engine()
+    {
+        static std::mt19937 engine{42}; // NOLINT(cert-msc32-c, cert-msc51-cpp): deterministic on purpose
+        return engine;
+    }
+
+    // Even keys are in the table, odd keys miss
+    std::vector<std::uint32_t> lookup_keys(std::size_t count)
+    {
+        std::vector<std::uint32_t> keys(4096);
+        std::uniform_int_distribution<std::uint32_t> distribution{0, static_cast<std::uint32_t>(2 * count)};
+        for (auto& key : keys) {
+            key = distribution(engine());
+        }
+        return keys;
+    }
+
+    template<typename Container>
+    void find(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> elements;
+        for (std::uint32_t i = 0; i < count; ++i) {
+            elements.emplace_back(2 * i, i);
+        }
+        std::shuffle(elements.begin(), elements.end(), engine());
+        // Built in one go from unsorted input, too large for the stack at full capacity
+        const auto container = std::make_unique<Container>(elements.begin(), elements.end());
+
+        const auto keys = lookup_keys(count);
+        for (auto _ : state) {
+            std::uint32_t sum = 0;
+            for (auto key : keys) {
+                const auto found = container->find(key);
+                sum += found != container->end() ? found->second : 0;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(keys.size()));
+    }
+
+    // std::lower_bound over the same sorted keys, compiles to a branchy binary search
+    void find_lower_bound(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        std::vector<std::uint32_t> sorted_keys(count);
+        std::vector<std::uint32_t> values(count);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            sorted_keys[i] = 2 * i;
+            values[i] = i;
+        }
+
+        const auto keys = lookup_keys(count);
+        for (auto _ : state) {
+            std::uint32_t sum = 0;
+            for (auto key : keys) {
+                const auto found = std::ranges::lower_bound(sorted_keys, key);
+                sum += found != sorted_keys.end() && *found == key ? values[static_cast<std::size_t>(found - sorted_keys.begin())] : 0;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(keys.size()));
+    }
+
+    BENCHMARK_TEMPLATE(find, FlatMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(find, EytzingerMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(find, Map)->Apply(sizes);
+    BENCHMARK(find_lower_bound)->Apply(sizes);
+} // namespace
@@ -0,0 +1,60 @@
+#include "orion-utils/static_string.h"
+
+#include <cstdint> // std::uint32_t
+#include <string>  // std::string
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h> // fmt::format
+
+namespace
+{
+    // Longer than the small string optimization of every standard library
+    constexpr const char* prefix = "renderer/passes/shadow_cascade";
+
+    void build_std_string(benchmark::State& state)
+    {
+        for (auto _ : state) {
+            std::string key = prefix;
+            key += '/';
+            key += "frustum";
+            benchmark::DoNotOptimize(key.data());
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void build_static_string(benchmark::State& state)
+    {
+        for (auto _ : state) {
+            orion::static_string<64> key = prefix;
+            key += '/';
+            key += "frustum";
+            benchmark::DoNotOptimize(key.data());
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void format_std_string(benchmark::State& state)
+    {
+        std::uint32_t index = 0;
+        for (auto _ : state) {
+            auto key = fmt::format("{}/{}", prefix, index++);
+            benchmark::DoNotOptimize(key.data());
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void format_static_string(benchmark::State& state)
+    {
+        std::uint32_t index = 0;
+        for (auto _ : state) {
+            auto key = orion::format<64>("{}/{}", prefix, index++);
+            benchmark::DoNotOptimize(key.data());
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(build_std_string);
+    BENCHMARK(build_static_string);
+    BENCHMARK(format_std_string);
+    BENCHMARK(format_static_string);
+} // namespace
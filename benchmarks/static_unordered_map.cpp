@@ -0,0 +1,135 @@
+#include "orion-utils/static_unordered_map.h"
+
+#include <concepts>      // std::same_as
+#include <cstdint>       // std::uint64_t
+#include <memory>        // std::make_unique
+#include <random>        // std::mt19937_64
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    constexpr std::size_t capacity = 1 << 14;
+
+    using StaticMap = orion::static_unordered_map<std::uint64_t, std::uint64_t, capacity>;
+    using UnorderedMap = std::unordered_map<std::uint64_t, std::uint64_t>;
+
+    // Fill ratios of the static map, its load factor is at most 7/8 at full capacity
+    void sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->Arg(capacity / 16)->Arg(capacity / 2)->Arg(capacity);
+    }
+
+    std::vector<std::uint64_t> random_keys(std::size_t count, std::uint64_t seed)
+    {
+        std::mt19937_64 engine{seed};
+        std::vector<std::uint64_t> keys(count);
+        for (auto& key : keys) {
+            key = engine();
+        }
+        return keys;
+    }
+
+    template<typename Map>
+    auto make_map(const std::vector<std::uint64_t>& keys)
+    {
+        // The static map is too large for the stack at full capacity
+        auto map = std::make_unique<Map>();
+        if constexpr (std::same_as<Map, UnorderedMap>) {
+            map->reserve(keys.size());
+        }
+        for (auto key : keys) {
+            map->try_emplace(key, key);
+        }
+        return map;
+    }
+
+    template<typename Map>
+    void find_hit(benchmark::State& state)
+    {
+        const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 1);
+        const auto map = make_map<Map>(keys);
+        for (auto _ : state) {
+            std::uint64_t sum = 0;
+            for (auto key : keys) {
+                sum += map->find(key)->second;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(keys.size()));
+    }
+
+    template<typename Map>
+    void find_miss(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto map = make_map<Map>(random_keys(count, 1));
+        const auto missing = random_keys(count, 2);
+        for (auto _ : state) {
+            std::size_t found = 0;
+            for (auto key : missing) {
+                found += map->count(key);
+            }
+            benchmark::DoNotOptimize(found);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+    // Inserts every key into an empty map
+    template<typename Map>
+    void insert(benchmark::State& state)
+    {
+        const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 1);
+        auto map = std::make_unique<Map>();
+        for (auto _ : state) {
+            map->clear();
+            for (auto key : keys) {
+                map->try_emplace(key, key);
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(keys.size()));
+    }
+
+    template<typename Map>
+    void insert_existing(benchmark::State& state)
+    {
+        const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 1);
+        const auto map = make_map<Map>(keys);
+        for (auto _ : state) {
+            for (auto key : keys) {
+                benchmark::DoNotOptimize(map->try_emplace(key, key).second);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(keys.size()));
+    }
+
+    // Erase then re-insert every key, exercises backward shift deletion
+    template<typename Map>
+    void churn(benchmark::State& state)
+    {
+        const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 1);
+        const auto map = make_map<Map>(keys);
+        for (auto _ : state) {
+            for (auto key : keys) {
+                map->erase(key);
+                map->try_emplace(key, key);
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(keys.size()));
+    }
+
+    BENCHMARK_TEMPLATE(find_hit, StaticMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(find_hit, UnorderedMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(find_miss, StaticMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(find_miss, UnorderedMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(insert, StaticMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(insert, UnorderedMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(insert_existing, StaticMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(insert_existing, UnorderedMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(churn, StaticMap)->Apply(sizes);
+    BENCHMARK_TEMPLATE(churn, UnorderedMap)->Apply(sizes);
+} // namespace
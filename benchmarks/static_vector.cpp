@@ -0,0 +1,323 @@
+#include "orion-utils/static_vector.h"
+
+#include "types.h"
+
+#include <algorithm>   // std::find_if
+#include <array>       // std::array
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    using namespace orion::benchmarks;
+
+    constexpr std::size_t capacity = 1024;
+
+    template<typename T>
+    using StaticVector = orion::static_vector<T, capacity>;
+    template<typename T>
+    using Vector = std::vector<T>;
+    template<typename T>
+    using Array = std::array<T, capacity>;
+
+    template<typename Container>
+    constexpr bool is_array = false;
+    template<typename T>
+    constexpr bool is_array<std::array<T, capacity>> = true;
+
+    // std::vector gets its capacity up front so only element operations are measured
+    template<typename Container>
+    Container make_container()
+    {
+        Container container{};
+        if constexpr (requires { container.reserve(capacity); }) {
+            container.reserve(capacity);
+        }
+        return container;
+    }
+
+    template<typename Container>
+    Container make_filled(std::size_t count)
+    {
+        using value_type = typename Container::value_type;
+        const auto values = make_values<value_type>(count);
+        auto container = make_container<Container>();
+        if constexpr (is_array<Container>) {
+            std::copy(values.begin(), values.end(), container.begin());
+        } else {
+            container.insert(container.end(), values.begin(), values.end());
+        }
+        return container;
+    }
+
+    void sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->RangeMultiplier(4)->Range(16, capacity);
+    }
+
+    template<typename Container>
+    void push_back(benchmark::State& state)
+    {
+        using value_type = typename Container::value_type;
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto values = make_values<value_type>(count);
+        auto container = make_container<Container>();
+        for (auto _ : state) {
+            if constexpr (is_array<Container>) {
+                for (std::size_t i = 0; i < count; ++i) {
+                    container[i] = values[i];
+                }
+            } else {
+                container.clear();
+                for (const auto& value : values) {
+                    container.push_back(value);
+                }
+            }
+            benchmark::DoNotOptimize(container.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+    template<typename Container>
+    void emplace_back(benchmark::State& state)
+    {
+        using value_type = typename Container::value_type;
+        const auto count = static_cast<int>(state.range(0));
+        auto container = make_container<Container>();
+        for (auto _ : state) {
+            if constexpr (is_array<Container>) {
+                for (int i = 0; i < count; ++i) {
+                    container[static_cast<std::size_t>(i)] = value_type(i);
+                }
+            } else {
+                container.clear();
+                for (int i = 0; i < count; ++i) {
+                    container.emplace_back(i);
+                }
+            }
+            benchmark::DoNotOptimize(container.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    // Inserts every element in the middle of the container, shifting half of the tail each time
+    template<typename Container>
+    void insert_middle(benchmark::State& state)
+    {
+        using value_type = typename Container::value_type;
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto values = make_values<value_type>(count);
+        auto container = make_container<Container>();
+        for (auto _ : state) {
+            container.clear();
+            for (const auto& value : values) {
+                container.insert(container.begin() + static_cast<std::ptrdiff_t>(container.size() / 2), value);
+            }
+            benchmark::DoNotOptimize(container.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+    // Erases every element from the front of the container, shifting the whole tail each time
+    template<typename Container>
+    void erase_front(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto source = make_filled<Container>(count);
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto container = make_container<Container>();
+            container = source;
+            state.ResumeTiming();
+            while (!container.empty()) {
+                container.erase(container.begin());
+            }
+            benchmark::DoNotOptimize(container.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+    // Per-frame culling, every benchmark removes the same elements (about a quarter of them)
+    bool culled(const Trivial& element) { return element.value % 4 == 0; }
+    bool culled(const Relocatable& element) { return element.value % 4 == 0; }
+    bool culled(const NonTrivial& element) { return element.value.size() % 4 == 0; }
+
+    template<typename Container, typename Cull>
+    void cull(benchmark::State& state, Cull&& cull)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto source = make_filled<Container>(count);
+        for (auto _ : state) {
+            state.PauseTiming();
+            auto container = source;
+            state.ResumeTiming();
+            cull(container);
+            benchmark::DoNotOptimize(container.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+    // Erases culled elements one at a time, shifting the tail for each of them
+    template<typename Container>
+    void cull_erase(benchmark::State& state)
+    {
+        cull<Container>(state, [](Container& container) {
+            for (auto iter = container.begin(); iter != container.end();) {
+                iter = culled(*iter) ? container.erase(iter) : iter + 1;
+            }
+        });
+    }
+
+    template<typename Container>
+    void cull_erase_if(benchmark::State& state)
+    {
+        cull<Container>(state, [](Container& container) {
+            orion::erase_if(container, [](const auto& element) { return culled(element); });
+        });
+    }
+
+    // Indices are collected up front, like a visibility pass that already knows what it rejected
+    template<typename Container>
+    void cull_remove_indices(benchmark::State& state)
+    {
+        const auto source = make_filled<Container>(static_cast<std::size_t>(state.range(0)));
+        std::vector<std::size_t> indices;
+        for (std::size_t i = 0; i < source.size(); ++i) {
+            if (culled(source[static_cast<typename Container::size_type>(i)])) {
+                indices.push_back(i);
+            }
+        }
+        cull<Container>(state, [&indices](Container& container) { container.remove_indices(indices); });
+    }
+
+    // Doesn't keep the order of the remaining elements
+    template<typename Container>
+    void cull_erase_unordered(benchmark::State& state)
+    {
+        cull<Container>(state, [](Container& container) {
+            for (auto iter = container.begin(); iter != container.end();) {
+                iter = culled(*iter) ? container.erase_unordered(iter) : iter + 1;
+            }
+        });
+    }
+
+    // std::array always copies the full capacity, which is the cost static_vector avoids
+    template<typename Container>
+    void copy(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto source = make_filled<Container>(count);
+        for (auto _ : state) {
+            Container copy(source);
+            benchmark::DoNotOptimize(copy.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+    }
+
+    // Moves back and forth so every iteration starts from a live container (one move ctor, one move assignment)
+    template<typename Container>
+    void move(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        auto source = make_filled<Container>(count);
+        for (auto _ : state) {
+            Container moved(std::move(source));
+            benchmark::DoNotOptimize(moved.data());
+            source = std::move(moved);
+            benchmark::DoNotOptimize(source.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count) * 2);
+    }
+
+    struct Keyword {
+        std::string_view name;
+        int token = -1;
+    };
+
+    constexpr std::array<std::string_view, 32> keyword_names{
+        "alignas", "alignof", "asm", "auto", "bool", "break", "case", "catch",
+        "char", "class", "const", "constexpr", "continue", "decltype", "default", "delete",
+        "do", "double", "else", "enum", "explicit", "export", "extern", "false",
+        "float", "for", "friend", "goto", "if", "inline", "int", "long"};
+
+    // Sorted by insertion, fed in reverse so every element shifts the whole table
+    constexpr auto build_keywords = []() {
+        orion::static_vector<Keyword, keyword_names.size()> keywords;
+        for (auto name = keyword_names.rbegin(); name != keyword_names.rend(); ++name) {
+            const auto position = std::find_if(keywords.begin(), keywords.end(), [name](const Keyword& keyword) { return keyword.name > *name; });
+            keywords.insert(position, Keyword{*name, static_cast<int>(keyword_names.rend() - name)});
+        }
+        return keywords;
+    };
+
+    // Startup cost of a lookup table built when the program starts, versus one embedded in the binary
+    void keyword_table_runtime(benchmark::State& state)
+    {
+        for (auto _ : state) {
+            const auto table = build_keywords();
+            benchmark::DoNotOptimize(table.data());
+        }
+    }
+
+    void keyword_table_constexpr(benchmark::State& state)
+    {
+        for (auto _ : state) {
+            static constexpr auto table = orion::fit_static_vector<build_keywords>();
+            benchmark::DoNotOptimize(table.data());
+        }
+    }
+
+#define ORION_BENCHMARK_RESIZABLE(function, type)                \
+    BENCHMARK_TEMPLATE(function, StaticVector<type>)->Apply(sizes); \
+    BENCHMARK_TEMPLATE(function, Vector<type>)->Apply(sizes)
+
+#define ORION_BENCHMARK_ALL(function, type)   \
+    ORION_BENCHMARK_RESIZABLE(function, type); \
+    BENCHMARK_TEMPLATE(function, Array<type>)->Apply(sizes)
+
+    ORION_BENCHMARK_ALL(push_back, Trivial);
+    ORION_BENCHMARK_ALL(push_back, Relocatable);
+    ORION_BENCHMARK_ALL(push_back, NonTrivial);
+
+    ORION_BENCHMARK_ALL(emplace_back, Trivial);
+    ORION_BENCHMARK_ALL(emplace_back, Relocatable);
+    ORION_BENCHMARK_ALL(emplace_back, NonTrivial);
+
+    ORION_BENCHMARK_RESIZABLE(insert_middle, Trivial);
+    ORION_BENCHMARK_RESIZABLE(insert_middle, Relocatable);
+    ORION_BENCHMARK_RESIZABLE(insert_middle, NonTrivial);
+
+    ORION_BENCHMARK_RESIZABLE(erase_front, Trivial);
+    ORION_BENCHMARK_RESIZABLE(erase_front, Relocatable);
+    ORION_BENCHMARK_RESIZABLE(erase_front, NonTrivial);
+
+#define ORION_BENCHMARK_CULL(type)                                               \
+    BENCHMARK_TEMPLATE(cull_erase, StaticVector<type>)->Apply(sizes);          \
+    BENCHMARK_TEMPLATE(cull_erase_if, StaticVector<type>)->Apply(sizes);       \
+    BENCHMARK_TEMPLATE(cull_remove_indices, StaticVector<type>)->Apply(sizes); \
+    BENCHMARK_TEMPLATE(cull_erase_unordered, StaticVector<type>)->Apply(sizes)
+
+    ORION_BENCHMARK_CULL(Trivial);
+    ORION_BENCHMARK_CULL(Relocatable);
+    ORION_BENCHMARK_CULL(NonTrivial);
+
+    ORION_BENCHMARK_ALL(copy, Trivial);
+    ORION_BENCHMARK_ALL(copy, Relocatable);
+    ORION_BENCHMARK_ALL(copy, NonTrivial);
+
+    ORION_BENCHMARK_ALL(move, Trivial);
+    ORION_BENCHMARK_ALL(move, Relocatable);
+    ORION_BENCHMARK_ALL(move, NonTrivial);
+
+    BENCHMARK(keyword_table_runtime);
+    BENCHMARK(keyword_table_constexpr);
+} // namespace
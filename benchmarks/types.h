@@ -0,0 +1,78 @@
+#pragma once
+
+#include "orion-utils/uninitialized.h" // orion::is_trivially_relocatable
+
+#include <cstddef> // std::size_t
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+namespace orion::benchmarks
+{
+    // Trivially copyable, the best case for every container
+    struct Trivial {
+        Trivial() = default;
+        explicit Trivial(int val)
+            : value(val)
+        {
+        }
+
+        int value;
+    };
+
+    // User-provided special members make this non-trivial to the compiler,
+    // but the object can be safely relocated with a memcpy
+    struct Relocatable {
+        Relocatable() = default;
+        explicit Relocatable(int val)
+            : value(val)
+        {
+        }
+        Relocatable(const Relocatable& other) noexcept
+            : value(other.value)
+        {
+        }
+        Relocatable(Relocatable&& other) noexcept
+            : value(other.value)
+        {
+        }
+        Relocatable& operator=(const Relocatable& other) noexcept
+        {
+            value = other.value;
+            return *this;
+        }
+        Relocatable& operator=(Relocatable&& other) noexcept
+        {
+            value = other.value;
+            return *this;
+        }
+        ~Relocatable() {} // NOLINT(modernize-use-equals-default): must stay user-provided
+
+        int value = 0;
+    };
+
+    // Owns a (small) string, copies and moves have to run real code
+    struct NonTrivial {
+        NonTrivial() = default;
+        explicit NonTrivial(int val)
+            : value(static_cast<std::size_t>(val % 15) + 1, 'x')
+        {
+        }
+
+        std::string value;
+    };
+
+    template<typename T>
+    std::vector<T> make_values(std::size_t count)
+    {
+        std::vector<T> values;
+        values.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            values.emplace_back(static_cast<int>(i));
+        }
+        return values;
+    }
+} // namespace orion::benchmarks
+
+template<>
+struct orion::is_trivially_relocatable<orion::benchmarks::Relocatable> : std::true_type {
+};
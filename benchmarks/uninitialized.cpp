@@ -0,0 +1,94 @@
+#include "orion-utils/uninitialized.h"
+
+#include "types.h"
+
+#include <memory> // std::uninitialized_*, std::destroy_n
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    using namespace orion::benchmarks;
+
+    constexpr std::size_t capacity = 4096;
+
+    void sizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->RangeMultiplier(8)->Range(8, capacity);
+    }
+
+    struct Orion {
+        template<typename InputIt, typename ForwardIt>
+        static void copy(InputIt first, InputIt last, ForwardIt out) { orion::uninitialized_copy(first, last, out); }
+        template<typename InputIt, typename ForwardIt>
+        static void move(InputIt first, InputIt last, ForwardIt out) { orion::uninitialized_move(first, last, out); }
+        template<typename ForwardIt, typename T>
+        static void fill(ForwardIt first, ForwardIt last, const T& value) { orion::uninitialized_fill(first, last, value); }
+    };
+
+    struct Std {
+        template<typename InputIt, typename ForwardIt>
+        static void copy(InputIt first, InputIt last, ForwardIt out) { std::uninitialized_copy(first, last, out); }
+        template<typename InputIt, typename ForwardIt>
+        static void move(InputIt first, InputIt last, ForwardIt out) { std::uninitialized_move(first, last, out); }
+        template<typename ForwardIt, typename T>
+        static void fill(ForwardIt first, ForwardIt last, const T& value) { std::uninitialized_fill(first, last, value); }
+    };
+
+    template<typename Impl, typename T>
+    void uninitialized_copy(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto values = make_values<T>(count);
+        orion::UninitializedStorage<T, capacity> storage;
+        for (auto _ : state) {
+            Impl::copy(values.begin(), values.end(), storage.data());
+            benchmark::DoNotOptimize(storage.data());
+            benchmark::ClobberMemory();
+            std::destroy_n(storage.data(), count);
+        }
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(count * sizeof(T)));
+    }
+
+    template<typename Impl, typename T>
+    void uninitialized_move(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        auto values = make_values<T>(count);
+        orion::UninitializedStorage<T, capacity> storage;
+        for (auto _ : state) {
+            Impl::move(values.begin(), values.end(), storage.data());
+            benchmark::DoNotOptimize(storage.data());
+            benchmark::ClobberMemory();
+            std::destroy_n(storage.data(), count);
+        }
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(count * sizeof(T)));
+    }
+
+    template<typename Impl, typename T>
+    void uninitialized_fill(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto value = T(7);
+        orion::UninitializedStorage<T, capacity> storage;
+        for (auto _ : state) {
+            Impl::fill(storage.data(), storage.data() + count, value);
+            benchmark::DoNotOptimize(storage.data());
+            benchmark::ClobberMemory();
+            std::destroy_n(storage.data(), count);
+        }
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(count * sizeof(T)));
+    }
+
+#define ORION_BENCHMARK_UNINITIALIZED(function)                       \
+    BENCHMARK_TEMPLATE(function, Orion, Trivial)->Apply(sizes);     \
+    BENCHMARK_TEMPLATE(function, Std, Trivial)->Apply(sizes);       \
+    BENCHMARK_TEMPLATE(function, Orion, Relocatable)->Apply(sizes); \
+    BENCHMARK_TEMPLATE(function, Std, Relocatable)->Apply(sizes);   \
+    BENCHMARK_TEMPLATE(function, Orion, NonTrivial)->Apply(sizes);  \
+    BENCHMARK_TEMPLATE(function, Std, NonTrivial)->Apply(sizes)
+
+    ORION_BENCHMARK_UNINITIALIZED(uninitialized_copy);
+    ORION_BENCHMARK_UNINITIALIZED(uninitialized_move);
+    ORION_BENCHMARK_UNINITIALIZED(uninitialized_fill);
+} // namespace
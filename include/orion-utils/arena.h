@@ -0,0 +1,255 @@
+#pragma once
+
+#include "orion-utils/assertion.h"     // ORION_ASSERT
+#include "orion-utils/uninitialized.h" // orion::UninitializedStorage
+
+#include <algorithm>       // std::max
+#include <cstddef>         // std::byte, std::size_t, std::max_align_t
+#include <cstdint>         // std::uintptr_t
+#include <limits>          // std::numeric_limits
+#include <memory>          // std::construct_at
+#include <memory_resource> // std::pmr::memory_resource
+#include <new>             // std::bad_alloc
+#include <span>            // std::span
+#include <utility>         // std::exchange
+
+namespace orion
+{
+    namespace detail
+    {
+        // Header placed at the start of every block the arena gets from its upstream resource
+        struct ArenaChunk {
+            ArenaChunk* next;
+            std::size_t size; // Total size of the block, including this header
+        };
+
+        // Bytes to skip from ptr to reach the next address aligned to alignment (a power of two)
+        inline std::size_t align_padding(const std::byte* ptr, std::size_t alignment) noexcept
+        {
+            return (alignment - (reinterpret_cast<std::uintptr_t>(ptr) & (alignment - 1))) & (alignment - 1);
+        }
+    } // namespace detail
+
+    // Bump pointer allocator for short-lived allocations. Memory is handed out from a caller provided
+    // buffer first, then from chunks requested from an upstream resource. Individual deallocations are
+    // no-ops (except for the most recent allocation), memory is reclaimed in bulk with rewind() or reset().
+    // Not thread-safe, use one arena per thread
+    class Arena : public std::pmr::memory_resource
+    {
+    public:
+        static constexpr std::size_t default_chunk_size = 64 * 1024;
+
+        // Opaque position in the arena, everything allocated after it is freed by rewind()
+        struct Marker {
+            detail::ArenaChunk* chunk;
+            std::byte* cursor;
+        };
+
+        explicit Arena(std::size_t chunk_size = default_chunk_size,
+                       std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept
+            : upstream_(upstream)
+            , chunk_size_(chunk_size)
+        {
+            ORION_ASSERT(upstream_ != nullptr);
+        }
+
+        // Allocates from buffer until it is exhausted. Pass std::pmr::null_memory_resource() as upstream
+        // to make running out of buffer throw std::bad_alloc instead of falling back to the heap
+        explicit Arena(std::span<std::byte> buffer,
+                       std::pmr::memory_resource* upstream = std::pmr::get_default_resource(),
+                       std::size_t chunk_size = default_chunk_size) noexcept
+            : upstream_(upstream)
+            , buffer_(buffer)
+            , cursor_(buffer.data())
+            , end_(buffer.data() + buffer.size())
+            , chunk_size_(chunk_size)
+        {
+            ORION_ASSERT(upstream_ != nullptr);
+        }
+
+        Arena(const Arena&) = delete;
+        Arena(Arena&&) = delete;
+        Arena& operator=(const Arena&) = delete;
+        Arena& operator=(Arena&&) = delete;
+
+        ~Arena() override
+        {
+            release();
+        }
+
+        [[nodiscard]] Marker mark() const noexcept { return {current_, cursor_}; }
+
+        // Frees everything allocated since marker was taken. Chunks are kept for reuse
+        void rewind(Marker marker) noexcept
+        {
+            current_ = marker.chunk;
+            cursor_ = marker.cursor;
+            end_ = current_ != nullptr ? chunk_end(current_) : buffer_.data() + buffer_.size();
+        }
+
+        // Frees every allocation, keeping the chunks for reuse
+        void reset() noexcept
+        {
+            rewind({nullptr, buffer_.data()});
+        }
+
+        // Frees every allocation and returns all chunks to the upstream resource
+        void release() noexcept
+        {
+            while (head_ != nullptr) {
+                auto* chunk = std::exchange(head_, head_->next);
+                upstream_->deallocate(chunk, chunk->size, alignof(std::max_align_t));
+            }
+            reset();
+        }
+
+        [[nodiscard]] std::pmr::memory_resource* upstream_resource() const noexcept { return upstream_; }
+        [[nodiscard]] std::size_t chunk_size() const noexcept { return chunk_size_; }
+
+    private:
+        static constexpr std::size_t header_size = (sizeof(detail::ArenaChunk) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+        static std::byte* chunk_begin(detail::ArenaChunk* chunk) noexcept
+        {
+            return reinterpret_cast<std::byte*>(chunk) + header_size;
+        }
+        static std::byte* chunk_end(detail::ArenaChunk* chunk) noexcept
+        {
+            return reinterpret_cast<std::byte*>(chunk) + chunk->size;
+        }
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            ORION_ASSERT((alignment & (alignment - 1)) == 0);
+            const auto padding = detail::align_padding(cursor_, alignment);
+            // Compared against the room left after padding, padding + bytes wraps around for huge requests
+            const auto room = static_cast<std::size_t>(end_ - cursor_);
+            if (cursor_ == nullptr || padding > room || bytes > room - padding) [[unlikely]] {
+                auto* ptr = next_chunk(bytes, alignment);
+                cursor_ = ptr + bytes;
+                return ptr;
+            }
+            auto* ptr = cursor_ + padding;
+            cursor_ = ptr + bytes;
+            return ptr;
+        }
+
+        void do_deallocate(void* ptr, std::size_t bytes, [[maybe_unused]] std::size_t alignment) override
+        {
+            // Give back the most recent allocation, which makes stack-like usage free
+            if (static_cast<std::byte*>(ptr) + bytes == cursor_) {
+                cursor_ = static_cast<std::byte*>(ptr);
+            }
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        // Moves on to the next chunk with room for the allocation, reusing chunks kept by rewind()
+        std::byte* next_chunk(std::size_t bytes, std::size_t alignment)
+        {
+            const auto extra = alignment > alignof(std::max_align_t) ? alignment : 0;
+            if (bytes > std::numeric_limits<std::size_t>::max() - extra) {
+                throw std::bad_alloc();
+            }
+            const auto required = bytes + extra;
+            auto* next = current_ != nullptr ? current_->next : head_;
+            while (next != nullptr && static_cast<std::size_t>(chunk_end(next) - chunk_begin(next)) < required) {
+                next = next->next;
+            }
+            if (next == nullptr) {
+                next = allocate_chunk(required);
+            }
+            current_ = next;
+            end_ = chunk_end(next);
+            auto* begin = chunk_begin(next);
+            return begin + detail::align_padding(begin, alignment);
+        }
+
+        detail::ArenaChunk* allocate_chunk(std::size_t required)
+        {
+            if (required > std::numeric_limits<std::size_t>::max() - header_size) {
+                throw std::bad_alloc();
+            }
+            const auto size = std::max(chunk_size_, header_size + required);
+            void* memory = upstream_->allocate(size, alignof(std::max_align_t));
+            // Insert after the current chunk so chunks kept for reuse stay reachable
+            auto*& link = current_ != nullptr ? current_->next : head_;
+            link = std::construct_at(static_cast<detail::ArenaChunk*>(memory), detail::ArenaChunk{.next = link, .size = size});
+            return link;
+        }
+
+        std::pmr::memory_resource* upstream_;
+        std::span<std::byte> buffer_;
+        detail::ArenaChunk* head_ = nullptr;    // First chunk from upstream, used after buffer_
+        detail::ArenaChunk* current_ = nullptr; // nullptr while allocating from buffer_
+        std::byte* cursor_ = nullptr;
+        std::byte* end_ = nullptr;
+        std::size_t chunk_size_;
+    };
+
+    namespace detail
+    {
+        // Base-from-member, so the storage exists before the Arena base points into it
+        template<std::size_t Size>
+        struct FixedArenaStorage {
+            alignas(std::max_align_t) UninitializedStorage<std::byte, Size> storage;
+        };
+    } // namespace detail
+
+    // Arena with Size bytes of inline storage that never touches the heap, allocating past the end throws std::bad_alloc
+    template<std::size_t Size>
+    class FixedArena
+        : private detail::FixedArenaStorage<Size>
+        , public Arena
+    {
+    public:
+        FixedArena() noexcept
+            : Arena(std::span<std::byte>(this->storage.data(), Size), std::pmr::null_memory_resource())
+        {
+        }
+    };
+
+    // Allocator adapter so containers that take an Allocator type (e.g. orion::small_vector) can use an Arena
+    template<typename T>
+    class ArenaAllocator
+    {
+    public:
+        using value_type = T;
+
+        ArenaAllocator(Arena& arena) noexcept
+            : arena_(&arena)
+        {
+        }
+        template<typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+            : arena_(other.arena())
+        {
+        }
+
+        [[nodiscard]] T* allocate(std::size_t n)
+        {
+            if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+                throw std::bad_array_new_length();
+            }
+            return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+        }
+        void deallocate(T* ptr, std::size_t n) noexcept
+        {
+            arena_->deallocate(ptr, n * sizeof(T), alignof(T));
+        }
+
+        [[nodiscard]] Arena* arena() const noexcept { return arena_; }
+
+        template<typename U>
+        [[nodiscard]] bool operator==(const ArenaAllocator<U>& other) const noexcept
+        {
+            return arena_ == other.arena();
+        }
+
+    private:
+        Arena* arena_;
+    };
+} // namespace orion
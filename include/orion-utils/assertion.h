@@ -1,28 +1,109 @@
 #pragma once
 
-#include <cstdio>       // std::puts
+#include <atomic>       // std::atomic
+#include <cstdio>       // stderr, std::fflush
 #include <cstdlib>      // std::abort
-#include <fmt/format.h> // fmt::format
-
-#if !defined(NDEBUG) || !defined(ORION_ENABLE_ASSERTIONS)
-    #define ORION_ASSERT(condition)                                                                                          \
-        do {                                                                                                                 \
-            if (!(condition)) {                                                                                              \
-                std::puts(fmt::format("Assertion failed ({}:{} {}): {}", __FILE__, __LINE__, __func__, #condition).c_str()); \
-                std::abort();                                                                                                \
-            }                                                                                                                \
-        } while (0)
-#else
-    #define ORION_ASSERT(condition) ((void)0)
+#include <fmt/format.h> // fmt::format_string, fmt::memory_buffer
+#include <iterator>     // std::back_inserter
+#include <string_view>  // std::string_view
+#include <utility>      // std::forward
+
+// Assertion levels, a check is compiled in when its level is at most ORION_ASSERTION_LEVEL:
+//  0: only ORION_ASSERT_ALWAYS, ORION_EXPECTS and ORION_ENSURES
+//  1: also ORION_ASSERT, the default unless NDEBUG is defined without ORION_ENABLE_ASSERTIONS
+//  2: also ORION_ASSERT_AUDIT, for checks too expensive for regular debug builds
+#ifndef ORION_ASSERTION_LEVEL
+    #if !defined(NDEBUG) || defined(ORION_ENABLE_ASSERTIONS)
+        #define ORION_ASSERTION_LEVEL 1
+    #else
+        #define ORION_ASSERTION_LEVEL 0
+    #endif
 #endif
 
-#define ORION_CONDITION_CHECK(type, condition)                                                                       \
-    do {                                                                                                             \
-        if (!(condition)) [[unlikely]] {                                                                             \
-            std::puts(fmt::format(type " failed ({}:{} {}): {}", __FILE__, __LINE__, __func__, #condition).c_str()); \
-            std::abort();                                                                                            \
-        }                                                                                                            \
+namespace orion
+{
+    // Static description of a check, one per call site placed in read-only data so the hot path only
+    // passes its address
+    struct AssertionInfo {
+        const char* kind;
+        const char* condition;
+        const char* file;
+        int line;
+    };
+
+    // Called with the failed check, the enclosing function and the formatted message (empty when the
+    // check has none). The program aborts when the handler returns, it may throw instead
+    using AssertionHandler = void (*)(const AssertionInfo& info, const char* function, std::string_view message);
+
+    namespace detail
+    {
+        inline void default_assertion_handler(const AssertionInfo& info, const char* function, std::string_view message)
+        {
+            fmt::print(stderr, "{} failed ({}:{} {}): {}", info.kind, info.file, info.line, function, info.condition);
+            if (!message.empty()) {
+                fmt::print(stderr, ": {}", message);
+            }
+            fmt::print(stderr, "\n");
+            std::fflush(stderr);
+        }
+
+        inline std::atomic<AssertionHandler> assertion_handler = &default_assertion_handler;
+
+        [[noreturn]] inline void report_assertion(const AssertionInfo& info, const char* function, std::string_view message)
+        {
+            assertion_handler.load(std::memory_order_acquire)(info, function, message);
+            std::abort();
+        }
+
+        // Out of line and marked cold so a check costs its call sites a compare, a branch and a call
+        [[noreturn, gnu::cold, gnu::noinline]] inline void assertion_failed(const AssertionInfo& info, const char* function)
+        {
+            report_assertion(info, function, {});
+        }
+
+        template<typename... Args>
+        [[noreturn, gnu::cold, gnu::noinline]] void assertion_failed(const AssertionInfo& info, const char* function, fmt::format_string<Args...> format, Args&&... args)
+        {
+            fmt::memory_buffer message;
+            fmt::format_to(std::back_inserter(message), format, std::forward<Args>(args)...);
+            report_assertion(info, function, {message.data(), message.size()});
+        }
+    } // namespace detail
+
+    // Installs the handler for failed checks and returns the previous one, nullptr restores the default
+    inline AssertionHandler set_assertion_handler(AssertionHandler handler) noexcept
+    {
+        return detail::assertion_handler.exchange(handler != nullptr ? handler : &detail::default_assertion_handler, std::memory_order_acq_rel);
+    }
+} // namespace orion
+
+// The record is a static inside a lambda since constexpr functions can't declare statics in C++20.
+// Message arguments are only evaluated when the check fails
+#define ORION_CONDITION_CHECK(type, condition, ...)                                                     \
+    do {                                                                                                \
+        if (!(condition)) [[unlikely]] {                                                                \
+            ::orion::detail::assertion_failed(                                                          \
+                []() -> const ::orion::AssertionInfo& {                                                 \
+                    static constexpr ::orion::AssertionInfo info{type, #condition, __FILE__, __LINE__}; \
+                    return info;                                                                        \
+                }(),                                                                                    \
+                __func__ __VA_OPT__(, ) __VA_ARGS__);                                                   \
+        }                                                                                               \
     } while (0)
 
-#define ORION_EXPECTS(condition) ORION_CONDITION_CHECK("Pre-condition", condition)
-#define ORION_ENSURES(condition) ORION_CONDITION_CHECK("Post-condition", condition)
+#define ORION_ASSERT_ALWAYS(condition, ...) ORION_CONDITION_CHECK("Assertion", condition __VA_OPT__(, ) __VA_ARGS__)
+
+#if ORION_ASSERTION_LEVEL >= 1
+    #define ORION_ASSERT(condition, ...) ORION_CONDITION_CHECK("Assertion", condition __VA_OPT__(, ) __VA_ARGS__)
+#else
+    #define ORION_ASSERT(condition, ...) ((void)0)
+#endif
+
+#if ORION_ASSERTION_LEVEL >= 2
+    #define ORION_ASSERT_AUDIT(condition, ...) ORION_CONDITION_CHECK("Audit assertion", condition __VA_OPT__(, ) __VA_ARGS__)
+#else
+    #define ORION_ASSERT_AUDIT(condition, ...) ((void)0)
+#endif
+
+#define ORION_EXPECTS(condition, ...) ORION_CONDITION_CHECK("Pre-condition", condition __VA_OPT__(, ) __VA_ARGS__)
+#define ORION_ENSURES(condition, ...) ORION_CONDITION_CHECK("Post-condition", condition __VA_OPT__(, ) __VA_ARGS__)
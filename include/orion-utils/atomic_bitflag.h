@@ -0,0 +1,143 @@
+#pragma once
+
+#include "orion-utils/bitflag.h" // orion::Bitflag
+#include "orion-utils/type.h"    // orion::to_underlying
+
+#include <atomic>      // std::atomic, std::memory_order
+#include <type_traits> // std::underlying_type_t
+
+namespace orion
+{
+    // Bitflag shared between threads, e.g. resource states (dirty, uploading, resident) set by one thread and
+    // observed by others. Every read-modify-write is a single atomic instruction on the whole mask, so
+    // concurrent updates of different bits never lose each other. The values read and written are plain
+    // Bitflag, all the mask queries stay on that type.
+    //
+    // Memory orders default to seq_cst like std::atomic, pass a weaker order where the flags don't publish data
+    template<typename Enum>
+    class AtomicBitflag
+    {
+    public:
+        using flags_type = Bitflag<Enum>;
+        using enum_type = Enum;
+        using underlying_type = std::underlying_type_t<enum_type>;
+
+        static constexpr bool is_always_lock_free = std::atomic<underlying_type>::is_always_lock_free;
+
+        constexpr AtomicBitflag() noexcept = default;
+        constexpr AtomicBitflag(flags_type flags) noexcept
+            : value_(flags.value())
+        {
+        }
+
+        AtomicBitflag(const AtomicBitflag&) = delete;
+        AtomicBitflag& operator=(const AtomicBitflag&) = delete;
+
+        [[nodiscard]] flags_type load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+        {
+            return flags_type{value_.load(order)};
+        }
+        void store(flags_type flags, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            value_.store(flags.value(), order);
+        }
+        flags_type exchange(flags_type flags, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return flags_type{value_.exchange(flags.value(), order)};
+        }
+
+        // Replace the whole mask if it still equals expected, otherwise expected receives the current mask
+        bool compare_exchange_weak(flags_type& expected, flags_type desired, std::memory_order success, std::memory_order failure) noexcept
+        {
+            auto value = expected.value();
+            const bool exchanged = value_.compare_exchange_weak(value, desired.value(), success, failure);
+            expected = flags_type{value};
+            return exchanged;
+        }
+        bool compare_exchange_weak(flags_type& expected, flags_type desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            auto value = expected.value();
+            const bool exchanged = value_.compare_exchange_weak(value, desired.value(), order);
+            expected = flags_type{value};
+            return exchanged;
+        }
+        bool compare_exchange_strong(flags_type& expected, flags_type desired, std::memory_order success, std::memory_order failure) noexcept
+        {
+            auto value = expected.value();
+            const bool exchanged = value_.compare_exchange_strong(value, desired.value(), success, failure);
+            expected = flags_type{value};
+            return exchanged;
+        }
+        bool compare_exchange_strong(flags_type& expected, flags_type desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            auto value = expected.value();
+            const bool exchanged = value_.compare_exchange_strong(value, desired.value(), order);
+            expected = flags_type{value};
+            return exchanged;
+        }
+
+        // Read-modify-write of the bits in mask, returning the flags from before the update
+        flags_type fetch_set(flags_type mask, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return flags_type{value_.fetch_or(mask.value(), order)};
+        }
+        flags_type fetch_clear(flags_type mask, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return flags_type{value_.fetch_and((~mask).value(), order)};
+        }
+        flags_type fetch_toggle(flags_type mask, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return flags_type{value_.fetch_xor(mask.value(), order)};
+        }
+
+        // Single bit operations returning the previous state of the bit. Testing the one bit of the fetched
+        // value lets the compiler emit lock bts/btr/btc on x86 instead of a compare-exchange loop
+        [[nodiscard]] bool test(enum_type bit, std::memory_order order = std::memory_order_seq_cst) const noexcept
+        {
+            return (value_.load(order) & bit_value(bit)) != 0;
+        }
+        bool test_and_set(enum_type bit, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return (value_.fetch_or(bit_value(bit), order) & bit_value(bit)) != 0;
+        }
+        bool test_and_clear(enum_type bit, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return (value_.fetch_and(static_cast<underlying_type>(~bit_value(bit)), order) & bit_value(bit)) != 0;
+        }
+        bool test_and_toggle(enum_type bit, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            return (value_.fetch_xor(bit_value(bit), order) & bit_value(bit)) != 0;
+        }
+
+        // Blocks while the flags equal old, woken up by notify_one() or notify_all(). See std::atomic::wait
+        void wait(flags_type old, std::memory_order order = std::memory_order_seq_cst) const noexcept
+        {
+            value_.wait(old.value(), order);
+        }
+
+        // Blocks until predicate(flags) holds and returns the flags it accepted, e.g. waiting for a bit to be set:
+        //     flags.wait_until([](auto current) { return current.has(State::resident); });
+        template<typename Predicate>
+        flags_type wait_until(Predicate predicate, std::memory_order order = std::memory_order_seq_cst) const
+        {
+            auto current = load(order);
+            while (!predicate(current)) {
+                wait(current, order);
+                current = load(order);
+            }
+            return current;
+        }
+
+        // Writers notify after an update that waiting threads may be interested in
+        void notify_one() noexcept { value_.notify_one(); }
+        void notify_all() noexcept { value_.notify_all(); }
+
+    private:
+        static constexpr underlying_type bit_value(enum_type bit) noexcept
+        {
+            return static_cast<underlying_type>(underlying_type{1} << to_underlying(bit));
+        }
+
+        std::atomic<underlying_type> value_{};
+    };
+} // namespace orion
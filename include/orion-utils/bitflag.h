@@ -1,7 +1,12 @@
 #pragma once
 
+#include "assertion.h"
 #include "type.h"
 
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
 #include <limits>
 #include <numeric>
 #include <type_traits>
@@ -18,6 +23,57 @@ namespace orion
 
         static constexpr auto zero = underlying_type{0};
         static constexpr auto max = std::numeric_limits<underlying_type>::max();
+        static constexpr auto digits = std::numeric_limits<underlying_type>::digits;
+
+        // Forward iterator over the set bits, lowest first
+        class SetBitIterator
+        {
+        public:
+            using value_type = enum_type;
+            using difference_type = std::ptrdiff_t;
+
+            constexpr SetBitIterator() = default;
+            constexpr explicit SetBitIterator(underlying_type remaining)
+                : remaining_(remaining)
+            {
+            }
+
+            constexpr enum_type operator*() const noexcept { return static_cast<enum_type>(std::countr_zero(remaining_)); }
+
+            constexpr SetBitIterator& operator++() noexcept
+            {
+                remaining_ &= static_cast<underlying_type>(remaining_ - 1); // Clear the lowest set bit
+                return *this;
+            }
+            constexpr SetBitIterator operator++(int) noexcept
+            {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            constexpr bool operator==(const SetBitIterator& rhs) const noexcept = default;
+            constexpr bool operator==(std::default_sentinel_t) const noexcept { return remaining_ == zero; }
+
+        private:
+            underlying_type remaining_ = zero;
+        };
+
+        // Range of the set bits, e.g. for (auto bit : flags.set_bits())
+        class SetBits
+        {
+        public:
+            constexpr explicit SetBits(underlying_type value)
+                : value_(value)
+            {
+            }
+
+            constexpr SetBitIterator begin() const noexcept { return SetBitIterator{value_}; }
+            constexpr std::default_sentinel_t end() const noexcept { return {}; }
+
+        private:
+            underlying_type value_;
+        };
 
         // Constructors
 
@@ -52,6 +108,32 @@ namespace orion
         constexpr bool has_any() const noexcept { return value_ != zero; }
         constexpr bool has_none() const noexcept { return value_ == zero; }
         constexpr bool has(enum_type bit) const noexcept { return (value_ & enum_to_value(bit)) != 0; }
+        constexpr bool has_all_of(Bitflag mask) const noexcept { return (value_ & mask.value_) == mask.value_; }
+        constexpr bool has_any_of(Bitflag mask) const noexcept { return (value_ & mask.value_) != zero; }
+
+        // Bit queries
+        constexpr int count() const noexcept { return std::popcount(value_); }
+        // Lowest and highest set bit, the flags must not be empty
+        constexpr enum_type first() const noexcept
+        {
+            ORION_ASSERT(has_any());
+            return static_cast<enum_type>(std::countr_zero(value_));
+        }
+        constexpr enum_type last() const noexcept
+        {
+            ORION_ASSERT(has_any());
+            return static_cast<enum_type>(digits - 1 - std::countl_zero(value_));
+        }
+
+        // Iteration over set bits, visits one bit per step instead of testing every possible bit
+        constexpr SetBits set_bits() const noexcept { return SetBits{value_}; }
+        template<typename Fn>
+        constexpr void for_each_set(Fn&& fn) const
+        {
+            for (auto remaining = value_; remaining != zero; remaining &= static_cast<underlying_type>(remaining - 1)) {
+                fn(static_cast<enum_type>(std::countr_zero(remaining)));
+            }
+        }
 
         // Equality operators
         constexpr bool operator==(const Bitflag& rhs) const noexcept = default;
@@ -113,7 +195,11 @@ namespace orion
         }
 
     private:
-        static constexpr auto enum_to_value(enum_type bit) { return static_cast<underlying_type>(1u << to_underlying(bit)); }
+        static constexpr auto enum_to_value(enum_type bit)
+        {
+            // Shift in the underlying type, a plain 1u would overflow for bits past 31 of 64-bit enums
+            return static_cast<underlying_type>(underlying_type{1} << to_underlying(bit));
+        }
 
         underlying_type value_{};
     };
@@ -0,0 +1,331 @@
+#pragma once
+
+#include "assertion.h"
+#include "type.h"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+
+namespace orion
+{
+    // Set of enum values in [0, N) stored as an array of 64-bit words, for enums with more values than
+    // Bitflag's underlying type can hold. Offers the same interface as Bitflag, so call sites can switch
+    // between the two. Whole-set operations are plain loops over the words that compilers vectorize.
+    //
+    // Bits past N are kept clear, so count(), has_all() and comparisons never see them
+    template<typename Enum, std::size_t N>
+    class EnumSet
+    {
+        static_assert(N > 0, "EnumSet needs at least one value");
+
+    public:
+        using enum_type = Enum;
+        using word_type = std::uint64_t;
+
+        static constexpr std::size_t word_bits = std::numeric_limits<word_type>::digits;
+        static constexpr std::size_t word_count = (N + word_bits - 1) / word_bits;
+        using words_type = std::array<word_type, word_count>;
+
+        // Forward iterator over the set values, lowest first
+        class SetBitIterator
+        {
+        public:
+            using value_type = enum_type;
+            using difference_type = std::ptrdiff_t;
+
+            constexpr SetBitIterator() = default;
+            constexpr explicit SetBitIterator(const words_type* words)
+                : words_(words)
+                , index_(0)
+                , remaining_((*words)[0])
+            {
+                skip_empty_words();
+            }
+
+            constexpr enum_type operator*() const noexcept
+            {
+                return static_cast<enum_type>(index_ * word_bits + static_cast<std::size_t>(std::countr_zero(remaining_)));
+            }
+
+            constexpr SetBitIterator& operator++() noexcept
+            {
+                remaining_ &= remaining_ - 1; // Clear the lowest set bit
+                skip_empty_words();
+                return *this;
+            }
+            constexpr SetBitIterator operator++(int) noexcept
+            {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            constexpr bool operator==(const SetBitIterator& rhs) const noexcept
+            {
+                return index_ == rhs.index_ && remaining_ == rhs.remaining_;
+            }
+            constexpr bool operator==(std::default_sentinel_t) const noexcept { return index_ == word_count; }
+
+        private:
+            constexpr void skip_empty_words() noexcept
+            {
+                while (remaining_ == 0 && ++index_ < word_count) {
+                    remaining_ = (*words_)[index_];
+                }
+            }
+
+            const words_type* words_ = nullptr;
+            std::size_t index_ = word_count;
+            word_type remaining_ = 0;
+        };
+
+        // Range of the set values. Holds a copy of the words, so iterating the result of an expression
+        // like (a | b).set_bits() is safe
+        class SetBits
+        {
+        public:
+            constexpr explicit SetBits(const words_type& words)
+                : words_(words)
+            {
+            }
+
+            constexpr SetBitIterator begin() const noexcept { return SetBitIterator{&words_}; }
+            constexpr std::default_sentinel_t end() const noexcept { return {}; }
+
+        private:
+            words_type words_;
+        };
+
+        // Constructors
+
+        constexpr EnumSet() = default;
+        constexpr EnumSet(enum_type value)
+        {
+            const auto index = to_index(value);
+            words_[index / word_bits] = word_type{1} << (index % word_bits);
+        }
+        constexpr explicit EnumSet(const words_type& words)
+            : words_(words)
+        {
+            clear_unused_bits();
+        }
+
+        // Factory functions
+        static constexpr EnumSet all() noexcept
+        {
+            EnumSet set;
+            set.words_.fill(~word_type{0});
+            set.clear_unused_bits();
+            return set;
+        }
+        static constexpr EnumSet none() noexcept { return EnumSet{}; }
+        static constexpr EnumSet disjunction(std::initializer_list<enum_type> values) noexcept
+        {
+            auto set = none();
+            for (auto value : values) {
+                set |= value;
+            }
+            return set;
+        }
+        static constexpr EnumSet conjunction(std::initializer_list<enum_type> values) noexcept
+        {
+            auto set = all();
+            for (auto value : values) {
+                set &= value;
+            }
+            return set;
+        }
+
+        // Accessors
+        constexpr const words_type& words() const noexcept { return words_; }
+        static constexpr std::size_t size() noexcept { return N; }
+
+        constexpr bool has_all() const noexcept { return *this == all(); }
+        constexpr bool has_any() const noexcept
+        {
+            word_type any = 0;
+            for (auto word : words_) {
+                any |= word;
+            }
+            return any != 0;
+        }
+        constexpr bool has_none() const noexcept { return !has_any(); }
+        constexpr bool has(enum_type value) const noexcept
+        {
+            const auto index = to_index(value);
+            return (words_[index / word_bits] >> (index % word_bits) & 1) != 0;
+        }
+        constexpr bool has_all_of(const EnumSet& mask) const noexcept { return mask.is_subset_of(*this); }
+        constexpr bool has_any_of(const EnumSet& mask) const noexcept
+        {
+            word_type any = 0;
+            for (std::size_t i = 0; i < word_count; ++i) {
+                any |= words_[i] & mask.words_[i];
+            }
+            return any != 0;
+        }
+        constexpr bool is_subset_of(const EnumSet& other) const noexcept
+        {
+            word_type outside = 0;
+            for (std::size_t i = 0; i < word_count; ++i) {
+                outside |= words_[i] & ~other.words_[i];
+            }
+            return outside == 0;
+        }
+
+        // Bit queries
+        constexpr int count() const noexcept
+        {
+            int total = 0;
+            for (auto word : words_) {
+                total += std::popcount(word);
+            }
+            return total;
+        }
+        // Lowest and highest set value, the set must not be empty
+        constexpr enum_type first() const noexcept
+        {
+            ORION_ASSERT(has_any());
+            std::size_t index = 0;
+            while (words_[index] == 0) {
+                ++index;
+            }
+            return static_cast<enum_type>(index * word_bits + static_cast<std::size_t>(std::countr_zero(words_[index])));
+        }
+        constexpr enum_type last() const noexcept
+        {
+            ORION_ASSERT(has_any());
+            std::size_t index = word_count - 1;
+            while (words_[index] == 0) {
+                --index;
+            }
+            return static_cast<enum_type>(index * word_bits + word_bits - 1 - static_cast<std::size_t>(std::countl_zero(words_[index])));
+        }
+
+        // Iteration over set values
+        constexpr SetBits set_bits() const noexcept { return SetBits{words_}; }
+        template<typename Fn>
+        constexpr void for_each_set(Fn&& fn) const
+        {
+            for (std::size_t index = 0; index < word_count; ++index) {
+                for (auto remaining = words_[index]; remaining != 0; remaining &= remaining - 1) {
+                    fn(static_cast<enum_type>(index * word_bits + static_cast<std::size_t>(std::countr_zero(remaining))));
+                }
+            }
+        }
+
+        // Equality operators
+        constexpr bool operator==(const EnumSet& rhs) const noexcept = default;
+
+        // Operator overloads
+        constexpr EnumSet operator~() const noexcept
+        {
+            EnumSet result;
+            for (std::size_t i = 0; i < word_count; ++i) {
+                result.words_[i] = ~words_[i];
+            }
+            result.clear_unused_bits();
+            return result;
+        }
+
+        constexpr EnumSet operator|(const EnumSet& rhs) const noexcept { return EnumSet{*this} |= rhs; }
+        constexpr EnumSet& operator|=(const EnumSet& rhs) noexcept
+        {
+            for (std::size_t i = 0; i < word_count; ++i) {
+                words_[i] |= rhs.words_[i];
+            }
+            return *this;
+        }
+
+        constexpr EnumSet operator&(const EnumSet& rhs) const noexcept { return EnumSet{*this} &= rhs; }
+        constexpr EnumSet& operator&=(const EnumSet& rhs) noexcept
+        {
+            for (std::size_t i = 0; i < word_count; ++i) {
+                words_[i] &= rhs.words_[i];
+            }
+            return *this;
+        }
+
+        constexpr EnumSet operator^(const EnumSet& rhs) const noexcept { return EnumSet{*this} ^= rhs; }
+        constexpr EnumSet& operator^=(const EnumSet& rhs) noexcept
+        {
+            for (std::size_t i = 0; i < word_count; ++i) {
+                words_[i] ^= rhs.words_[i];
+            }
+            return *this;
+        }
+
+        // this & ~rhs in one pass
+        constexpr EnumSet and_not(const EnumSet& rhs) const noexcept
+        {
+            EnumSet result;
+            for (std::size_t i = 0; i < word_count; ++i) {
+                result.words_[i] = words_[i] & ~rhs.words_[i];
+            }
+            return result;
+        }
+
+        constexpr EnumSet operator<<(std::size_t shift) const noexcept
+        {
+            EnumSet result;
+            const auto word_shift = shift / word_bits;
+            const auto bit_shift = shift % word_bits;
+            for (std::size_t i = word_count; i-- > word_shift;) {
+                auto word = words_[i - word_shift] << bit_shift;
+                if (bit_shift != 0 && i > word_shift) {
+                    word |= words_[i - word_shift - 1] >> (word_bits - bit_shift);
+                }
+                result.words_[i] = word;
+            }
+            result.clear_unused_bits();
+            return result;
+        }
+        constexpr EnumSet& operator<<=(std::size_t shift) noexcept
+        {
+            *this = (*this << shift);
+            return *this;
+        }
+
+        constexpr EnumSet operator>>(std::size_t shift) const noexcept
+        {
+            EnumSet result;
+            const auto word_shift = shift / word_bits;
+            const auto bit_shift = shift % word_bits;
+            for (std::size_t i = 0; i + word_shift < word_count; ++i) {
+                auto word = words_[i + word_shift] >> bit_shift;
+                if (bit_shift != 0 && i + word_shift + 1 < word_count) {
+                    word |= words_[i + word_shift + 1] << (word_bits - bit_shift);
+                }
+                result.words_[i] = word;
+            }
+            return result;
+        }
+        constexpr EnumSet& operator>>=(std::size_t shift) noexcept
+        {
+            *this = (*this >> shift);
+            return *this;
+        }
+
+    private:
+        static constexpr std::size_t to_index(enum_type value) noexcept
+        {
+            const auto index = static_cast<std::size_t>(to_underlying(value));
+            ORION_ASSERT(index < N);
+            return index;
+        }
+
+        constexpr void clear_unused_bits() noexcept
+        {
+            if constexpr (N % word_bits != 0) {
+                words_[word_count - 1] &= (word_type{1} << (N % word_bits)) - 1;
+            }
+        }
+
+        words_type words_{};
+    };
+} // namespace orion
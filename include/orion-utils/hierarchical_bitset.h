@@ -0,0 +1,361 @@
+#pragma once
+
+#include "orion-utils/assertion.h" // ORION_ASSERT
+#include "orion-utils/type.h"      // orion::min_unsigned_t
+
+#include <algorithm> // std::min
+#include <array>     // std::array
+#include <bit>       // std::countr_zero, std::popcount
+#include <cstddef>   // std::size_t, std::ptrdiff_t
+#include <cstdint>   // std::uint64_t
+#include <iterator>  // std::default_sentinel_t
+#include <limits>    // std::numeric_limits
+#include <optional>  // std::optional
+
+namespace orion
+{
+    namespace detail
+    {
+        // Fixed-size bitset with summary levels on top of the bit words. A bit on level k + 1 tells whether
+        // word j on level k has any set bit, a second summary tracks whether the word is full. Searches
+        // for a set or a clear bit look at one word per level, O(log64 N) instead of a scan of N / 64 words:
+        // three levels cover 262144 bits.
+        //
+        // Bits past N are kept clear, so count() and the set-bit searches never see them
+        template<std::size_t N>
+        class HierarchicalBitset
+        {
+            static_assert(N > 0, "HierarchicalBitset needs at least one bit");
+
+        public:
+            using word_type = std::uint64_t;
+
+            static constexpr std::size_t word_bits = std::numeric_limits<word_type>::digits;
+            static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+        private:
+            static constexpr std::size_t words_for(std::size_t bits) noexcept { return (bits + word_bits - 1) / word_bits; }
+
+            static consteval std::size_t find_level_count() noexcept
+            {
+                std::size_t levels = 1;
+                for (auto words = words_for(N); words > 1; words = words_for(words)) {
+                    ++levels;
+                }
+                return levels;
+            }
+
+        public:
+            static constexpr std::size_t level_count = find_level_count();
+
+        private:
+            struct Level {
+                std::size_t offset; // Of the first word of the level in the word arrays
+                std::size_t words;
+                std::size_t children; // Bits in use, N on the bottom level
+            };
+
+            static consteval std::array<Level, level_count> make_levels() noexcept
+            {
+                std::array<Level, level_count> levels{};
+                std::size_t offset = 0;
+                std::size_t children = N;
+                for (auto& level : levels) {
+                    level = Level{offset, words_for(children), children};
+                    offset += level.words;
+                    children = level.words;
+                }
+                return levels;
+            }
+
+            static constexpr std::array<Level, level_count> levels = make_levels();
+            static constexpr std::size_t total_words = levels.back().offset + 1;
+            static constexpr word_type all_ones = ~word_type{0};
+
+            // Bits past the last child of the last word of a level
+            static constexpr word_type padding(const Level& level, std::size_t word) noexcept
+            {
+                const auto used = level.children % word_bits;
+                return word + 1 == level.words && used != 0 ? all_ones << used : word_type{0};
+            }
+
+        public:
+            // Forward iterator over the set bits, lowest first
+            class SetBitIterator
+            {
+            public:
+                using value_type = std::size_t;
+                using difference_type = std::ptrdiff_t;
+
+                constexpr SetBitIterator() = default;
+                constexpr SetBitIterator(const HierarchicalBitset* bitset, std::size_t index)
+                    : bitset_(bitset)
+                    , index_(index)
+                {
+                }
+
+                constexpr std::size_t operator*() const noexcept { return index_; }
+
+                constexpr SetBitIterator& operator++() noexcept
+                {
+                    index_ = index_ + 1 < N ? bitset_->find_first_set(index_ + 1) : npos;
+                    return *this;
+                }
+                constexpr SetBitIterator operator++(int) noexcept
+                {
+                    auto copy = *this;
+                    ++*this;
+                    return copy;
+                }
+
+                constexpr bool operator==(const SetBitIterator& rhs) const noexcept { return index_ == rhs.index_; }
+                constexpr bool operator==(std::default_sentinel_t) const noexcept { return index_ == npos; }
+
+            private:
+                const HierarchicalBitset* bitset_ = nullptr;
+                std::size_t index_ = npos;
+            };
+
+            // Range of the set bits, e.g. for (auto index : bitset.set_bits())
+            class SetBits
+            {
+            public:
+                constexpr explicit SetBits(const HierarchicalBitset* bitset)
+                    : bitset_(bitset)
+                {
+                }
+
+                constexpr SetBitIterator begin() const noexcept { return SetBitIterator{bitset_, bitset_->find_first_set()}; }
+                constexpr std::default_sentinel_t end() const noexcept { return {}; }
+
+            private:
+                const HierarchicalBitset* bitset_;
+            };
+
+            constexpr HierarchicalBitset() noexcept
+            {
+                // Children that don't exist count as full, so a summary word of full children is all ones
+                for (std::size_t level = 0; level < level_count; ++level) {
+                    for (std::size_t word = 0; word < levels[level].words; ++word) {
+                        full_[levels[level].offset + word] = padding(levels[level], word);
+                    }
+                }
+            }
+
+            [[nodiscard]] static constexpr std::size_t size() noexcept { return N; }
+
+            [[nodiscard]] constexpr bool test(std::size_t index) const noexcept
+            {
+                ORION_ASSERT(index < N);
+                return (words_[index / word_bits] & bit(index)) != 0;
+            }
+            [[nodiscard]] constexpr bool has_any() const noexcept { return words_[total_words - 1] != 0; }
+            [[nodiscard]] constexpr bool has_none() const noexcept { return !has_any(); }
+            [[nodiscard]] constexpr bool has_all() const noexcept { return full_[total_words - 1] == all_ones; }
+
+            [[nodiscard]] constexpr std::size_t count() const noexcept
+            {
+                std::size_t count = 0;
+                for (std::size_t word = 0; word < levels[0].words; ++word) {
+                    count += static_cast<std::size_t>(std::popcount(words_[word]));
+                }
+                return count;
+            }
+
+            constexpr void set(std::size_t index) noexcept
+            {
+                ORION_ASSERT(index < N);
+                const auto word = index / word_bits;
+                words_[word] |= bit(index);
+                full_[word] |= bit(index);
+                update_summaries(word);
+            }
+            constexpr void clear(std::size_t index) noexcept
+            {
+                ORION_ASSERT(index < N);
+                const auto word = index / word_bits;
+                words_[word] &= ~bit(index);
+                full_[word] &= ~bit(index);
+                update_summaries(word);
+            }
+
+            // Sets or clears every bit in [first, last), a word at a time
+            constexpr void set(std::size_t first, std::size_t last) noexcept
+            {
+                for_each_word(first, last, [this](std::size_t word, word_type mask) {
+                    words_[word] |= mask;
+                    full_[word] |= mask;
+                });
+            }
+            constexpr void clear(std::size_t first, std::size_t last) noexcept
+            {
+                for_each_word(first, last, [this](std::size_t word, word_type mask) {
+                    words_[word] &= ~mask;
+                    full_[word] &= ~mask;
+                });
+            }
+            constexpr void clear() noexcept
+            {
+                *this = HierarchicalBitset{};
+            }
+
+            // Lowest set (or clear) bit at or after from, npos if there is none
+            [[nodiscard]] constexpr std::size_t find_first_set(std::size_t from = 0) const noexcept
+            {
+                return find_first<false>(from);
+            }
+            [[nodiscard]] constexpr std::size_t find_first_clear(std::size_t from = 0) const noexcept
+            {
+                return find_first<true>(from);
+            }
+
+            // Iteration over set bits, each step jumps over empty words through the summaries
+            [[nodiscard]] constexpr SetBits set_bits() const noexcept { return SetBits{this}; }
+            template<typename Fn>
+            constexpr void for_each_set(Fn&& fn) const
+            {
+                for (auto index = find_first_set(); index != npos; index = index + 1 < N ? find_first_set(index + 1) : npos) {
+                    fn(index);
+                }
+            }
+
+            [[nodiscard]] constexpr friend bool operator==(const HierarchicalBitset& lhs, const HierarchicalBitset& rhs) noexcept
+            {
+                return lhs.words_ == rhs.words_;
+            }
+
+        private:
+            static constexpr word_type bit(std::size_t index) noexcept { return word_type{1} << (index % word_bits); }
+
+            // Recomputes the summary bits of word and its ancestors, stopping at the first level that doesn't change
+            constexpr void update_summaries(std::size_t word) noexcept
+            {
+                for (std::size_t level = 1; level < level_count; ++level) {
+                    const auto child = levels[level - 1].offset + word;
+                    const auto parent = levels[level].offset + word / word_bits;
+                    const auto any = words_[child] != 0 ? bit(word) : word_type{0};
+                    const auto full = full_[child] == all_ones ? bit(word) : word_type{0};
+                    const auto old_any = words_[parent];
+                    const auto old_full = full_[parent];
+                    words_[parent] = (old_any & ~bit(word)) | any;
+                    full_[parent] = (old_full & ~bit(word)) | full;
+                    if (words_[parent] == old_any && full_[parent] == old_full) {
+                        return;
+                    }
+                    word /= word_bits;
+                }
+            }
+
+            template<typename Update>
+            constexpr void for_each_word(std::size_t first, std::size_t last, Update update) noexcept
+            {
+                ORION_ASSERT(first <= last && last <= N);
+                while (first < last) {
+                    const auto word = first / word_bits;
+                    const auto end = std::min(last, (word + 1) * word_bits);
+                    const auto count = end - first;
+                    const auto mask = (count == word_bits ? all_ones : (word_type{1} << count) - 1) << (first % word_bits);
+                    update(word, mask);
+                    update_summaries(word);
+                    first = end;
+                }
+            }
+
+            // Searches words_ for a set bit or full_ for a clear one. Climbs the levels until a word has a match
+            // after the start position, then descends to the lowest matching bit below it
+            template<bool Clear>
+            constexpr std::size_t find_first(std::size_t from) const noexcept
+            {
+                auto matches = [this](std::size_t level, std::size_t word) {
+                    const auto index = levels[level].offset + word;
+                    return Clear ? ~full_[index] : words_[index];
+                };
+
+                if (from >= N) {
+                    return npos;
+                }
+                std::size_t index = from;
+                std::size_t level = 0;
+                word_type found = 0;
+                for (; level < level_count; ++level) {
+                    const auto word = index / word_bits;
+                    found = matches(level, word) & (all_ones << (index % word_bits));
+                    if (found != 0) {
+                        index = word;
+                        break;
+                    }
+                    if (word + 1 >= levels[level].words) {
+                        return npos;
+                    }
+                    index = word + 1;
+                }
+                if (level == level_count) {
+                    return npos;
+                }
+                index = index * word_bits + static_cast<std::size_t>(std::countr_zero(found));
+                while (level-- > 0) {
+                    index = index * word_bits + static_cast<std::size_t>(std::countr_zero(matches(level, index)));
+                }
+                return index < N ? index : npos;
+            }
+
+            // Bottom level words hold the bits, the words of higher levels the summaries of the level below.
+            // full_ mirrors words_ on the bottom level with the padding set, and tracks full words above it
+            std::array<word_type, total_words> words_{};
+            std::array<word_type, total_words> full_{};
+        };
+
+        // Hands out the lowest free index in [0, Capacity), finding it through the summaries of a
+        // HierarchicalBitset instead of scanning the whole pool
+        template<std::size_t Capacity>
+        class IndexAllocator
+        {
+        public:
+            using size_type = min_unsigned_t<Capacity>;
+            using bitset_type = HierarchicalBitset<Capacity>;
+
+            [[nodiscard]] constexpr std::optional<size_type> allocate() noexcept
+            {
+                const auto index = allocated_.find_first_clear();
+                if (index == bitset_type::npos) {
+                    return std::nullopt;
+                }
+                allocated_.set(index);
+                ++size_;
+                return static_cast<size_type>(index);
+            }
+
+            constexpr void free(size_type index) noexcept
+            {
+                ORION_ASSERT(is_allocated(index), "index {} is not allocated", index);
+                allocated_.clear(index);
+                --size_;
+            }
+
+            constexpr void clear() noexcept
+            {
+                allocated_.clear();
+                size_ = 0;
+            }
+
+            [[nodiscard]] constexpr bool is_allocated(size_type index) const noexcept { return allocated_.test(index); }
+            [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+            [[nodiscard]] constexpr bool full() const noexcept { return size_ == Capacity; }
+            [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+            [[nodiscard]] static constexpr size_type capacity() noexcept { return Capacity; }
+
+            // Allocated indices, e.g. for (auto index : allocator.allocated().set_bits())
+            [[nodiscard]] constexpr const bitset_type& allocated() const noexcept { return allocated_; }
+
+        private:
+            bitset_type allocated_;
+            size_type size_ = 0;
+        };
+    } // namespace detail
+
+    template<std::size_t N>
+    using hierarchical_bitset = detail::HierarchicalBitset<N>;
+
+    template<std::size_t Capacity>
+    using index_allocator = detail::IndexAllocator<Capacity>;
+} // namespace orion
@@ -0,0 +1,491 @@
+#pragma once
+
+#include "orion-utils/assertion.h"   // ORION_ASSERT
+#include "orion-utils/mpmc_queue.h"  // orion::mpmc_queue
+#include "orion-utils/object_pool.h" // orion::ObjectPool
+#include "orion-utils/type.h"        // orion::cache_line_size
+
+#include <algorithm>   // std::max
+#include <array>       // std::array
+#include <atomic>      // std::atomic, std::atomic_thread_fence
+#include <cstddef>     // std::size_t, std::byte, std::max_align_t
+#include <cstdint>     // std::int64_t, std::uint32_t, std::uint64_t
+#include <memory>      // std::construct_at, std::destroy_at, std::unique_ptr, std::make_unique
+#include <mutex>       // std::mutex, std::scoped_lock
+#include <new>         // std::launder, placement new
+#include <ranges>      // std::ranges::random_access_range, std::ranges::sized_range
+#include <thread>      // std::thread, std::this_thread::yield
+#include <type_traits> // std::decay_t, std::is_trivially_copyable_v, std::is_trivially_destructible_v
+#include <utility>     // std::exchange, std::forward
+#include <vector>      // std::vector
+
+namespace orion
+{
+    class JobCounter;
+    class JobSystem;
+
+    namespace detail
+    {
+        // Chase-Lev work-stealing deque with a fixed capacity (Lê, Pop, Cohen, Zappa Nardelli, PPoPP 2013).
+        // The owning thread pushes and pops at the bottom, other threads steal from the top
+        template<typename T, std::size_t Capacity>
+        class WorkStealingDeque
+        {
+            static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "WorkStealingDeque capacity must be a power of two");
+            static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque elements are copied through atomics");
+
+        public:
+            // Owner only, returns false when full
+            [[nodiscard]] bool push(T value) noexcept
+            {
+                const auto bottom = bottom_.load(std::memory_order_relaxed);
+                const auto top = top_.load(std::memory_order_acquire);
+                if (bottom - top >= static_cast<std::int64_t>(Capacity)) {
+                    return false;
+                }
+                slot(bottom).store(value, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                bottom_.store(bottom + 1, std::memory_order_relaxed);
+                return true;
+            }
+
+            // Owner only, takes the most recently pushed element
+            [[nodiscard]] bool pop(T& value) noexcept
+            {
+                const auto bottom = bottom_.load(std::memory_order_relaxed) - 1;
+                bottom_.store(bottom, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                auto top = top_.load(std::memory_order_relaxed);
+                if (top > bottom) {
+                    bottom_.store(bottom + 1, std::memory_order_relaxed);
+                    return false;
+                }
+                value = slot(bottom).load(std::memory_order_relaxed);
+                if (top < bottom) {
+                    return true;
+                }
+                // Last element, race thieves for it
+                const bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                bottom_.store(bottom + 1, std::memory_order_relaxed);
+                return won;
+            }
+
+            // Any thread, takes the least recently pushed element
+            [[nodiscard]] bool steal(T& value) noexcept
+            {
+                auto top = top_.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const auto bottom = bottom_.load(std::memory_order_acquire);
+                if (top >= bottom) {
+                    return false;
+                }
+                value = slot(top).load(std::memory_order_relaxed);
+                return top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] bool empty() const noexcept
+            {
+                return top_.load(std::memory_order_acquire) >= bottom_.load(std::memory_order_acquire);
+            }
+
+        private:
+            std::atomic<T>& slot(std::int64_t index) noexcept
+            {
+                return slots_[static_cast<std::size_t>(index) & (Capacity - 1)];
+            }
+
+            alignas(cache_line_size) std::atomic<std::int64_t> top_ = 0;
+            alignas(cache_line_size) std::atomic<std::int64_t> bottom_ = 0;
+            alignas(cache_line_size) std::array<std::atomic<T>, Capacity> slots_{};
+        };
+
+        // Type erased callable with inline storage, two cache lines in total
+        struct alignas(cache_line_size) Job {
+            static constexpr std::size_t storage_size = 2 * cache_line_size - 2 * alignof(std::max_align_t);
+
+            void (*invoke)(Job&) = nullptr; // Calls the callable and destroys it
+            JobCounter* counter = nullptr;
+            Job* next = nullptr; // Link in a counter's list of continuations
+            alignas(std::max_align_t) std::byte storage[storage_size];
+        };
+        static_assert(sizeof(Job) == 2 * cache_line_size);
+    } // namespace detail
+
+    // Number of unfinished jobs in a group. Used to wait for the group (fork-join) and to start jobs once the
+    // group is done (dependencies). Must outlive the jobs it counts and may be reused once done
+    class JobCounter
+    {
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter(JobCounter&&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+        JobCounter& operator=(JobCounter&&) = delete;
+
+        ~JobCounter()
+        {
+            ORION_ASSERT(done());
+        }
+
+        [[nodiscard]] bool done() const noexcept
+        {
+            // Completing threads keep referencing the counter while they start continuations,
+            // so it is only safe to destroy once they have let go as well
+            return pending_.load() == 0 && references_.load() == 0;
+        }
+
+    private:
+        friend class JobSystem;
+
+        std::atomic<std::uint32_t> pending_ = 0;
+        std::atomic<std::uint32_t> references_ = 0;
+        std::mutex continuations_mutex_;
+        detail::Job* continuations_ = nullptr;
+    };
+
+    // Pool of worker threads running small jobs. Every worker owns a work-stealing deque: jobs started from a
+    // worker go onto its own deque and idle workers steal from a random victim. Jobs started from other threads
+    // go through a shared injection queue. Threads waiting for a counter run jobs instead of blocking, so
+    // the calling thread takes part in the work and nested fork-join does not deadlock.
+    //
+    // Jobs are callables taking no arguments with at most job_storage_size bytes of state (capture large
+    // state by reference). They must not throw
+    class JobSystem
+    {
+    public:
+        static constexpr std::size_t job_storage_size = detail::Job::storage_size;
+        static constexpr std::size_t deque_capacity = 4096;
+        static constexpr std::size_t injection_capacity = 1024;
+
+        // One worker per hardware thread besides the calling one, which helps out while waiting
+        JobSystem()
+            : JobSystem(std::max(std::thread::hardware_concurrency(), 1u) - 1)
+        {
+        }
+
+        // With zero workers every job runs on threads that wait for it
+        explicit JobSystem(std::size_t worker_count)
+        {
+            workers_.reserve(worker_count);
+            for (std::size_t i = 0; i < worker_count; ++i) {
+                workers_.push_back(std::make_unique<Worker>(*this, i));
+            }
+            for (auto& worker : workers_) {
+                worker->thread = std::thread([this, worker = worker.get()]() { work(*worker); });
+            }
+        }
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem(JobSystem&&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+        JobSystem& operator=(JobSystem&&) = delete;
+
+        // Every job started before destruction still runs, waiting jobs are drained before the workers stop
+        // and once more afterwards for jobs started by the last ones running on the workers
+        ~JobSystem()
+        {
+            drain();
+            stopping_.store(true);
+            wake(true);
+            for (auto& worker : workers_) {
+                worker->thread.join();
+            }
+            drain();
+        }
+
+        // Starts fn as a job counted by counter
+        template<typename Fn>
+        void run(Fn&& fn, JobCounter& counter)
+        {
+            auto* job = make_job(std::forward<Fn>(fn), counter);
+            submit(job);
+        }
+
+        // Starts fn as a job counted by counter once every job counted by dependency is done
+        template<typename Fn>
+        void run_after(JobCounter& dependency, Fn&& fn, JobCounter& counter)
+        {
+            auto* job = make_job(std::forward<Fn>(fn), counter);
+            {
+                std::scoped_lock lock(dependency.continuations_mutex_);
+                if (dependency.pending_.load() != 0) {
+                    job->next = std::exchange(dependency.continuations_, job);
+                    return;
+                }
+            }
+            submit(job);
+        }
+
+        // Runs jobs until every job counted by counter is done
+        void wait(JobCounter& counter)
+        {
+            auto* worker = current_worker();
+            unsigned idle_rounds = 0;
+            while (!counter.done()) {
+                detail::Job* job = nullptr;
+                if (find_job(worker, job)) {
+                    execute(worker, job);
+                    idle_rounds = 0;
+                } else if (++idle_rounds > spin_rounds) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        // Calls fn(index) for every index in [first, last), splitting the range into jobs of at least grain indices.
+        // Returns once every call has finished, fn is called concurrently from several threads
+        template<typename Fn>
+        void parallel_for(std::size_t first, std::size_t last, std::size_t grain, Fn&& fn)
+        {
+            ORION_ASSERT(first <= last);
+            ORION_ASSERT(grain > 0);
+            JobCounter counter;
+            split(first, last, grain, fn, counter);
+            wait(counter);
+        }
+
+        // Calls fn(element) for every element of a random access range (e.g. orion::static_vector, std::span)
+        template<std::ranges::random_access_range Range, typename Fn>
+            requires std::ranges::sized_range<Range>
+        void parallel_for(Range&& range, std::size_t grain, Fn&& fn)
+        {
+            auto first = std::ranges::begin(range);
+            parallel_for(0, static_cast<std::size_t>(std::ranges::size(range)), grain,
+                         [first, &fn](std::size_t index) { fn(first[static_cast<std::ranges::range_difference_t<Range>>(index)]); });
+        }
+
+        [[nodiscard]] std::size_t worker_count() const noexcept { return workers_.size(); }
+
+    private:
+        using JobPool = ObjectPool<detail::Job, 256, std::mutex>;
+
+        static constexpr unsigned spin_rounds = 64;
+
+        struct Worker {
+            Worker(JobSystem& owner, std::size_t worker_index)
+                : system(&owner)
+                , index(worker_index)
+                , magazine(owner.pool_)
+                , random_state(0x9E3779B97F4A7C15ull * (worker_index + 1))
+            {
+            }
+
+            JobSystem* system;
+            std::size_t index;
+            detail::WorkStealingDeque<detail::Job*, deque_capacity> deque;
+            JobPool::Magazine magazine; // Only touched by the worker's own thread
+            std::uint64_t random_state;
+            std::thread thread;
+        };
+
+        static inline thread_local Worker* current_worker_ = nullptr;
+
+        // The worker running on this thread, if it belongs to this system
+        [[nodiscard]] Worker* current_worker() const noexcept
+        {
+            return current_worker_ != nullptr && current_worker_->system == this ? current_worker_ : nullptr;
+        }
+
+        template<typename Fn>
+        detail::Job* make_job(Fn&& fn, JobCounter& counter)
+        {
+            using Callable = std::decay_t<Fn>;
+            static_assert(sizeof(Callable) <= job_storage_size, "Job state too large, capture it by reference");
+            static_assert(alignof(Callable) <= alignof(std::max_align_t), "Job state is over-aligned");
+
+            auto* worker = current_worker();
+            // Default initialized, the callable's storage is written by its constructor only
+            auto* job = ::new (static_cast<void*>(worker != nullptr ? worker->magazine.allocate() : pool_.allocate())) detail::Job;
+            try {
+                std::construct_at(reinterpret_cast<Callable*>(job->storage), std::forward<Fn>(fn));
+            } catch (...) {
+                free_job(worker, job);
+                throw;
+            }
+            job->invoke = [](detail::Job& self) {
+                auto* callable = std::launder(reinterpret_cast<Callable*>(self.storage));
+                (*callable)();
+                std::destroy_at(callable);
+            };
+            job->counter = &counter;
+            counter.pending_.fetch_add(1);
+            return job;
+        }
+
+        void free_job(Worker* worker, detail::Job* job) noexcept
+        {
+            static_assert(std::is_trivially_destructible_v<detail::Job>);
+            if (worker != nullptr) {
+                worker->magazine.deallocate(job);
+            } else {
+                pool_.deallocate(job);
+            }
+        }
+
+        // Queues a job on the current worker's deque or the injection queue, running it right away if they are full
+        void submit(detail::Job* job)
+        {
+            auto* worker = current_worker();
+            const bool queued = worker != nullptr ? worker->deque.push(job) : injected_.try_push(job);
+            if (!queued) {
+                execute(worker, job);
+                return;
+            }
+            wake(false);
+        }
+
+        void execute(Worker* worker, detail::Job* job) noexcept
+        {
+            job->invoke(*job);
+            auto* counter = job->counter;
+            free_job(worker, job);
+            complete(*counter);
+        }
+
+        void complete(JobCounter& counter) noexcept
+        {
+            counter.references_.fetch_add(1);
+            if (counter.pending_.fetch_sub(1) == 1) {
+                detail::Job* continuations = nullptr;
+                {
+                    std::scoped_lock lock(counter.continuations_mutex_);
+                    continuations = std::exchange(counter.continuations_, nullptr);
+                }
+                while (continuations != nullptr) {
+                    submit(std::exchange(continuations, continuations->next));
+                }
+            }
+            counter.references_.fetch_sub(1);
+        }
+
+        void drain() noexcept
+        {
+            detail::Job* job = nullptr;
+            while (find_job(nullptr, job)) {
+                execute(nullptr, job);
+            }
+        }
+
+        // Own deque first, then the injection queue, then other workers starting at a random one
+        bool find_job(Worker* worker, detail::Job*& job) noexcept
+        {
+            if (worker != nullptr && worker->deque.pop(job)) {
+                return true;
+            }
+            if (auto injected = injected_.try_pop()) {
+                job = *injected;
+                return true;
+            }
+            const auto count = workers_.size();
+            if (count == 0) {
+                return false;
+            }
+            const auto start = worker != nullptr ? next_random(worker->random_state) : next_random(external_random_state());
+            for (std::size_t i = 0; i < count; ++i) {
+                auto& victim = *workers_[(start + i) % count];
+                if (&victim != worker && victim.deque.steal(job)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void work(Worker& worker)
+        {
+            current_worker_ = &worker;
+            unsigned idle_rounds = 0;
+            while (!stopping_.load(std::memory_order_relaxed)) {
+                detail::Job* job = nullptr;
+                if (find_job(&worker, job)) {
+                    execute(&worker, job);
+                    idle_rounds = 0;
+                } else if (++idle_rounds <= spin_rounds) {
+                    std::this_thread::yield();
+                } else {
+                    sleep(worker);
+                    idle_rounds = 0;
+                }
+            }
+            worker.magazine.flush();
+            current_worker_ = nullptr;
+        }
+
+        // Blocks until a job is submitted. Announces the sleeper before checking for work one last time, so
+        // a submitter either sees the sleeper and wakes it or its job is found by the final check
+        void sleep(Worker& worker)
+        {
+            const auto epoch = wake_epoch_.load();
+            sleepers_.fetch_add(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (has_work(worker) || stopping_.load()) {
+                sleepers_.fetch_sub(1);
+                return;
+            }
+            wake_epoch_.wait(epoch);
+            sleepers_.fetch_sub(1);
+        }
+
+        [[nodiscard]] bool has_work(const Worker& worker) const noexcept
+        {
+            if (!injected_.empty()) {
+                return true;
+            }
+            for (const auto& other : workers_) {
+                if (other.get() != &worker && !other->deque.empty()) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void wake(bool all) noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (sleepers_.load() == 0 && !all) {
+                return;
+            }
+            wake_epoch_.fetch_add(1);
+            if (all) {
+                wake_epoch_.notify_all();
+            } else {
+                wake_epoch_.notify_one();
+            }
+        }
+
+        template<typename Fn>
+        void split(std::size_t first, std::size_t last, std::size_t grain, Fn& fn, JobCounter& counter)
+        {
+            // Hand out the upper half until the rest is small enough, thieves take the largest halves first
+            while (last - first > grain) {
+                const auto middle = first + (last - first) / 2;
+                run([this, middle, last, grain, &fn, &counter]() { split(middle, last, grain, fn, counter); }, counter);
+                last = middle;
+            }
+            for (; first != last; ++first) {
+                fn(first);
+            }
+        }
+
+        static std::uint64_t& external_random_state() noexcept
+        {
+            static thread_local std::uint64_t state = 0x2545F4914F6CDD1Dull;
+            return state;
+        }
+
+        // xorshift64
+        static std::size_t next_random(std::uint64_t& state) noexcept
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return static_cast<std::size_t>(state);
+        }
+
+        JobPool pool_; // Declared first so worker magazines are flushed into it before it is destroyed
+        std::vector<std::unique_ptr<Worker>> workers_;
+        mpmc_queue<detail::Job*, injection_capacity> injected_;
+        std::atomic<bool> stopping_ = false;
+        std::atomic<std::uint32_t> sleepers_ = 0;
+        std::atomic<std::uint32_t> wake_epoch_ = 0;
+    };
+} // namespace orion
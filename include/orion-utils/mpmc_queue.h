@@ -0,0 +1,190 @@
+#pragma once
+
+#include "orion-utils/type.h"          // orion::cache_line_size
+#include "orion-utils/uninitialized.h" // orion::UninitializedStorage
+
+#include <array>       // std::array
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <memory>      // std::construct_at, std::destroy_at
+#include <optional>    // std::optional
+#include <type_traits> // std::is_nothrow_constructible_v, std::is_nothrow_move_constructible_v
+#include <utility>     // std::move, std::forward
+
+namespace orion
+{
+    namespace detail
+    {
+        // Bounded lock-free queue for any number of producers and consumers.
+        // Every slot carries a sequence number telling whose turn it is: a producer claiming position pos may
+        // write the slot once its sequence is pos, a consumer may read it once the sequence is pos + 1. Slots
+        // are handed over through their own sequence, so producers and consumers only contend on the shared
+        // head and tail counters.
+        //
+        // The try_ functions give up when the queue is full (or empty), push() and pop() claim a position
+        // unconditionally and block on the slot's sequence with std::atomic::wait until it is their turn
+        template<typename T, std::size_t Capacity>
+        class MpmcQueue
+        {
+            static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "MpmcQueue capacity must be a power of two");
+            static_assert(std::is_nothrow_move_constructible_v<T>, "MpmcQueue elements are moved in and out of claimed slots, which cannot fail");
+
+        public:
+            using value_type = T;
+            using size_type = std::size_t;
+
+            MpmcQueue() noexcept
+            {
+                for (size_type i = 0; i < Capacity; ++i) {
+                    slots_[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            MpmcQueue(const MpmcQueue&) = delete;
+            MpmcQueue(MpmcQueue&&) = delete;
+            MpmcQueue& operator=(const MpmcQueue&) = delete;
+            MpmcQueue& operator=(MpmcQueue&&) = delete;
+
+            ~MpmcQueue()
+            {
+                const auto tail = tail_.load(std::memory_order_relaxed);
+                for (auto head = head_.load(std::memory_order_relaxed); head != tail; ++head) {
+                    std::destroy_at(slot(head).value());
+                }
+            }
+
+            template<typename... Args>
+            [[nodiscard]] bool try_emplace(Args&&... args)
+            {
+                if constexpr (!std::is_nothrow_constructible_v<value_type, Args...>) {
+                    // A claimed position cannot be given back, so anything that may throw happens before claiming
+                    return try_emplace(value_type(std::forward<Args>(args)...));
+                } else {
+                    auto tail = tail_.load(std::memory_order_relaxed);
+                    for (;;) {
+                        auto& current = slot(tail);
+                        const auto sequence = current.sequence.load(std::memory_order_acquire);
+                        const auto lag = static_cast<std::ptrdiff_t>(sequence - tail);
+                        if (lag == 0) {
+                            if (tail_.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                                publish(current, tail, std::forward<Args>(args)...);
+                                return true;
+                            }
+                        } else if (lag < 0) {
+                            return false; // Slot still holds the element from the previous lap
+                        } else {
+                            tail = tail_.load(std::memory_order_relaxed);
+                        }
+                    }
+                }
+            }
+
+            [[nodiscard]] bool try_push(const value_type& value) { return try_emplace(value); }
+            [[nodiscard]] bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+
+            [[nodiscard]] std::optional<value_type> try_pop()
+            {
+                auto head = head_.load(std::memory_order_relaxed);
+                for (;;) {
+                    auto& current = slot(head);
+                    const auto sequence = current.sequence.load(std::memory_order_acquire);
+                    const auto lag = static_cast<std::ptrdiff_t>(sequence - (head + 1));
+                    if (lag == 0) {
+                        if (head_.compare_exchange_weak(head, head + 1, std::memory_order_relaxed)) {
+                            return consume(current, head);
+                        }
+                    } else if (lag < 0) {
+                        return std::nullopt; // Slot not written yet
+                    } else {
+                        head = head_.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            // Blocks while the queue is full
+            template<typename... Args>
+            void emplace(Args&&... args)
+            {
+                if constexpr (!std::is_nothrow_constructible_v<value_type, Args...>) {
+                    emplace(value_type(std::forward<Args>(args)...));
+                } else {
+                    const auto tail = tail_.fetch_add(1, std::memory_order_relaxed);
+                    auto& current = slot(tail);
+                    wait_for(current, tail);
+                    publish(current, tail, std::forward<Args>(args)...);
+                }
+            }
+
+            void push(const value_type& value) { emplace(value); }
+            void push(value_type&& value) { emplace(std::move(value)); }
+
+            // Blocks while the queue is empty
+            [[nodiscard]] value_type pop()
+            {
+                const auto head = head_.fetch_add(1, std::memory_order_relaxed);
+                auto& current = slot(head);
+                wait_for(current, head + 1);
+                return *consume(current, head);
+            }
+
+            // A snapshot, elements may be pushed or popped concurrently. Includes positions claimed by blocked
+            // push() calls and excludes those claimed by blocked pop() calls, so it can be negative
+            [[nodiscard]] std::ptrdiff_t size() const noexcept
+            {
+                const auto head = head_.load(std::memory_order_acquire);
+                return static_cast<std::ptrdiff_t>(tail_.load(std::memory_order_acquire) - head);
+            }
+            [[nodiscard]] bool empty() const noexcept { return size() <= 0; }
+            [[nodiscard]] static constexpr size_type capacity() noexcept { return Capacity; }
+
+        private:
+            // One slot per cache line, so neighbouring slots written by different threads do not share one
+            struct alignas(cache_line_size) Slot {
+                std::atomic<size_type> sequence;
+                UninitializedStorage<value_type, 1> storage;
+
+                value_type* value() noexcept { return storage.data(); }
+            };
+
+            [[nodiscard]] Slot& slot(size_type position) noexcept
+            {
+                return slots_[position & (Capacity - 1)];
+            }
+
+            static void wait_for(Slot& current, size_type sequence) noexcept
+            {
+                for (auto observed = current.sequence.load(std::memory_order_acquire); observed != sequence;
+                     observed = current.sequence.load(std::memory_order_acquire)) {
+                    current.sequence.wait(observed, std::memory_order_acquire);
+                }
+            }
+
+            // Construct into the slot claimed for position tail and hand it to the consumer of that position
+            template<typename... Args>
+            static void publish(Slot& current, size_type tail, Args&&... args) noexcept
+            {
+                std::construct_at(current.value(), std::forward<Args>(args)...);
+                current.sequence.store(tail + 1, std::memory_order_release);
+                current.sequence.notify_all();
+            }
+
+            // Move the element out of the slot claimed for position head and hand it to the next lap's producer
+            static std::optional<value_type> consume(Slot& current, size_type head) noexcept
+            {
+                auto* element = current.value();
+                std::optional<value_type> value(std::move(*element));
+                std::destroy_at(element);
+                current.sequence.store(head + Capacity, std::memory_order_release);
+                current.sequence.notify_all();
+                return value;
+            }
+
+            alignas(cache_line_size) std::atomic<size_type> tail_ = 0;
+            alignas(cache_line_size) std::atomic<size_type> head_ = 0;
+            std::array<Slot, Capacity> slots_;
+        };
+    } // namespace detail
+
+    template<typename T, std::size_t Capacity>
+    using mpmc_queue = detail::MpmcQueue<T, Capacity>;
+} // namespace orion
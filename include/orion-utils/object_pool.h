@@ -0,0 +1,300 @@
+#pragma once
+
+#include "orion-utils/assertion.h"     // ORION_ASSERT
+#include "orion-utils/uninitialized.h" // orion::UninitializedStorage
+
+#include <algorithm> // std::max
+#include <cstddef>   // std::byte, std::size_t
+#include <memory>    // std::construct_at, std::destroy_at
+#include <mutex>     // std::scoped_lock
+#include <utility>   // std::exchange, std::forward
+
+namespace orion
+{
+    // Lock that does nothing, for pools only used from one thread
+    struct null_mutex {
+        constexpr void lock() noexcept {}
+        constexpr bool try_lock() noexcept { return true; }
+        constexpr void unlock() noexcept {}
+    };
+
+    namespace detail
+    {
+        // Free slots are linked through their own storage
+        struct PoolNode {
+            PoolNode* next;
+        };
+
+        template<typename T>
+        struct PoolSlot {
+            alignas(std::max(alignof(T), alignof(PoolNode))) std::byte bytes[std::max(sizeof(T), sizeof(PoolNode))];
+        };
+    } // namespace detail
+
+    // Fixed-size allocator for objects of type T with O(1) allocation and deallocation. Slots are carved from
+    // chunks of ChunkSize objects, freed slots go onto an intrusive free list and are reused most recent first.
+    // Chunks are only returned to the system when the pool is destroyed, objects still alive at that point are
+    // not destroyed.
+    //
+    // Mutex guards the pool for sharing between threads (e.g. std::mutex), threads that allocate and free a lot
+    // should go through their own Magazine so that most operations do not touch the lock
+    template<typename T, std::size_t ChunkSize = 64, typename Mutex = null_mutex>
+    class ObjectPool
+    {
+        static_assert(ChunkSize > 0, "ObjectPool needs room for at least one object per chunk");
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using pointer = T*;
+
+        class Magazine;
+
+        ObjectPool() = default;
+        ObjectPool(const ObjectPool&) = delete;
+        ObjectPool(ObjectPool&&) = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+        ObjectPool& operator=(ObjectPool&&) = delete;
+
+        ~ObjectPool()
+        {
+            while (chunks_ != nullptr) {
+                delete std::exchange(chunks_, chunks_->next);
+            }
+        }
+
+        // Returns uninitialized storage for one T
+        [[nodiscard]] pointer allocate()
+        {
+            std::scoped_lock lock(mutex_);
+            auto* node = take_slot();
+            mark_acquired(1);
+            return reinterpret_cast<pointer>(node);
+        }
+
+        // Gives back storage returned by allocate(), the object must already be destroyed
+        void deallocate(pointer ptr) noexcept
+        {
+            ORION_ASSERT(ptr != nullptr);
+            auto* node = std::construct_at(reinterpret_cast<detail::PoolNode*>(ptr), nullptr);
+            release_batch(node, node, 1);
+        }
+
+        template<typename... Args>
+        [[nodiscard]] pointer create(Args&&... args)
+        {
+            return construct(*this, std::forward<Args>(args)...);
+        }
+
+        void destroy(pointer ptr) noexcept
+        {
+            ORION_ASSERT(ptr != nullptr);
+            std::destroy_at(ptr);
+            deallocate(ptr);
+        }
+
+        // Slots currently handed out, including free slots held by magazines
+        [[nodiscard]] size_type size() const
+        {
+            std::scoped_lock lock(mutex_);
+            return size_;
+        }
+        // Highest size() since the pool was created
+        [[nodiscard]] size_type high_water_mark() const
+        {
+            std::scoped_lock lock(mutex_);
+            return high_water_mark_;
+        }
+        // Slots in all chunks allocated so far
+        [[nodiscard]] size_type capacity() const
+        {
+            std::scoped_lock lock(mutex_);
+            return chunk_count_ * ChunkSize;
+        }
+        [[nodiscard]] size_type chunk_count() const
+        {
+            std::scoped_lock lock(mutex_);
+            return chunk_count_;
+        }
+
+        [[nodiscard]] static constexpr size_type chunk_size() noexcept { return ChunkSize; }
+
+    private:
+        using Slot = detail::PoolSlot<T>;
+
+        struct Chunk {
+            UninitializedStorage<Slot, ChunkSize> slots;
+            Chunk* next;
+        };
+
+        // Allocates from source and constructs in place, handing the slot back if the constructor throws
+        template<typename Source, typename... Args>
+        static pointer construct(Source& source, Args&&... args)
+        {
+            auto* ptr = source.allocate();
+            try {
+                return std::construct_at(ptr, std::forward<Args>(args)...);
+            } catch (...) {
+                source.deallocate(ptr);
+                throw;
+            }
+        }
+
+        // Pops a free slot, or carves a never used one from the newest chunk. Requires mutex_ to be held
+        detail::PoolNode* take_slot()
+        {
+            if (free_ != nullptr) {
+                return std::exchange(free_, free_->next);
+            }
+            if (unused_ == unused_end_) {
+                // Default initialized, so slots are not touched until they are handed out
+                auto* chunk = new Chunk;
+                chunk->next = std::exchange(chunks_, chunk);
+                ++chunk_count_;
+                unused_ = chunks_->slots.data();
+                unused_end_ = unused_ + ChunkSize;
+            }
+            return std::construct_at(reinterpret_cast<detail::PoolNode*>(unused_++), nullptr);
+        }
+
+        // Hands out count slots linked into a list in a single critical section
+        detail::PoolNode* acquire_batch(size_type count)
+        {
+            std::scoped_lock lock(mutex_);
+            detail::PoolNode* head = nullptr;
+            try {
+                for (size_type i = 0; i < count; ++i) {
+                    auto* node = take_slot();
+                    node->next = head;
+                    head = node;
+                }
+            } catch (...) {
+                // A new chunk failed to allocate, the slots taken so far go back onto the free list
+                while (head != nullptr) {
+                    auto* node = std::exchange(head, head->next);
+                    node->next = free_;
+                    free_ = node;
+                }
+                throw;
+            }
+            mark_acquired(count);
+            return head;
+        }
+
+        // Puts the list [first, last] of count slots back onto the free list
+        void release_batch(detail::PoolNode* first, detail::PoolNode* last, size_type count) noexcept
+        {
+            std::scoped_lock lock(mutex_);
+            last->next = free_;
+            free_ = first;
+            size_ -= count;
+        }
+
+        void mark_acquired(size_type count) noexcept
+        {
+            size_ += count;
+            high_water_mark_ = std::max(high_water_mark_, size_);
+        }
+
+        mutable Mutex mutex_;
+        detail::PoolNode* free_ = nullptr;
+        Slot* unused_ = nullptr; // Never used slots of the newest chunk
+        Slot* unused_end_ = nullptr;
+        Chunk* chunks_ = nullptr;
+        size_type chunk_count_ = 0;
+        size_type size_ = 0;
+        size_type high_water_mark_ = 0;
+    };
+
+    // Per-thread cache of free slots in front of an ObjectPool. Slots are moved to and from the pool in batches,
+    // so only one in every batch_size allocations or deallocations takes the pool's lock. Objects may be freed
+    // through a different magazine (or the pool itself) than the one that allocated them.
+    // A magazine must not outlive its pool and must only be used by one thread at a time
+    template<typename T, std::size_t ChunkSize, typename Mutex>
+    class ObjectPool<T, ChunkSize, Mutex>::Magazine
+    {
+    public:
+        static constexpr size_type default_batch_size = 32;
+
+        explicit Magazine(ObjectPool& pool, size_type batch_size = default_batch_size) noexcept
+            : pool_(&pool)
+            , batch_size_(batch_size)
+        {
+            ORION_ASSERT(batch_size_ > 0);
+        }
+
+        Magazine(const Magazine&) = delete;
+        Magazine(Magazine&&) = delete;
+        Magazine& operator=(const Magazine&) = delete;
+        Magazine& operator=(Magazine&&) = delete;
+
+        ~Magazine()
+        {
+            flush();
+        }
+
+        [[nodiscard]] pointer allocate()
+        {
+            if (head_ == nullptr) {
+                head_ = pool_->acquire_batch(batch_size_);
+                count_ = batch_size_;
+            }
+            --count_;
+            return reinterpret_cast<pointer>(std::exchange(head_, head_->next));
+        }
+
+        void deallocate(pointer ptr) noexcept
+        {
+            ORION_ASSERT(ptr != nullptr);
+            head_ = std::construct_at(reinterpret_cast<detail::PoolNode*>(ptr), head_);
+            // Keep one batch around so alternating allocate/deallocate at the boundary does not hit the pool
+            if (++count_ == 2 * batch_size_) {
+                release(batch_size_);
+            }
+        }
+
+        template<typename... Args>
+        [[nodiscard]] pointer create(Args&&... args)
+        {
+            return ObjectPool::construct(*this, std::forward<Args>(args)...);
+        }
+
+        void destroy(pointer ptr) noexcept
+        {
+            ORION_ASSERT(ptr != nullptr);
+            std::destroy_at(ptr);
+            deallocate(ptr);
+        }
+
+        // Returns every cached slot to the pool
+        void flush() noexcept
+        {
+            if (count_ > 0) {
+                release(count_);
+            }
+        }
+
+        // Free slots currently held by this magazine
+        [[nodiscard]] size_type cached() const noexcept { return count_; }
+        [[nodiscard]] ObjectPool& pool() const noexcept { return *pool_; }
+
+    private:
+        // Returns the first count cached slots to the pool
+        void release(size_type count) noexcept
+        {
+            auto* first = head_;
+            auto* last = first;
+            for (size_type i = 1; i < count; ++i) {
+                last = last->next;
+            }
+            head_ = last->next;
+            count_ -= count;
+            pool_->release_batch(first, last, count);
+        }
+
+        ObjectPool* pool_;
+        detail::PoolNode* head_ = nullptr;
+        size_type count_ = 0;
+        size_type batch_size_;
+    };
+} // namespace orion
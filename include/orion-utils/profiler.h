@@ -0,0 +1,350 @@
+#pragma once
+
+#include "orion-utils/spsc_queue.h" // orion::spsc_queue
+
+#include <atomic>      // std::atomic
+#include <chrono>      // std::chrono::steady_clock, std::chrono::duration
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t, std::uint64_t, std::int64_t
+#include <cstdio>      // std::FILE, std::fopen, std::fwrite, std::fclose
+#include <iterator>    // std::back_inserter
+#include <memory>      // std::unique_ptr, std::make_unique
+#include <mutex>       // std::mutex, std::scoped_lock
+#include <span>        // std::span
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <thread>      // std::this_thread::sleep_for
+#include <utility>     // std::exchange
+#include <vector>      // std::vector
+
+#include <fmt/format.h> // fmt::format_to, fmt::memory_buffer
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif
+
+// ORION_PROFILE_SCOPE records zones when ORION_PROFILING is 1 and expands to nothing otherwise
+#ifndef ORION_PROFILING
+    #define ORION_PROFILING 0
+#endif
+
+// Events a thread can buffer between two collections, a power of two
+#ifndef ORION_PROFILE_BUFFER_CAPACITY
+    #define ORION_PROFILE_BUFFER_CAPACITY 4096
+#endif
+
+namespace orion
+{
+    // Static description of a zone, one per ORION_PROFILE_SCOPE placed in read-only data
+    struct ProfileZone {
+        const char* name;
+        const char* file;
+        int line;
+    };
+
+    // Zone that ran on a thread, begin and end in ticks of Profiler::now()
+    struct ProfileEvent {
+        const ProfileZone* zone;
+        std::uint64_t begin;
+        std::uint64_t end;
+        std::uint32_t thread = 0; // Assigned by the collector
+    };
+
+    namespace detail
+    {
+        // Events of one thread. The thread is the only producer of the ring, the collector the only consumer
+        class ProfileBuffer
+        {
+        public:
+            explicit ProfileBuffer(std::uint32_t thread) noexcept
+                : thread_(thread)
+            {
+            }
+
+            void record(const ProfileZone& zone, std::uint64_t begin, std::uint64_t end) noexcept
+            {
+                if (!events_.try_push(ProfileEvent{&zone, begin, end})) [[unlikely]] {
+                    // Only the owning thread writes the counter, no read-modify-write needed
+                    dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                }
+            }
+
+            // Collector side, appends the buffered events to out
+            std::size_t drain(std::vector<ProfileEvent>& out)
+            {
+                const auto first = out.size();
+                const auto count = events_.try_pop_n(std::back_inserter(out), events_.capacity());
+                for (auto i = first; i < out.size(); ++i) {
+                    out[i].thread = thread_;
+                }
+                return count;
+            }
+
+            [[nodiscard]] std::uint32_t thread() const noexcept { return thread_; }
+            [[nodiscard]] std::size_t dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+            std::string name; // Guarded by the profiler's mutex
+
+        private:
+            spsc_queue<ProfileEvent, ORION_PROFILE_BUFFER_CAPACITY> events_;
+            std::atomic<std::size_t> dropped_ = 0;
+            std::uint32_t thread_;
+        };
+
+        // Appends string as a JSON string literal
+        template<typename OutputIt>
+        OutputIt write_json_string(OutputIt out, std::string_view string)
+        {
+            *out++ = '"';
+            for (const auto c : string) {
+                if (c == '"' || c == '\\') {
+                    *out++ = '\\';
+                    *out++ = c;
+                } else if (static_cast<unsigned char>(c) < 0x20) {
+                    out = fmt::format_to(out, "\\u{:04x}", static_cast<unsigned>(c));
+                } else {
+                    *out++ = c;
+                }
+            }
+            *out++ = '"';
+            return out;
+        }
+    } // namespace detail
+
+    class ProfileScope;
+
+    // Gathers the zones recorded by every thread. A thread writes its zones to a ring of its own without
+    // locking, collect() drains the rings into one list off the hot path, e.g. once a frame from the main
+    // thread. Zones recorded while a ring is full are dropped and counted, collect often enough for the
+    // number of zones a thread records in between. Rings live as long as the program, one per thread that
+    // ever recorded a zone, which suits the long-lived threads of an engine (main, render, job workers).
+    //
+    // Timestamps are TSC ticks on x86 (assumed invariant, as on every CPU of the last decade) and steady
+    // clock nanoseconds elsewhere, converted to microseconds when the trace is written
+    class Profiler
+    {
+    public:
+        static constexpr std::size_t buffer_capacity = ORION_PROFILE_BUFFER_CAPACITY;
+
+        // Never destroyed, so threads still running during static destruction keep a valid ring
+        [[nodiscard]] static Profiler& instance()
+        {
+            static auto* profiler = new Profiler();
+            return *profiler;
+        }
+
+        Profiler(const Profiler&) = delete;
+        Profiler(Profiler&&) = delete;
+        Profiler& operator=(const Profiler&) = delete;
+        Profiler& operator=(Profiler&&) = delete;
+
+        [[nodiscard]] static std::uint64_t now() noexcept
+        {
+#if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#else
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+        }
+
+        // Zones are recorded while enabled, the default. A disabled zone costs a relaxed load and a branch
+        static void set_enabled(bool enabled) noexcept { enabled_.store(enabled, std::memory_order_relaxed); }
+        [[nodiscard]] static bool is_enabled() noexcept { return enabled_.load(std::memory_order_relaxed); }
+
+        // Name of the calling thread in the trace
+        void set_thread_name(std::string_view name)
+        {
+            auto& buffer = thread_buffer();
+            const std::scoped_lock lock{mutex_};
+            buffer.name = name;
+        }
+
+        // Moves the zones buffered by every thread to events(), returns how many were moved
+        std::size_t collect()
+        {
+            const std::scoped_lock lock{mutex_};
+            return collect_locked();
+        }
+
+        // Zones collected so far, valid until the next call to collect() or clear() from any thread
+        [[nodiscard]] std::span<const ProfileEvent> events() const noexcept { return events_; }
+
+        // Zones dropped because the ring of their thread was full
+        [[nodiscard]] std::size_t dropped_events() const
+        {
+            const std::scoped_lock lock{mutex_};
+            std::size_t dropped = 0;
+            for (const auto& buffer : buffers_) {
+                dropped += buffer->dropped();
+            }
+            return dropped;
+        }
+
+        // Discards the collected zones and those still buffered
+        void clear()
+        {
+            const std::scoped_lock lock{mutex_};
+            collect_locked();
+            events_.clear();
+        }
+
+        // Collects and writes every zone as Chrome trace event JSON, which chrome://tracing and
+        // ui.perfetto.dev open. The collected zones are kept, call clear() to start a new capture
+        template<typename OutputIt>
+        OutputIt write_chrome_trace(OutputIt out)
+        {
+            const auto ticks_per_microsecond = calibrate();
+            const std::scoped_lock lock{mutex_};
+            collect_locked();
+
+            const auto microseconds = [&](std::uint64_t ticks) { return static_cast<double>(static_cast<std::int64_t>(ticks)) / ticks_per_microsecond; };
+            out = fmt::format_to(out, "{{\"traceEvents\":[");
+            bool first = true;
+            auto separate = [&]() {
+                if (!std::exchange(first, false)) {
+                    *out++ = ',';
+                }
+                *out++ = '\n';
+            };
+            for (const auto& buffer : buffers_) {
+                if (!buffer->name.empty()) {
+                    separate();
+                    out = fmt::format_to(out, "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},\"args\":{{\"name\":", buffer->thread());
+                    out = detail::write_json_string(out, buffer->name);
+                    out = fmt::format_to(out, "}}}}");
+                }
+            }
+            for (const auto& event : events_) {
+                separate();
+                out = fmt::format_to(out, "{{\"name\":");
+                out = detail::write_json_string(out, event.zone->name);
+                out = fmt::format_to(out, ",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":0,\"tid\":{},\"args\":{{\"file\":", microseconds(event.begin - origin_ticks_),
+                                     microseconds(event.end - event.begin), event.thread);
+                out = detail::write_json_string(out, event.zone->file);
+                out = fmt::format_to(out, ",\"line\":{}}}}}", event.zone->line);
+            }
+            return fmt::format_to(out, "\n]}}\n");
+        }
+
+        // Writes the trace to a file, false if it couldn't be written
+        bool save_chrome_trace(const char* path)
+        {
+            fmt::memory_buffer trace;
+            write_chrome_trace(std::back_inserter(trace));
+            auto* file = std::fopen(path, "wb");
+            if (file == nullptr) {
+                return false;
+            }
+            const bool written = std::fwrite(trace.data(), 1, trace.size(), file) == trace.size();
+            return std::fclose(file) == 0 && written;
+        }
+
+    private:
+        friend class ProfileScope;
+
+        // Long enough for a tick rate within a few parts per million
+        static constexpr std::chrono::milliseconds min_calibration_time{10};
+
+        Profiler()
+            : origin_ticks_(now())
+            , origin_time_(std::chrono::steady_clock::now())
+        {
+        }
+
+        // Ring of the calling thread, registered on first use
+        [[nodiscard]] static detail::ProfileBuffer& thread_buffer()
+        {
+            if (current_buffer_ == nullptr) [[unlikely]] {
+                current_buffer_ = &instance().add_thread();
+            }
+            return *current_buffer_;
+        }
+
+        [[gnu::noinline]] detail::ProfileBuffer& add_thread()
+        {
+            const std::scoped_lock lock{mutex_};
+            buffers_.push_back(std::make_unique<detail::ProfileBuffer>(static_cast<std::uint32_t>(buffers_.size() + 1)));
+            return *buffers_.back();
+        }
+
+        std::size_t collect_locked()
+        {
+            std::size_t collected = 0;
+            for (auto& buffer : buffers_) {
+                collected += buffer->drain(events_);
+            }
+            return collected;
+        }
+
+        // Ticks per microsecond measured against the steady clock since the profiler was created
+        double calibrate() const
+        {
+            auto elapsed = std::chrono::steady_clock::now() - origin_time_;
+            if (elapsed < min_calibration_time) {
+                std::this_thread::sleep_for(min_calibration_time - elapsed);
+            }
+            const auto ticks = now();
+            elapsed = std::chrono::steady_clock::now() - origin_time_;
+            return static_cast<double>(ticks - origin_ticks_) / std::chrono::duration<double, std::micro>(elapsed).count();
+        }
+
+        static inline std::atomic<bool> enabled_ = true;
+        static inline thread_local detail::ProfileBuffer* current_buffer_ = nullptr;
+
+        const std::uint64_t origin_ticks_;
+        const std::chrono::steady_clock::time_point origin_time_;
+        mutable std::mutex mutex_;
+        std::vector<std::unique_ptr<detail::ProfileBuffer>> buffers_; // Guarded by mutex_
+        std::vector<ProfileEvent> events_;                            // Guarded by mutex_
+    };
+
+    // Records the time from its construction to its destruction as a zone of the calling thread
+    class ProfileScope
+    {
+    public:
+        explicit ProfileScope(const ProfileZone& zone)
+            : zone_(&zone)
+            , buffer_(Profiler::is_enabled() ? &Profiler::thread_buffer() : nullptr)
+            , begin_(buffer_ != nullptr ? Profiler::now() : 0)
+        {
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+        ~ProfileScope()
+        {
+            if (buffer_ != nullptr) {
+                buffer_->record(*zone_, begin_, Profiler::now());
+            }
+        }
+
+    private:
+        const ProfileZone* zone_;
+        detail::ProfileBuffer* buffer_;
+        std::uint64_t begin_;
+    };
+} // namespace orion
+
+#define ORION_PROFILE_CONCAT_IMPL(a, b) a##b
+#define ORION_PROFILE_CONCAT(a, b) ORION_PROFILE_CONCAT_IMPL(a, b)
+
+// ORION_PROFILE_SCOPE("name") records the rest of the enclosing scope, the name must be a string literal.
+// The zone description is a static inside a lambda like the assertion records, the hot path only passes
+// its address
+#if ORION_PROFILING
+    #define ORION_PROFILE_SCOPE(name)                                                               \
+        const ::orion::ProfileScope ORION_PROFILE_CONCAT(orion_profile_scope_, __LINE__)            \
+        {                                                                                           \
+            []() -> const ::orion::ProfileZone& {                                                   \
+                static constexpr ::orion::ProfileZone orion_profile_zone{name, __FILE__, __LINE__}; \
+                return orion_profile_zone;                                                          \
+            }()                                                                                     \
+        }
+    #define ORION_PROFILE_THREAD_NAME(name) ::orion::Profiler::instance().set_thread_name(name)
+#else
+    #define ORION_PROFILE_SCOPE(name) ((void)0)
+    #define ORION_PROFILE_THREAD_NAME(name) ((void)0)
+#endif
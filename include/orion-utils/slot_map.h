@@ -0,0 +1,245 @@
+#pragma once
+
+#include "orion-utils/assertion.h"     // ORION_ASSERT
+#include "orion-utils/static_vector.h" // orion::static_vector
+
+#include <algorithm> // std::max
+#include <bit>       // std::bit_width
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t
+#include <span>      // std::span
+#include <utility>   // std::exchange, std::forward, std::move
+#include <vector>    // std::vector
+
+namespace orion
+{
+    // 32-bit reference to a slot map element: the slot index in the low IndexBits bits and the slot generation in
+    // the others. A default constructed handle never refers to an element
+    template<unsigned IndexBits>
+    class SlotHandle
+    {
+        static_assert(IndexBits > 0 && IndexBits < 32, "SlotHandle needs bits for both the index and the generation");
+
+    public:
+        static constexpr unsigned index_bits = IndexBits;
+        static constexpr unsigned generation_bits = 32 - IndexBits;
+        static constexpr std::uint32_t index_mask = (std::uint32_t{1} << index_bits) - 1;
+        static constexpr std::uint32_t generation_mask = (std::uint32_t{1} << generation_bits) - 1;
+
+        constexpr SlotHandle() = default;
+        constexpr SlotHandle(std::uint32_t index, std::uint32_t generation) noexcept
+            : value_(index | generation << index_bits)
+        {
+            ORION_ASSERT(index <= index_mask && generation <= generation_mask);
+        }
+
+        static constexpr SlotHandle from_value(std::uint32_t value) noexcept
+        {
+            SlotHandle handle;
+            handle.value_ = value;
+            return handle;
+        }
+
+        [[nodiscard]] constexpr std::uint32_t index() const noexcept { return value_ & index_mask; }
+        [[nodiscard]] constexpr std::uint32_t generation() const noexcept { return value_ >> index_bits; }
+        [[nodiscard]] constexpr std::uint32_t value() const noexcept { return value_; }
+        [[nodiscard]] constexpr bool is_null() const noexcept { return value_ == 0; }
+
+        constexpr bool operator==(const SlotHandle&) const noexcept = default;
+
+    private:
+        std::uint32_t value_ = 0;
+    };
+
+    namespace detail
+    {
+        template<std::size_t Capacity>
+        struct StaticSlotStorage {
+            template<typename T>
+            using vector_type = static_vector<T, Capacity>;
+
+            static constexpr unsigned index_bits = std::max(static_cast<unsigned>(std::bit_width(Capacity - 1)), 1u);
+            static constexpr std::size_t max_size = Capacity;
+        };
+
+        template<unsigned IndexBits>
+        struct DynamicSlotStorage {
+            template<typename T>
+            using vector_type = std::vector<T>;
+
+            static constexpr unsigned index_bits = IndexBits;
+            static constexpr std::size_t max_size = std::size_t{1} << IndexBits;
+        };
+
+        // Values are kept densely packed, iteration is a contiguous scan over them. Slots map handle indices
+        // to dense positions, erasing moves the last value into the hole and patches its slot.
+        //
+        // Generations start at 1 and are bumped on every erase so stale handles stop matching. A slot whose
+        // generation runs out is retired instead of being reused, it keeps generation 0 which no valid handle
+        // carries
+        template<typename T, typename Storage>
+        class SlotMap
+        {
+            struct Slot {
+                std::uint32_t generation;
+                std::uint32_t index; // Dense position while alive, next free slot otherwise
+            };
+
+            static constexpr std::uint32_t no_slot = ~std::uint32_t{0};
+
+        public:
+            using value_type = T;
+            using reference = value_type&;
+            using const_reference = const value_type&;
+            using pointer = value_type*;
+            using const_pointer = const value_type*;
+            using size_type = std::size_t;
+            using handle_type = SlotHandle<Storage::index_bits>;
+            using iterator = pointer;
+            using const_iterator = const_pointer;
+
+            template<typename... Args>
+            constexpr handle_type emplace(Args&&... args)
+            {
+                ORION_ASSERT(size() < max_size());
+                if (free_head_ == no_slot) {
+                    ORION_ASSERT(slots_.size() < max_size(), "every slot is taken or retired");
+                    slots_.push_back({.generation = 1, .index = no_slot});
+                    free_head_ = static_cast<std::uint32_t>(slots_.size() - 1);
+                }
+                const auto dense_index = static_cast<std::uint32_t>(values_.size());
+                values_.emplace_back(std::forward<Args>(args)...);
+                try {
+                    dense_to_slot_.push_back(free_head_);
+                } catch (...) {
+                    values_.pop_back();
+                    throw;
+                }
+
+                const auto slot_index = std::exchange(free_head_, slot(free_head_).index);
+                slot(slot_index).index = dense_index;
+                return handle_type{slot_index, slot(slot_index).generation};
+            }
+            constexpr handle_type insert(const_reference value) { return emplace(value); }
+            constexpr handle_type insert(value_type&& value) { return emplace(std::move(value)); }
+
+            // Returns false when the handle is stale
+            constexpr bool erase(handle_type handle)
+            {
+                if (!contains(handle)) {
+                    return false;
+                }
+                erase_dense(slot(handle.index()).index);
+                return true;
+            }
+            constexpr iterator erase(const_iterator position)
+            {
+                ORION_ASSERT(position >= begin() && position < end());
+                const auto dense_index = static_cast<std::uint32_t>(position - begin());
+                erase_dense(dense_index);
+                return begin() + dense_index;
+            }
+
+            constexpr void clear()
+            {
+                while (!empty()) {
+                    erase_dense(static_cast<std::uint32_t>(size() - 1));
+                }
+            }
+
+            [[nodiscard]] constexpr bool contains(handle_type handle) const noexcept
+            {
+                // Retired slots are left at generation 0, which would otherwise match the null handle
+                return handle.generation() != 0 && handle.index() < slots_.size() &&
+                       slot(handle.index()).generation == handle.generation();
+            }
+            // nullptr when the handle is stale
+            [[nodiscard]] constexpr pointer find(handle_type handle) noexcept
+            {
+                return contains(handle) ? values_.data() + slot(handle.index()).index : nullptr;
+            }
+            [[nodiscard]] constexpr const_pointer find(handle_type handle) const noexcept
+            {
+                return contains(handle) ? values_.data() + slot(handle.index()).index : nullptr;
+            }
+            [[nodiscard]] constexpr reference operator[](handle_type handle)
+            {
+                ORION_ASSERT(contains(handle));
+                return values_.data()[slot(handle.index()).index];
+            }
+            [[nodiscard]] constexpr const_reference operator[](handle_type handle) const
+            {
+                ORION_ASSERT(contains(handle));
+                return values_.data()[slot(handle.index()).index];
+            }
+
+            // Handle of the value at a dense position, for walking values and handles together
+            [[nodiscard]] constexpr handle_type handle_at(size_type dense_index) const noexcept
+            {
+                ORION_ASSERT(dense_index < size());
+                const auto slot_index = dense_to_slot_.data()[dense_index];
+                return handle_type{slot_index, slot(slot_index).generation};
+            }
+
+            [[nodiscard]] constexpr size_type size() const noexcept { return values_.size(); }
+            [[nodiscard]] constexpr bool empty() const noexcept { return values_.empty(); }
+            [[nodiscard]] static constexpr size_type max_size() noexcept { return Storage::max_size; }
+
+            constexpr void reserve(size_type count)
+                requires requires(typename Storage::template vector_type<T> vector) { vector.reserve(count); }
+            {
+                values_.reserve(count);
+                dense_to_slot_.reserve(count);
+                slots_.reserve(count);
+            }
+
+            [[nodiscard]] constexpr pointer data() noexcept { return values_.data(); }
+            [[nodiscard]] constexpr const_pointer data() const noexcept { return values_.data(); }
+            [[nodiscard]] constexpr std::span<value_type> values() noexcept { return {values_.data(), values_.size()}; }
+            [[nodiscard]] constexpr std::span<const value_type> values() const noexcept { return {values_.data(), values_.size()}; }
+
+            [[nodiscard]] constexpr iterator begin() noexcept { return values_.data(); }
+            [[nodiscard]] constexpr const_iterator begin() const noexcept { return values_.data(); }
+            [[nodiscard]] constexpr iterator end() noexcept { return values_.data() + values_.size(); }
+            [[nodiscard]] constexpr const_iterator end() const noexcept { return values_.data() + values_.size(); }
+
+        private:
+            // Indexes through data(), static_vector's operator[] takes its narrower size_type
+            constexpr Slot& slot(std::uint32_t index) noexcept { return slots_.data()[index]; }
+            constexpr const Slot& slot(std::uint32_t index) const noexcept { return slots_.data()[index]; }
+
+            constexpr void erase_dense(std::uint32_t dense_index)
+            {
+                const auto slot_index = dense_to_slot_.data()[dense_index];
+                const auto last = static_cast<std::uint32_t>(values_.size() - 1);
+                if (dense_index != last) {
+                    values_.data()[dense_index] = std::move(values_.data()[last]);
+                    dense_to_slot_.data()[dense_index] = dense_to_slot_.data()[last];
+                    slot(dense_to_slot_.data()[dense_index]).index = dense_index;
+                }
+                values_.pop_back();
+                dense_to_slot_.pop_back();
+
+                auto& freed = slot(slot_index);
+                freed.generation = (freed.generation + 1) & handle_type::generation_mask;
+                if (freed.generation != 0) {
+                    freed.index = free_head_;
+                    free_head_ = slot_index;
+                }
+            }
+
+            typename Storage::template vector_type<value_type> values_;
+            typename Storage::template vector_type<std::uint32_t> dense_to_slot_;
+            typename Storage::template vector_type<Slot> slots_;
+            std::uint32_t free_head_ = no_slot;
+        };
+    } // namespace detail
+
+    // Fixed capacity slot map, handles use just enough index bits for Capacity and the rest for the generation
+    template<typename T, std::size_t Capacity>
+    using slot_map = detail::SlotMap<T, detail::StaticSlotStorage<Capacity>>;
+
+    // Growable slot map, values move when the storage grows so only handles stay valid across inserts
+    template<typename T, unsigned IndexBits = 20>
+    using dynamic_slot_map = detail::SlotMap<T, detail::DynamicSlotStorage<IndexBits>>;
+} // namespace orion
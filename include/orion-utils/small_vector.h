@@ -0,0 +1,584 @@
+#pragma once
+
+#include "orion-utils/assertion.h"     // ORION_ASSERT
+#include "orion-utils/type.h"          // orion::min_unsigned_t
+#include "orion-utils/uninitialized.h" // orion::UninitializedStorage, orion::uninitialized_*, orion::is_trivially_relocatable
+
+#include <algorithm>        // std::max, std::min, std::equal, std::copy, std::fill_n, std::rotate
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint32_t
+#include <initializer_list> // std::initializer_list
+#include <iterator>         // std::reverse_iterator
+#include <limits>           // std::numeric_limits
+#include <memory>           // std::allocator, std::allocator_traits, std::destroy_n, std::destroy
+#include <ranges>           // std::ranges::input_range, std::ranges::subrange
+#include <type_traits>      // std::make_signed, std::is_*
+#include <utility>          // std::exchange
+
+namespace orion
+{
+    namespace detail
+    {
+        template<typename T, std::size_t InlineCapacity, typename Allocator>
+        class SmallVector
+        {
+            using allocator_traits = std::allocator_traits<Allocator>;
+
+            static_assert(InlineCapacity > 0, "Use std::vector if no elements should be stored inline");
+            static_assert(std::is_same_v<typename allocator_traits::pointer, T*>, "Fancy pointers are not supported");
+
+        public:
+            // Size and capacity are stored in 32 bits unless the inline capacity needs more,
+            // so the heap pointer, size and capacity fit in two words
+            static consteval auto find_min_size_type() noexcept
+            {
+                return min_unsigned_t<std::max<std::uintmax_t>(InlineCapacity, std::numeric_limits<std::uint32_t>::max())>{};
+            }
+
+            using value_type = T;
+            using allocator_type = Allocator;
+            using reference = value_type&;
+            using const_reference = const value_type&;
+            using pointer = value_type*;
+            using const_pointer = const value_type*;
+            using size_type = decltype(find_min_size_type());
+            using difference_type = std::make_signed_t<size_type>;
+            using iterator = pointer;
+            using const_iterator = const_pointer;
+            using reverse_iterator = std::reverse_iterator<iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+            constexpr SmallVector() noexcept(noexcept(allocator_type()))
+                : data_(elements_.data())
+            {
+            }
+
+            constexpr explicit SmallVector(const allocator_type& allocator) noexcept
+                : data_(elements_.data())
+                , allocator_(allocator)
+            {
+            }
+
+            constexpr explicit SmallVector(size_type n, const allocator_type& allocator = allocator_type())
+                requires std::is_default_constructible_v<value_type>
+                : SmallVector(allocator)
+            {
+                resize(n);
+            }
+
+            constexpr SmallVector(size_type n, const_reference value, const allocator_type& allocator = allocator_type())
+                requires std::is_copy_constructible_v<value_type>
+                : SmallVector(allocator)
+            {
+                assign(n, value);
+            }
+
+            template<std::input_iterator InputIt>
+            constexpr SmallVector(InputIt first, InputIt last, const allocator_type& allocator = allocator_type())
+                : SmallVector(allocator)
+            {
+                assign(first, last);
+            }
+
+            constexpr SmallVector(std::initializer_list<value_type> list, const allocator_type& allocator = allocator_type())
+                : SmallVector(allocator)
+            {
+                assign(list);
+            }
+
+            constexpr SmallVector(const SmallVector& other)
+                : SmallVector(allocator_traits::select_on_container_copy_construction(other.allocator_))
+            {
+                assign(other.begin(), other.end());
+            }
+
+            constexpr SmallVector(SmallVector&& other) noexcept(is_nothrow_relocatable())
+                : data_(elements_.data())
+                , allocator_(std::move(other.allocator_))
+            {
+                take_elements(other);
+            }
+
+            constexpr SmallVector& operator=(const SmallVector& other)
+            {
+                if (&other != this) {
+                    if constexpr (allocator_traits::propagate_on_container_copy_assignment::value) {
+                        if (allocator_ != other.allocator_) {
+                            // Memory from the current allocator can't be released by the new one
+                            clear();
+                            release_heap();
+                        }
+                        allocator_ = other.allocator_;
+                    }
+                    assign(other.begin(), other.end());
+                }
+                return *this;
+            }
+
+            constexpr SmallVector& operator=(SmallVector&& other) noexcept(is_nothrow_move_assignable())
+            {
+                if (&other != this) {
+                    clear();
+                    if (other.is_inline() || allocator_traits::propagate_on_container_move_assignment::value || allocator_ == other.allocator_) {
+                        release_heap();
+                        if constexpr (allocator_traits::propagate_on_container_move_assignment::value) {
+                            allocator_ = std::move(other.allocator_);
+                        }
+                        take_elements(other);
+                    } else {
+                        // The heap buffer of other belongs to an allocator we can't use, move element-wise
+                        reserve(other.size_);
+                        orion::uninitialized_move(other.begin(), other.end(), data_);
+                        size_ = other.size_;
+                        other.clear();
+                    }
+                }
+                return *this;
+            }
+
+            constexpr void assign(size_type count, const_reference value)
+            {
+                if (count > capacity_) {
+                    // Nothing to keep, value is copied first as it may refer to an element
+                    const value_type copy = value;
+                    clear();
+                    reserve(count);
+                    orion::uninitialized_fill(begin(), begin() + count, copy);
+                    size_ = count;
+                    return;
+                }
+                std::fill_n(begin(), std::min(count, size_), value);
+                if (count > size_) {
+                    orion::uninitialized_fill(end(), begin() + count, value);
+                } else {
+                    std::destroy(begin() + count, end());
+                }
+                size_ = count;
+            }
+            template<std::input_iterator InputIt>
+            constexpr void assign(InputIt first, InputIt last)
+            {
+                assign_range(std::ranges::subrange(first, last));
+            }
+            constexpr void assign(std::initializer_list<value_type> list)
+            {
+                assign(list.begin(), list.end());
+            }
+            template<std::ranges::input_range Range>
+            constexpr void assign_range(Range&& range)
+            {
+                if constexpr (std::ranges::forward_range<Range>) {
+                    // Checked before narrowing, a range longer than size_type can hold would wrap around
+                    const auto distance = static_cast<std::size_t>(std::ranges::distance(range));
+                    ORION_ASSERT(distance <= max_size());
+                    const auto count = static_cast<size_type>(distance);
+                    auto first = std::ranges::begin(range);
+                    if (count > capacity_) {
+                        clear();
+                        reserve(count);
+                    }
+                    auto mid = std::ranges::next(first, std::min(count, size_));
+                    std::copy(first, mid, begin());
+                    if (count > size_) {
+                        orion::uninitialized_copy(mid, std::ranges::next(mid, count - size_), end());
+                    } else {
+                        std::destroy(begin() + count, end());
+                    }
+                    size_ = count;
+                } else {
+                    clear();
+                    for (auto&& element : range) {
+                        emplace_back(std::forward<decltype(element)>(element));
+                    }
+                }
+            }
+
+            constexpr ~SmallVector()
+            {
+                clear();
+                release_heap();
+            }
+
+            [[nodiscard]] constexpr allocator_type get_allocator() const noexcept { return allocator_; }
+
+            [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+            [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+            [[nodiscard]] constexpr size_type max_size() const noexcept
+            {
+                return static_cast<size_type>(std::min<std::size_t>(std::numeric_limits<size_type>::max(),
+                                                                    allocator_traits::max_size(allocator_)));
+            }
+            [[nodiscard]] constexpr size_type capacity() const noexcept { return capacity_; }
+            [[nodiscard]] static constexpr size_type inline_capacity() noexcept { return InlineCapacity; }
+            [[nodiscard]] constexpr bool is_inline() const noexcept { return data_ == elements_.data(); }
+
+            [[nodiscard]] constexpr pointer data() noexcept { return data_; }
+            [[nodiscard]] constexpr const_pointer data() const noexcept { return data_; }
+
+            [[nodiscard]] constexpr iterator begin() noexcept { return data(); }
+            [[nodiscard]] constexpr const_iterator begin() const noexcept { return data(); }
+            [[nodiscard]] constexpr iterator end() noexcept { return data() + size_; }
+            [[nodiscard]] constexpr const_iterator end() const noexcept { return data() + size_; }
+            [[nodiscard]] constexpr reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+            [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+            [[nodiscard]] constexpr reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+            [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+            [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return data(); }
+            [[nodiscard]] constexpr const_iterator cend() const noexcept { return data() + size_; }
+            [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+            [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept { return rend(); }
+
+            [[nodiscard]] constexpr reference operator[](size_type n)
+            {
+                ORION_ASSERT(n < size());
+                return *(begin() + n);
+            }
+            [[nodiscard]] constexpr const_reference operator[](size_type n) const
+            {
+                ORION_ASSERT(n < size());
+                return *(begin() + n);
+            }
+            [[nodiscard]] constexpr reference front()
+            {
+                ORION_ASSERT(!empty());
+                return *begin();
+            }
+            [[nodiscard]] constexpr const_reference front() const
+            {
+                ORION_ASSERT(!empty());
+                return *begin();
+            }
+            [[nodiscard]] constexpr reference back()
+            {
+                ORION_ASSERT(!empty());
+                return *(end() - 1);
+            }
+            [[nodiscard]] constexpr const_reference back() const
+            {
+                ORION_ASSERT(!empty());
+                return *(end() - 1);
+            }
+
+            constexpr void reserve(size_type new_capacity)
+            {
+                if (new_capacity > capacity_) {
+                    reallocate(new_capacity);
+                }
+            }
+
+            // Moves the elements back inline if they fit, otherwise trims the heap buffer to size()
+            constexpr void shrink_to_fit()
+            {
+                if (is_inline() || size_ == capacity_) {
+                    return;
+                }
+                if (size_ <= InlineCapacity) {
+                    const auto heap = data_;
+                    const auto heap_capacity = capacity_;
+                    relocate(heap, heap + size_, elements_.data());
+                    allocator_traits::deallocate(allocator_, heap, heap_capacity);
+                    data_ = elements_.data();
+                    capacity_ = InlineCapacity;
+                } else {
+                    reallocate(size_);
+                }
+            }
+
+            constexpr void clear() noexcept
+            {
+                if constexpr (!std::is_trivially_destructible_v<value_type>) {
+                    std::destroy_n(begin(), size_);
+                }
+                size_ = 0;
+            }
+
+            constexpr void resize(size_type count)
+                requires std::is_default_constructible_v<value_type>
+            {
+                if (count > size_) {
+                    reserve(count);
+                    orion::uninitialized_default_construct(end(), begin() + count);
+                } else {
+                    std::destroy(begin() + count, end());
+                }
+                size_ = count;
+            }
+            constexpr void resize(size_type count, const_reference value)
+            {
+                if (count > size_) {
+                    // value may refer to an element that is about to be reallocated
+                    const value_type copy = value;
+                    reserve(count);
+                    orion::uninitialized_fill(end(), begin() + count, copy);
+                } else {
+                    std::destroy(begin() + count, end());
+                }
+                size_ = count;
+            }
+
+            template<typename... Args>
+            constexpr iterator emplace(const_iterator position, Args&&... args)
+            {
+                ORION_ASSERT(position >= begin() && position <= end());
+                if (position == end()) {
+                    return emplace_back(std::forward<Args>(args)...);
+                }
+                // args may refer to an element that is about to be shifted or reallocated
+                value_type value(std::forward<Args>(args)...);
+                return insert_gap(position, 1, [&](iterator where) {
+                    std::construct_at(where, std::move(value));
+                });
+            }
+            template<typename... Args>
+            constexpr iterator emplace_back(Args&&... args)
+            {
+                if (size_ == capacity_) {
+                    return grow_and_emplace_back(std::forward<Args>(args)...);
+                }
+                auto where = std::construct_at(end(), std::forward<Args>(args)...);
+                ++size_;
+                return where;
+            }
+
+            constexpr void push_back(const_reference value)
+            {
+                emplace_back(value);
+            }
+            constexpr void push_back(value_type&& value)
+            {
+                emplace_back(std::move(value));
+            }
+
+            constexpr iterator insert(const_iterator position, const_reference value)
+            {
+                return emplace(position, value);
+            }
+            constexpr iterator insert(const_iterator position, value_type&& value)
+            {
+                return emplace(position, std::move(value));
+            }
+            constexpr iterator insert(const_iterator position, size_type count, const_reference value)
+            {
+                // value may refer to an element that is about to be shifted or reallocated
+                const value_type copy = value;
+                return insert_gap(position, count, [&](iterator where) {
+                    orion::uninitialized_fill(where, where + count, copy);
+                });
+            }
+            template<std::input_iterator InputIt>
+            constexpr iterator insert(const_iterator position, InputIt first, InputIt last)
+            {
+                return insert_range(position, std::ranges::subrange(first, last));
+            }
+            constexpr iterator insert(const_iterator position, std::initializer_list<value_type> list)
+            {
+                return insert(position, list.begin(), list.end());
+            }
+            template<std::ranges::input_range Range>
+            constexpr iterator insert_range(const_iterator position, Range&& range)
+            {
+                if constexpr (std::ranges::forward_range<Range>) {
+                    const auto distance = static_cast<std::size_t>(std::ranges::distance(range));
+                    ORION_ASSERT(distance <= std::size_t{max_size()} - size());
+                    const auto count = static_cast<size_type>(distance);
+                    auto first = std::ranges::begin(range);
+                    auto last = std::ranges::next(first, count);
+                    return insert_gap(position, count, [&](iterator where) {
+                        orion::uninitialized_copy(first, last, where);
+                    });
+                } else {
+                    // Single pass ranges can't be measured up front, append and rotate into place instead
+                    const auto offset = position - begin();
+                    const auto old_size = size();
+                    for (auto&& element : range) {
+                        emplace_back(std::forward<decltype(element)>(element));
+                    }
+                    std::rotate(begin() + offset, begin() + old_size, end());
+                    return begin() + offset;
+                }
+            }
+            template<std::ranges::input_range Range>
+            constexpr void append_range(Range&& range)
+            {
+                insert_range(end(), std::forward<Range>(range));
+            }
+
+            constexpr iterator erase(const_iterator position)
+            {
+                ORION_ASSERT(position < end());
+                return erase(position, position + 1);
+            }
+            constexpr iterator erase(const_iterator first, const_iterator last)
+            {
+                ORION_ASSERT(first <= last && last <= end());
+                auto where = const_cast<iterator>(first);
+                auto gap_last = const_cast<iterator>(last);
+                if (where == gap_last) {
+                    return where;
+                }
+                std::destroy(where, gap_last);
+                detail::close_gap(where, gap_last, end());
+                size_ -= static_cast<size_type>(gap_last - where);
+                return where;
+            }
+
+            constexpr void pop_back()
+            {
+                erase(end() - 1);
+            }
+
+            [[nodiscard]] constexpr friend bool operator==(const SmallVector& lhs, const SmallVector& rhs)
+            {
+                return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+            }
+
+        private:
+            static consteval bool is_nothrow_relocatable() noexcept
+            {
+                return is_trivially_relocatable_v<value_type> || std::is_nothrow_move_constructible_v<value_type>;
+            }
+
+            // Buffers can always be stolen unless the allocators of both vectors may differ
+            static consteval bool is_nothrow_move_assignable() noexcept
+            {
+                return is_nothrow_relocatable() &&
+                       (allocator_traits::propagate_on_container_move_assignment::value ||
+                        allocator_traits::is_always_equal::value);
+            }
+
+            // Moves [first, last) to out and destroys the source. Types that may throw while moving are
+            // copied instead so the source is left untouched if that throws (same as std::move_if_noexcept)
+            static constexpr void relocate(pointer first, pointer last, pointer out)
+            {
+                if constexpr (is_nothrow_relocatable()) {
+                    orion::uninitialized_relocate(first, last, out);
+                } else if constexpr (std::is_copy_constructible_v<value_type>) {
+                    orion::uninitialized_copy(first, last, out);
+                    std::destroy(first, last);
+                } else {
+                    orion::uninitialized_move(first, last, out);
+                    std::destroy(first, last);
+                }
+            }
+
+            // Takes the elements of other, stealing its heap buffer if it has one. *this must be empty and inline
+            constexpr void take_elements(SmallVector& other)
+            {
+                if (!other.is_inline()) {
+                    data_ = std::exchange(other.data_, other.elements_.data());
+                    size_ = std::exchange(other.size_, size_type{0});
+                    capacity_ = std::exchange(other.capacity_, static_cast<size_type>(InlineCapacity));
+                } else if constexpr (is_trivially_relocatable_v<value_type>) {
+                    // Relocated elements are gone from other, which is left empty
+                    orion::uninitialized_relocate(other.begin(), other.end(), data_);
+                    size_ = std::exchange(other.size_, size_type{0});
+                } else {
+                    orion::uninitialized_move(other.begin(), other.end(), data_);
+                    size_ = other.size_;
+                }
+            }
+
+            // Returns the heap buffer to the allocator, all elements must have been destroyed or relocated
+            constexpr void release_heap() noexcept
+            {
+                if (!is_inline()) {
+                    allocator_traits::deallocate(allocator_, data_, capacity_);
+                    data_ = elements_.data();
+                    capacity_ = static_cast<size_type>(InlineCapacity);
+                }
+            }
+
+            [[nodiscard]] constexpr size_type next_capacity(size_type required) const noexcept
+            {
+                ORION_ASSERT(required <= max_size());
+                const auto maximum = max_size();
+                const auto doubled = capacity_ > maximum / 2 ? maximum : static_cast<size_type>(capacity_ * 2);
+                return std::max(doubled, required);
+            }
+
+            [[nodiscard]] constexpr pointer allocate(size_type count)
+            {
+                ORION_ASSERT(count <= max_size());
+                return allocator_traits::allocate(allocator_, count);
+            }
+
+            constexpr void adopt(pointer new_data, size_type new_capacity) noexcept
+            {
+                release_heap();
+                data_ = new_data;
+                capacity_ = new_capacity;
+            }
+
+            constexpr void reallocate(size_type new_capacity)
+            {
+                auto new_data = allocate(new_capacity);
+                try {
+                    relocate(begin(), end(), new_data);
+                } catch (...) {
+                    allocator_traits::deallocate(allocator_, new_data, new_capacity);
+                    throw;
+                }
+                adopt(new_data, new_capacity);
+            }
+
+            // Constructs the new element in the new buffer before relocating, args may refer to an element
+            template<typename... Args>
+            constexpr iterator grow_and_emplace_back(Args&&... args)
+            {
+                const auto new_capacity = next_capacity(static_cast<size_type>(size_ + 1));
+                auto new_data = allocate(new_capacity);
+                auto where = new_data + size_;
+                try {
+                    std::construct_at(where, std::forward<Args>(args)...);
+                } catch (...) {
+                    allocator_traits::deallocate(allocator_, new_data, new_capacity);
+                    throw;
+                }
+                try {
+                    relocate(begin(), end(), new_data);
+                } catch (...) {
+                    std::destroy_at(where);
+                    allocator_traits::deallocate(allocator_, new_data, new_capacity);
+                    throw;
+                }
+                adopt(new_data, new_capacity);
+                ++size_;
+                return where;
+            }
+
+            template<typename Construct>
+            constexpr iterator insert_gap(const_iterator position, size_type count, Construct&& construct)
+            {
+                ORION_ASSERT(position >= begin() && position <= end());
+                ORION_ASSERT(count <= max_size() - size());
+                const auto offset = position - begin();
+                if (count == 0) {
+                    return begin() + offset;
+                }
+                if (count > capacity_ - size_) {
+                    reallocate(next_capacity(static_cast<size_type>(size_ + count)));
+                }
+                auto where = begin() + offset;
+                detail::open_gap(where, end(), count);
+                try {
+                    construct(where);
+                } catch (...) {
+                    detail::close_gap(where, where + count, end() + count);
+                    throw;
+                }
+                size_ += count;
+                return where;
+            }
+
+            // Declared first so data_ can point into it during construction
+            UninitializedStorage<value_type, InlineCapacity> elements_{};
+            pointer data_;
+            size_type size_ = 0;
+            size_type capacity_ = InlineCapacity;
+            [[no_unique_address]] allocator_type allocator_{};
+        };
+    } // namespace detail
+
+    template<typename T, std::size_t InlineCapacity, typename Allocator = std::allocator<T>>
+    using small_vector = detail::SmallVector<T, InlineCapacity, Allocator>;
+} // namespace orion
@@ -0,0 +1,553 @@
+#pragma once
+
+#include "orion-utils/assertion.h"     // ORION_ASSERT
+#include "orion-utils/type.h"          // orion::cache_line_size
+#include "orion-utils/uninitialized.h" // orion::UninitializedStorage, orion::uninitialized_relocate
+
+#include <algorithm>   // std::max, std::move
+#include <array>       // std::array
+#include <concepts>    // std::same_as
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <iterator>    // std::random_access_iterator_tag
+#include <limits>      // std::numeric_limits
+#include <memory>      // std::construct_at, std::destroy_at, std::destroy
+#include <new>         // std::align_val_t
+#include <span>        // std::span
+#include <tuple>       // std::tuple, std::tuple_element_t, std::apply, std::get
+#include <type_traits> // std::conditional_t, std::is_nothrow_move_constructible_v
+#include <utility>     // std::index_sequence, std::forward, std::move, std::exchange, std::swap
+
+namespace orion
+{
+    namespace detail
+    {
+        // Columns start on their own cache line so a loop over one column never shares lines with another
+        template<typename T>
+        inline constexpr std::size_t soa_column_alignment = std::max(cache_line_size, alignof(T));
+
+        // Index of T in Types, T must appear exactly once
+        template<typename T, typename... Types>
+        consteval std::size_t soa_type_index() noexcept
+        {
+            constexpr std::array matches{std::same_as<T, Types>...};
+            std::size_t index = 0;
+            while (!matches[index]) {
+                ++index;
+            }
+            return index;
+        }
+
+        // Every column in one fixed array inside the container
+        template<std::size_t Capacity, typename... Types>
+        class StaticSoaStorage
+        {
+            template<typename T>
+            struct alignas(soa_column_alignment<T>) Column {
+                UninitializedStorage<T, Capacity> elements;
+            };
+
+        public:
+            static constexpr bool is_dynamic = false;
+
+            template<std::size_t I>
+            [[nodiscard]] auto* column() noexcept
+            {
+                return std::get<I>(columns_).elements.data();
+            }
+            template<std::size_t I>
+            [[nodiscard]] const auto* column() const noexcept
+            {
+                return std::get<I>(columns_).elements.data();
+            }
+
+            [[nodiscard]] static constexpr std::size_t capacity() noexcept { return Capacity; }
+            [[nodiscard]] static constexpr std::size_t max_size() noexcept { return Capacity; }
+
+        private:
+            std::tuple<Column<Types>...> columns_;
+        };
+
+        // Every column in a single heap allocation, one after the other
+        template<typename... Types>
+        class DynamicSoaStorage
+        {
+            static constexpr std::size_t buffer_alignment = std::max({soa_column_alignment<Types>...});
+
+        public:
+            static constexpr bool is_dynamic = true;
+
+            DynamicSoaStorage() = default;
+            DynamicSoaStorage(const DynamicSoaStorage&) = delete;
+            DynamicSoaStorage(DynamicSoaStorage&& other) noexcept
+                : buffer_(std::exchange(other.buffer_, nullptr))
+                , columns_(std::exchange(other.columns_, {}))
+                , capacity_(std::exchange(other.capacity_, 0))
+            {
+            }
+            DynamicSoaStorage& operator=(const DynamicSoaStorage&) = delete;
+            DynamicSoaStorage& operator=(DynamicSoaStorage&& other) noexcept
+            {
+                swap(other);
+                return *this;
+            }
+            // The owner destroys the elements first
+            ~DynamicSoaStorage() { deallocate(buffer_); }
+
+            template<std::size_t I>
+            [[nodiscard]] auto* column() noexcept
+            {
+                return std::get<I>(columns_);
+            }
+            template<std::size_t I>
+            [[nodiscard]] const auto* column() const noexcept
+            {
+                return std::get<I>(columns_);
+            }
+
+            [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+            [[nodiscard]] static constexpr std::size_t max_size() noexcept
+            {
+                return std::numeric_limits<std::ptrdiff_t>::max() / (sizeof(Types) + ...);
+            }
+
+            // Moves the first size elements of every column to a new allocation of capacity elements
+            void reallocate(std::size_t capacity, std::size_t size)
+            {
+                ORION_ASSERT(size <= capacity && capacity <= max_size());
+                auto* buffer = static_cast<std::byte*>(::operator new(buffer_size(capacity), std::align_val_t{buffer_alignment}));
+                std::tuple<Types*...> columns;
+                std::size_t offset = 0;
+                std::apply([&](auto*&... column) { ((column = place_column(column, buffer, offset, capacity)), ...); }, columns);
+                relocate_columns(columns, size, std::index_sequence_for<Types...>{});
+
+                deallocate(std::exchange(buffer_, buffer));
+                columns_ = columns;
+                capacity_ = capacity;
+            }
+
+            void swap(DynamicSoaStorage& other) noexcept
+            {
+                std::swap(buffer_, other.buffer_);
+                std::swap(columns_, other.columns_);
+                std::swap(capacity_, other.capacity_);
+            }
+
+        private:
+            static std::size_t align_up(std::size_t offset, std::size_t alignment) noexcept
+            {
+                return (offset + alignment - 1) / alignment * alignment;
+            }
+
+            static std::size_t buffer_size(std::size_t capacity) noexcept
+            {
+                std::size_t size = 0;
+                ((size = align_up(size, soa_column_alignment<Types>) + capacity * sizeof(Types)), ...);
+                return size;
+            }
+
+            template<typename T>
+            static T* place_column(T*, std::byte* buffer, std::size_t& offset, std::size_t capacity) noexcept
+            {
+                offset = align_up(offset, soa_column_alignment<T>);
+                auto* column = reinterpret_cast<T*>(buffer + offset);
+                offset += capacity * sizeof(T);
+                return column;
+            }
+
+            template<std::size_t... I>
+            void relocate_columns(const std::tuple<Types*...>& columns, std::size_t size, std::index_sequence<I...>) noexcept
+            {
+                (orion::uninitialized_relocate(std::get<I>(columns_), std::get<I>(columns_) + size, std::get<I>(columns)), ...);
+            }
+
+            static void deallocate(std::byte* buffer) noexcept
+            {
+                if (buffer != nullptr) {
+                    ::operator delete(buffer, std::align_val_t{buffer_alignment});
+                }
+            }
+
+            std::byte* buffer_ = nullptr;
+            std::tuple<Types*...> columns_{};
+            std::size_t capacity_ = 0;
+        };
+
+        // Struct-of-arrays vector: element i is the row formed by the i-th entry of every column. Each column is
+        // a contiguous, cache line aligned array, so a pass touching a few fields only streams those columns
+        // and column<I>() spans can be handed to vectorized loops.
+        //
+        // Rows are accessed through tuples of references, auto [position, velocity] = particles[i] binds
+        // directly to the stored fields
+        template<typename Storage, typename... Types>
+        class SoaVector
+        {
+            static_assert(sizeof...(Types) > 0, "SoaVector needs at least one column");
+            static_assert((std::is_nothrow_move_constructible_v<Types> && ...), "Growing and erasing relocate elements, moving must not throw");
+
+            template<bool Const>
+            class Iterator
+            {
+                using vector_type = std::conditional_t<Const, const SoaVector, SoaVector>;
+
+            public:
+                using iterator_category = std::random_access_iterator_tag;
+                using value_type = std::tuple<Types...>;
+                using difference_type = std::ptrdiff_t;
+                using reference = std::conditional_t<Const, std::tuple<const Types&...>, std::tuple<Types&...>>;
+
+                Iterator() = default;
+                Iterator(vector_type* vector, std::size_t index) noexcept
+                    : vector_(vector)
+                    , index_(index)
+                {
+                }
+                template<bool OtherConst>
+                    requires(Const && !OtherConst)
+                Iterator(const Iterator<OtherConst>& other) noexcept
+                    : vector_(other.vector_)
+                    , index_(other.index_)
+                {
+                }
+
+                reference operator*() const noexcept { return (*vector_)[index_]; }
+                reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+                Iterator& operator++() noexcept
+                {
+                    ++index_;
+                    return *this;
+                }
+                Iterator operator++(int) noexcept
+                {
+                    auto copy = *this;
+                    ++index_;
+                    return copy;
+                }
+                Iterator& operator--() noexcept
+                {
+                    --index_;
+                    return *this;
+                }
+                Iterator operator--(int) noexcept
+                {
+                    auto copy = *this;
+                    --index_;
+                    return copy;
+                }
+                Iterator& operator+=(difference_type n) noexcept
+                {
+                    index_ = static_cast<std::size_t>(static_cast<difference_type>(index_) + n);
+                    return *this;
+                }
+                Iterator& operator-=(difference_type n) noexcept { return *this += -n; }
+
+                friend Iterator operator+(Iterator iterator, difference_type n) noexcept { return iterator += n; }
+                friend Iterator operator+(difference_type n, Iterator iterator) noexcept { return iterator += n; }
+                friend Iterator operator-(Iterator iterator, difference_type n) noexcept { return iterator -= n; }
+                friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) noexcept
+                {
+                    return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+                }
+
+                bool operator==(const Iterator& rhs) const noexcept { return index_ == rhs.index_; }
+                auto operator<=>(const Iterator& rhs) const noexcept { return index_ <=> rhs.index_; }
+
+            private:
+                friend class SoaVector;
+                friend class Iterator<true>;
+
+                vector_type* vector_ = nullptr;
+                std::size_t index_ = 0;
+            };
+
+        public:
+            using value_type = std::tuple<Types...>;
+            using reference = std::tuple<Types&...>;
+            using const_reference = std::tuple<const Types&...>;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using iterator = Iterator<false>;
+            using const_iterator = Iterator<true>;
+
+            template<std::size_t I>
+            using column_type = std::tuple_element_t<I, value_type>;
+
+            static constexpr std::size_t column_count = sizeof...(Types);
+
+            SoaVector() = default;
+            // Delegates so that the destructor cleans up the rows copied so far if a copy throws
+            SoaVector(const SoaVector& other)
+                : SoaVector()
+            {
+                reserve_if_dynamic(other.size());
+                for (std::size_t index = 0; index < other.size(); ++index) {
+                    std::apply([this](const auto&... values) { emplace_back(values...); }, other[index]);
+                }
+            }
+            SoaVector(SoaVector&& other) noexcept
+            {
+                steal(std::move(other));
+            }
+            SoaVector& operator=(const SoaVector& other)
+            {
+                if (&other != this) {
+                    clear();
+                    reserve_if_dynamic(other.size());
+                    for (std::size_t index = 0; index < other.size(); ++index) {
+                        std::apply([this](const auto&... values) { emplace_back(values...); }, other[index]);
+                    }
+                }
+                return *this;
+            }
+            SoaVector& operator=(SoaVector&& other) noexcept
+            {
+                if (&other != this) {
+                    clear();
+                    steal(std::move(other));
+                }
+                return *this;
+            }
+            ~SoaVector() { clear(); }
+
+            // Capacity
+
+            [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+            [[nodiscard]] size_type size() const noexcept { return size_; }
+            [[nodiscard]] size_type capacity() const noexcept { return storage_.capacity(); }
+            [[nodiscard]] static constexpr size_type max_size() noexcept { return Storage::max_size(); }
+
+            void reserve(size_type count)
+                requires Storage::is_dynamic
+            {
+                if (count > capacity()) {
+                    storage_.reallocate(count, size_);
+                }
+            }
+
+            // Columns
+
+            template<std::size_t I>
+            [[nodiscard]] column_type<I>* data() noexcept
+            {
+                return storage_.template column<I>();
+            }
+            template<std::size_t I>
+            [[nodiscard]] const column_type<I>* data() const noexcept
+            {
+                return storage_.template column<I>();
+            }
+
+            template<std::size_t I>
+            [[nodiscard]] std::span<column_type<I>> column() noexcept
+            {
+                return {data<I>(), size_};
+            }
+            template<std::size_t I>
+            [[nodiscard]] std::span<const column_type<I>> column() const noexcept
+            {
+                return {data<I>(), size_};
+            }
+            // Column by type, for types that appear once
+            template<typename T>
+                requires((std::same_as<T, Types> + ...) == 1)
+            [[nodiscard]] std::span<T> column() noexcept
+            {
+                return column<soa_type_index<T, Types...>()>();
+            }
+            template<typename T>
+                requires((std::same_as<T, Types> + ...) == 1)
+            [[nodiscard]] std::span<const T> column() const noexcept
+            {
+                return column<soa_type_index<T, Types...>()>();
+            }
+
+            // Rows
+
+            [[nodiscard]] reference operator[](size_type index) noexcept
+            {
+                ORION_ASSERT(index < size_);
+                return row(index, std::index_sequence_for<Types...>{});
+            }
+            [[nodiscard]] const_reference operator[](size_type index) const noexcept
+            {
+                ORION_ASSERT(index < size_);
+                return row(index, std::index_sequence_for<Types...>{});
+            }
+            [[nodiscard]] reference front() noexcept { return (*this)[0]; }
+            [[nodiscard]] const_reference front() const noexcept { return (*this)[0]; }
+            [[nodiscard]] reference back() noexcept { return (*this)[size_ - 1]; }
+            [[nodiscard]] const_reference back() const noexcept { return (*this)[size_ - 1]; }
+
+            [[nodiscard]] iterator begin() noexcept { return {this, 0}; }
+            [[nodiscard]] const_iterator begin() const noexcept { return {this, 0}; }
+            [[nodiscard]] iterator end() noexcept { return {this, size_}; }
+            [[nodiscard]] const_iterator end() const noexcept { return {this, size_}; }
+            [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+            [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+            // Modifiers
+
+            // Takes one constructor argument per column
+            template<typename... Args>
+                requires(sizeof...(Args) == sizeof...(Types))
+            reference emplace_back(Args&&... args)
+            {
+                if (size_ == capacity()) {
+                    grow(size_ + 1);
+                }
+                construct_row(size_, std::index_sequence_for<Types...>{}, std::forward<Args>(args)...);
+                return (*this)[size_++];
+            }
+            void push_back(const value_type& value)
+            {
+                std::apply([this](const auto&... values) { emplace_back(values...); }, value);
+            }
+            void push_back(value_type&& value)
+            {
+                std::apply([this](auto&&... values) { emplace_back(std::move(values)...); }, value);
+            }
+
+            void pop_back() noexcept
+            {
+                ORION_ASSERT(!empty());
+                --size_;
+                destroy_rows(size_, size_ + 1);
+            }
+
+            // Removes a row keeping the order of the others, every following row is moved
+            iterator erase(const_iterator position)
+            {
+                ORION_ASSERT(position.index_ < size_);
+                for_each_column([this, index = position.index_](auto* column) {
+                    std::move(column + index + 1, column + size_, column + index);
+                });
+                pop_back();
+                return {this, position.index_};
+            }
+
+            // Removes a row in O(1) by relocating the last row into its place, doesn't keep the order
+            iterator erase_unordered(const_iterator position) noexcept
+            {
+                ORION_ASSERT(position.index_ < size_);
+                const auto index = position.index_;
+                const auto last = --size_;
+                for_each_column([index, last](auto* column) {
+                    std::destroy_at(column + index);
+                    if (index != last) {
+                        orion::uninitialized_relocate(column + last, column + last + 1, column + index);
+                    }
+                });
+                return {this, index};
+            }
+            iterator swap_remove(const_iterator position) noexcept
+            {
+                return erase_unordered(position);
+            }
+
+            void resize(size_type count)
+                requires(std::is_default_constructible_v<Types> && ...)
+            {
+                if (count < size_) {
+                    destroy_rows(count, size_);
+                    size_ = count;
+                    return;
+                }
+                if (count > capacity()) {
+                    grow(count);
+                }
+                for (; size_ < count; ++size_) {
+                    construct_row(size_, std::index_sequence_for<Types...>{}, Types{}...);
+                }
+            }
+
+            void clear() noexcept
+            {
+                destroy_rows(0, size_);
+                size_ = 0;
+            }
+
+        private:
+            template<std::size_t... I>
+            reference row(size_type index, std::index_sequence<I...>) noexcept
+            {
+                return {data<I>()[index]...};
+            }
+            template<std::size_t... I>
+            const_reference row(size_type index, std::index_sequence<I...>) const noexcept
+            {
+                return {data<I>()[index]...};
+            }
+
+            template<typename Fn>
+            void for_each_column(Fn&& fn)
+            {
+                for_each_column(fn, std::index_sequence_for<Types...>{});
+            }
+            template<typename Fn, std::size_t... I>
+            void for_each_column(Fn& fn, std::index_sequence<I...>)
+            {
+                (fn(data<I>()), ...);
+            }
+
+            // Constructs every column of the row, or none of them if a constructor throws
+            template<std::size_t... I, typename... Args>
+            void construct_row(size_type index, std::index_sequence<I...>, Args&&... args)
+            {
+                std::size_t constructed = 0;
+                try {
+                    ((std::construct_at(data<I>() + index, std::forward<Args>(args)), ++constructed), ...);
+                } catch (...) {
+                    ((I < constructed ? std::destroy_at(data<I>() + index) : void()), ...);
+                    throw;
+                }
+            }
+
+            void destroy_rows(size_type first, size_type last) noexcept
+            {
+                for_each_column([first, last](auto* column) { std::destroy(column + first, column + last); });
+            }
+
+            void grow(size_type count)
+            {
+                if constexpr (Storage::is_dynamic) {
+                    storage_.reallocate(std::max({count, 2 * capacity(), size_type{8}}), size_);
+                } else {
+                    ORION_ASSERT(count <= max_size(), "static_soa_vector is full");
+                }
+            }
+
+            void reserve_if_dynamic(size_type count)
+            {
+                if constexpr (Storage::is_dynamic) {
+                    reserve(count);
+                }
+            }
+
+            void steal(SoaVector&& other) noexcept
+            {
+                if constexpr (Storage::is_dynamic) {
+                    storage_.swap(other.storage_);
+                } else {
+                    relocate_rows_from(other, std::index_sequence_for<Types...>{});
+                }
+                size_ = std::exchange(other.size_, 0);
+            }
+            template<std::size_t... I>
+            void relocate_rows_from(SoaVector& other, std::index_sequence<I...>) noexcept
+            {
+                (orion::uninitialized_relocate(other.data<I>(), other.data<I>() + other.size_, data<I>()), ...);
+            }
+
+            Storage storage_;
+            size_type size_ = 0;
+        };
+    } // namespace detail
+
+    // Growable struct-of-arrays vector, every column lives in one allocation
+    template<typename... Types>
+    using soa_vector = detail::SoaVector<detail::DynamicSoaStorage<Types...>, Types...>;
+
+    // Fixed capacity struct-of-arrays vector stored inline
+    template<std::size_t Capacity, typename... Types>
+    using static_soa_vector = detail::SoaVector<detail::StaticSoaStorage<Capacity, Types...>, Types...>;
+} // namespace orion
@@ -0,0 +1,262 @@
+#pragma once
+
+#include "orion-utils/assertion.h"     // ORION_ASSERT
+#include "orion-utils/static_vector.h" // orion::detail::StaticVector
+#include "orion-utils/type.h"          // orion::to_underlying, orion::any_of
+#include "orion-utils/uninitialized.h" // orion::UninitializedStorage
+
+#include <algorithm>   // std::ranges::sort, std::min, std::copy_n
+#include <array>       // std::array
+#include <bit>         // std::bit_cast
+#include <concepts>    // std::unsigned_integral, std::signed_integral, std::floating_point
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint8_t, std::uint32_t, std::uint64_t
+#include <functional>  // std::invoke, std::identity, std::ranges::less
+#include <iterator>    // std::sortable
+#include <limits>      // std::numeric_limits
+#include <memory>      // std::construct_at
+#include <ranges>      // std::ranges::contiguous_range, std::ranges::data, std::ranges::size
+#include <span>        // std::span
+#include <type_traits> // std::is_trivially_copyable_v, std::make_unsigned_t, std::is_enum_v
+#include <utility>     // std::index_sequence, std::make_index_sequence, std::exchange, std::swap, std::declval
+
+namespace orion
+{
+    namespace detail
+    {
+        // Maps a key to an unsigned integer with the same order, so radix sort can compare keys digit by digit.
+        // Signed integers get their sign bit flipped, negative floats all their bits and positive ones the sign bit
+        template<typename Key>
+        [[nodiscard]] constexpr auto to_radix_key(Key key) noexcept
+        {
+            if constexpr (std::is_enum_v<Key>) {
+                return detail::to_radix_key(to_underlying(key));
+            } else if constexpr (std::unsigned_integral<Key>) {
+                return key;
+            } else if constexpr (std::signed_integral<Key>) {
+                using Unsigned = std::make_unsigned_t<Key>;
+                constexpr auto sign = static_cast<Unsigned>(Unsigned{1} << (std::numeric_limits<Unsigned>::digits - 1));
+                return static_cast<Unsigned>(static_cast<Unsigned>(key) ^ sign);
+            } else {
+                static_assert(std::floating_point<Key> && std::numeric_limits<Key>::is_iec559 && (sizeof(Key) == 4 || sizeof(Key) == 8));
+                using Unsigned = std::conditional_t<sizeof(Key) == 4, std::uint32_t, std::uint64_t>;
+                constexpr auto sign = Unsigned{1} << (std::numeric_limits<Unsigned>::digits - 1);
+                const auto bits = std::bit_cast<Unsigned>(key);
+                return (bits & sign) != 0 ? static_cast<Unsigned>(~bits) : static_cast<Unsigned>(bits | sign);
+            }
+        }
+
+        template<typename Key>
+        concept radix_key = (std::is_enum_v<Key> || std::integral<Key> || std::floating_point<Key>) && !std::same_as<Key, bool>;
+
+        template<typename T, typename Projection>
+        concept radix_sortable = std::is_trivially_copyable_v<T> &&
+                                 radix_key<std::remove_cvref_t<std::invoke_result_t<Projection&, const T&>>>;
+
+        // 11-bit digits sort 32-bit keys in three passes, the 2048 buckets per pass still fit in L1.
+        // Wider keys use bytes to keep the histograms of all passes small
+        template<typename RadixKey>
+        inline constexpr std::size_t radix_digit_bits = std::numeric_limits<RadixKey>::digits == 32 ? 11 : 8;
+
+        // Stable LSD radix sort of [data, data + size), ping-ponging between data and scratch. The histograms
+        // of every digit are counted in one read of the input, passes where all keys share the digit are skipped
+        template<typename T, typename Projection>
+        void radix_sort(T* data, T* scratch, std::size_t size, Projection& projection)
+        {
+            using RadixKey = decltype(detail::to_radix_key(std::invoke(projection, *data)));
+            constexpr std::size_t key_bits = std::numeric_limits<RadixKey>::digits;
+            constexpr std::size_t digit_bits = radix_digit_bits<RadixKey>;
+            constexpr std::size_t pass_count = (key_bits + digit_bits - 1) / digit_bits;
+            constexpr std::size_t bucket_count = std::size_t{1} << digit_bits;
+            constexpr auto digit_mask = static_cast<RadixKey>(bucket_count - 1);
+
+            ORION_ASSERT(size <= std::numeric_limits<std::uint32_t>::max(), "radix_sort counts elements in 32 bits");
+            auto key_of = [&projection](const T& element) { return detail::to_radix_key(std::invoke(projection, element)); };
+            auto digit = [](RadixKey key, std::size_t pass) { return static_cast<std::size_t>((key >> (pass * digit_bits)) & digit_mask); };
+
+            std::array<std::array<std::uint32_t, bucket_count>, pass_count> counts{};
+            for (std::size_t i = 0; i < size; ++i) {
+                const auto key = key_of(data[i]);
+                for (std::size_t pass = 0; pass < pass_count; ++pass) {
+                    ++counts[pass][digit(key, pass)];
+                }
+            }
+
+            const auto first_key = key_of(data[0]);
+            T* source = data;
+            T* destination = scratch;
+            for (std::size_t pass = 0; pass < pass_count; ++pass) {
+                auto& offsets = counts[pass];
+                if (offsets[digit(first_key, pass)] == size) {
+                    continue;
+                }
+                std::uint32_t offset = 0;
+                for (auto& count : offsets) {
+                    offset += std::exchange(count, offset);
+                }
+                for (std::size_t i = 0; i < size; ++i) {
+                    std::construct_at(destination + offsets[digit(key_of(source[i]), pass)]++, source[i]);
+                }
+                std::swap(source, destination);
+            }
+            if (source != data) {
+                std::copy_n(source, size, data);
+            }
+        }
+
+        struct Comparator {
+            std::uint8_t first;
+            std::uint8_t second;
+        };
+
+        // Sorting networks from Batcher's odd-even merge sort over 32 inputs. Every comparator puts the
+        // smaller element at the lower index, so dropping the ones that touch inputs past n leaves a network
+        // sorting n inputs: the missing inputs act as +infinity, which no comparator would move
+        inline constexpr std::size_t max_network_size = 32;
+
+        template<typename Add>
+        constexpr void odd_even_merge_network(Add add)
+        {
+            constexpr std::size_t n = max_network_size;
+            for (std::size_t p = 1; p < n; p *= 2) {
+                for (std::size_t k = p; k >= 1; k /= 2) {
+                    for (std::size_t j = k % p; j + k < n; j += 2 * k) {
+                        for (std::size_t i = 0; i < std::min(k, n - j - k); ++i) {
+                            if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                                add(i + j, i + j + k);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        template<std::size_t N>
+        consteval auto make_network()
+        {
+            constexpr auto count = []() {
+                std::size_t result = 0;
+                detail::odd_even_merge_network([&result](std::size_t, std::size_t second) { result += second < N ? 1 : 0; });
+                return result;
+            }();
+            std::array<Comparator, count> network{};
+            std::size_t index = 0;
+            detail::odd_even_merge_network([&](std::size_t first, std::size_t second) {
+                if (second < N) {
+                    network[index++] = Comparator{static_cast<std::uint8_t>(first), static_cast<std::uint8_t>(second)};
+                }
+            });
+            return network;
+        }
+
+        template<std::size_t N>
+        inline constexpr auto sorting_network = make_network<N>();
+
+        // Both elements are read before either is written and selected without a branch, compilers emit
+        // conditional moves for small types
+        template<typename T, typename Compare, typename Projection>
+        inline void compare_exchange(T& lhs, T& rhs, Compare& compare, Projection& projection)
+        {
+            const T first = lhs;
+            const T second = rhs;
+            const bool swap = std::invoke(compare, std::invoke(projection, second), std::invoke(projection, first));
+            lhs = swap ? second : first;
+            rhs = swap ? first : second;
+        }
+
+        template<std::size_t N, typename T, typename Compare, typename Projection>
+        void sort_network(T* data, Compare& compare, Projection& projection)
+        {
+            // Unrolled, every comparator is a pair of constant indices
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                (detail::compare_exchange(data[sorting_network<N>[I].first], data[sorting_network<N>[I].second], compare, projection), ...);
+            }(std::make_index_sequence<sorting_network<N>.size()>{});
+        }
+
+        // Sorts up to max_network_size elements through the network for exactly that size
+        template<typename T, typename Compare, typename Projection>
+        void sort_small(T* data, std::size_t size, Compare& compare, Projection& projection)
+        {
+            ORION_ASSERT(size <= max_network_size);
+            using Sort = void (*)(T*, Compare&, Projection&);
+            static constexpr auto networks = []<std::size_t... N>(std::index_sequence<N...>) {
+                return std::array<Sort, sizeof...(N)>{&detail::sort_network<N, T, Compare, Projection>...};
+            }(std::make_index_sequence<max_network_size + 1>{});
+            networks[size](data, compare, projection);
+        }
+
+        // Networks copy every element they compare, types larger than a register are left to std::sort
+        template<typename T>
+        concept network_sortable = std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(std::uint64_t);
+
+        template<typename Compare>
+        concept ascending = any_of<Compare, std::ranges::less, std::less<>>;
+
+        // Below this many elements clearing and summing the histograms costs more than std::sort saves.
+        // Measured on random keys, 64-bit keys need twice the elements to make up for their eight passes
+        template<typename RadixKey>
+        inline constexpr std::size_t min_radix_size = std::numeric_limits<RadixKey>::digits <= 16 ? 128 : std::numeric_limits<RadixKey>::digits <= 32 ? 1024 : 2048;
+
+        // Largest scratch buffer radix_sort puts on the stack for a static_vector
+        inline constexpr std::size_t max_inline_scratch_bytes = 128 * 1024;
+    } // namespace detail
+
+    // Stable LSD radix sort by the key projection returns, which must be an integer, enum or floating point.
+    // scratch must hold at least as many elements as range. Elements are copied between both, so they must
+    // be trivially copyable
+    template<std::ranges::contiguous_range Range, typename Projection = std::identity>
+        requires std::ranges::sized_range<Range> && detail::radix_sortable<std::ranges::range_value_t<Range>, Projection>
+    void radix_sort(Range&& range, std::span<std::ranges::range_value_t<Range>> scratch, Projection projection = {})
+    {
+        const auto size = std::ranges::size(range);
+        ORION_ASSERT(scratch.size() >= size, "radix_sort needs {} scratch elements, got {}", size, scratch.size());
+        if (size > 1) {
+            detail::radix_sort(std::ranges::data(range), scratch.data(), size, projection);
+        }
+    }
+
+    // Same as above with the scratch buffer in inline storage on the stack
+    template<typename T, std::size_t Capacity, typename Projection = std::identity>
+        requires detail::radix_sortable<T, Projection>
+    void radix_sort(detail::StaticVector<T, Capacity>& vector, Projection projection = {})
+    {
+        static_assert(sizeof(T) * Capacity <= detail::max_inline_scratch_bytes, "Scratch buffer too large for the stack, pass one to radix_sort");
+        UninitializedStorage<T, Capacity> scratch;
+        if (vector.size() > 1) {
+            detail::radix_sort(vector.data(), scratch.data(), vector.size(), projection);
+        }
+    }
+
+    // std::ranges::sort with sorting networks for up to 32 small trivially copyable elements, where
+    // its insertion sort pays for a mispredicted branch on about every comparison
+    template<std::ranges::random_access_range Range, typename Compare = std::ranges::less, typename Projection = std::identity>
+        requires std::sortable<std::ranges::iterator_t<Range>, Compare, Projection>
+    void sort(Range&& range, Compare compare = {}, Projection projection = {})
+    {
+        using value_type = std::ranges::range_value_t<Range>;
+        if constexpr (std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range> && detail::network_sortable<value_type>) {
+            const auto size = static_cast<std::size_t>(std::ranges::size(range));
+            if (size <= detail::max_network_size) {
+                detail::sort_small(std::ranges::data(range), size, compare, projection);
+                return;
+            }
+        }
+        std::ranges::sort(range, compare, projection);
+    }
+
+    // Ascending sorts of static_vectors by a numeric key go through radix_sort once they are large enough,
+    // with the scratch buffer on the stack
+    template<typename T, std::size_t Capacity, typename Compare = std::ranges::less, typename Projection = std::identity>
+        requires std::sortable<T*, Compare, Projection>
+    void sort(detail::StaticVector<T, Capacity>& vector, Compare compare = {}, Projection projection = {})
+    {
+        if constexpr (detail::ascending<Compare> && detail::radix_sortable<T, Projection> && sizeof(T) * Capacity <= detail::max_inline_scratch_bytes) {
+            using RadixKey = decltype(detail::to_radix_key(std::invoke(projection, std::declval<const T&>())));
+            if (vector.size() >= detail::min_radix_size<RadixKey>) {
+                orion::radix_sort(vector, projection);
+                return;
+            }
+        }
+        orion::sort(std::span<T>{vector.data(), vector.size()}, compare, projection);
+    }
+} // namespace orion
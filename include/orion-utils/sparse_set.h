@@ -0,0 +1,287 @@
+#pragma once
+
+#include "orion-utils/assertion.h" // ORION_ASSERT
+#include "orion-utils/type.h"      // orion::to_underlying
+
+#include <algorithm>   // std::sort
+#include <array>       // std::array
+#include <concepts>    // std::unsigned_integral
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t
+#include <memory>      // std::unique_ptr, std::make_unique
+#include <numeric>     // std::iota
+#include <span>        // std::span
+#include <tuple>       // std::tuple, std::apply, std::get
+#include <type_traits> // std::is_enum_v, std::underlying_type_t, std::remove_const_t
+#include <utility>     // std::forward, std::move, std::swap, std::index_sequence
+#include <vector>      // std::vector
+
+namespace orion
+{
+    // Unsigned integer or enum with an unsigned underlying type, the value is used as an index
+    template<typename Entity>
+    concept sparse_set_entity = std::unsigned_integral<Entity> || (std::is_enum_v<Entity> && std::unsigned_integral<std::underlying_type_t<Entity>>);
+
+    namespace detail
+    {
+        // Maps entities to values with O(1) insert, erase and lookup while keeping the values densely packed.
+        //
+        // The sparse array maps an entity to its dense position and is allocated in pages of PageSize entries,
+        // so large but clustered entity ranges only pay for the pages they touch. Values and their entities
+        // live in parallel dense arrays, erasing moves the last element into the hole
+        template<sparse_set_entity Entity, typename T, std::size_t PageSize = 4096>
+        class SparseSet
+        {
+            static_assert(PageSize > 0 && (PageSize & (PageSize - 1)) == 0, "SparseSet page size must be a power of two");
+
+            using Page = std::array<std::uint32_t, PageSize>;
+
+        public:
+            using entity_type = Entity;
+            using value_type = T;
+            using reference = value_type&;
+            using const_reference = const value_type&;
+            using pointer = value_type*;
+            using const_pointer = const value_type*;
+            using size_type = std::size_t;
+            using iterator = pointer;
+            using const_iterator = const_pointer;
+
+            static constexpr std::size_t page_size = PageSize;
+            static constexpr std::uint32_t npos = ~std::uint32_t{0};
+
+            template<typename... Args>
+            reference emplace(entity_type entity, Args&&... args)
+            {
+                ORION_ASSERT(!contains(entity));
+                auto& sparse = sparse_entry(entity);
+                values_.emplace_back(std::forward<Args>(args)...);
+                try {
+                    entities_.push_back(entity);
+                } catch (...) {
+                    values_.pop_back();
+                    throw;
+                }
+                sparse = static_cast<std::uint32_t>(values_.size() - 1);
+                return values_.back();
+            }
+            reference insert(entity_type entity, const_reference value) { return emplace(entity, value); }
+            reference insert(entity_type entity, value_type&& value) { return emplace(entity, std::move(value)); }
+
+            // Swaps the last element into the hole, returns false when the entity isn't in the set
+            bool erase(entity_type entity)
+            {
+                const auto dense_index = index_of(entity);
+                if (dense_index == npos) {
+                    return false;
+                }
+                const auto last = values_.size() - 1;
+                if (dense_index != last) {
+                    values_[dense_index] = std::move(values_[last]);
+                    entities_[dense_index] = entities_[last];
+                    *find_sparse(entities_[dense_index]) = dense_index;
+                }
+                values_.pop_back();
+                entities_.pop_back();
+                *find_sparse(entity) = npos;
+                return true;
+            }
+
+            // Keeps the allocated pages
+            void clear() noexcept
+            {
+                for (auto entity : entities_) {
+                    *find_sparse(entity) = npos;
+                }
+                values_.clear();
+                entities_.clear();
+            }
+
+            void reserve(size_type count)
+            {
+                values_.reserve(count);
+                entities_.reserve(count);
+            }
+
+            [[nodiscard]] bool contains(entity_type entity) const noexcept { return index_of(entity) != npos; }
+            [[nodiscard]] pointer find(entity_type entity) noexcept
+            {
+                const auto dense_index = index_of(entity);
+                return dense_index != npos ? values_.data() + dense_index : nullptr;
+            }
+            [[nodiscard]] const_pointer find(entity_type entity) const noexcept
+            {
+                const auto dense_index = index_of(entity);
+                return dense_index != npos ? values_.data() + dense_index : nullptr;
+            }
+            [[nodiscard]] reference operator[](entity_type entity)
+            {
+                ORION_ASSERT(contains(entity));
+                return values_[index_of(entity)];
+            }
+            [[nodiscard]] const_reference operator[](entity_type entity) const
+            {
+                ORION_ASSERT(contains(entity));
+                return values_[index_of(entity)];
+            }
+
+            // Dense position of the entity, npos when it isn't in the set
+            [[nodiscard]] std::uint32_t index_of(entity_type entity) const noexcept
+            {
+                const auto* sparse = find_sparse(entity);
+                return sparse != nullptr ? *sparse : npos;
+            }
+
+            [[nodiscard]] size_type size() const noexcept { return values_.size(); }
+            [[nodiscard]] bool empty() const noexcept { return values_.empty(); }
+
+            [[nodiscard]] std::span<const entity_type> entities() const noexcept { return entities_; }
+            [[nodiscard]] std::span<value_type> values() noexcept { return values_; }
+            [[nodiscard]] std::span<const value_type> values() const noexcept { return values_; }
+
+            [[nodiscard]] iterator begin() noexcept { return values_.data(); }
+            [[nodiscard]] const_iterator begin() const noexcept { return values_.data(); }
+            [[nodiscard]] iterator end() noexcept { return values_.data() + values_.size(); }
+            [[nodiscard]] const_iterator end() const noexcept { return values_.data() + values_.size(); }
+
+            // Sorts the dense arrays with compare(lhs_entity, rhs_entity)
+            template<typename Compare>
+            void sort(Compare compare)
+            {
+                std::vector<std::uint32_t> order(size());
+                std::iota(order.begin(), order.end(), std::uint32_t{0});
+                std::sort(order.begin(), order.end(), [this, &compare](std::uint32_t lhs, std::uint32_t rhs) {
+                    return compare(entities_[lhs], entities_[rhs]);
+                });
+                // Walk every cycle of the permutation so each element is moved into place once
+                for (std::uint32_t i = 0; i < order.size(); ++i) {
+                    auto current = i;
+                    auto next = order[current];
+                    while (next != i) {
+                        swap_dense(current, next);
+                        order[current] = current;
+                        current = next;
+                        next = order[current];
+                    }
+                    order[current] = current;
+                }
+            }
+
+            // Moves the entities shared with other to the front, in the order other stores them. Iterating the
+            // shared part of both sets then walks both dense arrays front to back
+            template<typename U, std::size_t OtherPageSize>
+            void sort_as(const SparseSet<Entity, U, OtherPageSize>& other)
+            {
+                std::uint32_t position = 0;
+                for (auto entity : other.entities()) {
+                    const auto dense_index = index_of(entity);
+                    if (dense_index != npos) {
+                        swap_dense(position++, dense_index);
+                    }
+                }
+            }
+
+        private:
+            static std::size_t to_index(entity_type entity) noexcept
+            {
+                if constexpr (std::is_enum_v<entity_type>) {
+                    return static_cast<std::size_t>(to_underlying(entity));
+                } else {
+                    return static_cast<std::size_t>(entity);
+                }
+            }
+
+            std::uint32_t* find_sparse(entity_type entity) const noexcept
+            {
+                const auto index = to_index(entity);
+                const auto page = index / page_size;
+                return page < pages_.size() && pages_[page] != nullptr ? pages_[page]->data() + index % page_size : nullptr;
+            }
+
+            std::uint32_t& sparse_entry(entity_type entity)
+            {
+                const auto index = to_index(entity);
+                const auto page = index / page_size;
+                if (page >= pages_.size()) {
+                    pages_.resize(page + 1);
+                }
+                if (pages_[page] == nullptr) {
+                    pages_[page] = std::make_unique<Page>();
+                    pages_[page]->fill(npos);
+                }
+                return (*pages_[page])[index % page_size];
+            }
+
+            void swap_dense(std::uint32_t lhs, std::uint32_t rhs)
+            {
+                if (lhs == rhs) {
+                    return;
+                }
+                using std::swap;
+                swap(values_[lhs], values_[rhs]);
+                swap(entities_[lhs], entities_[rhs]);
+                *find_sparse(entities_[lhs]) = lhs;
+                *find_sparse(entities_[rhs]) = rhs;
+            }
+
+            std::vector<std::unique_ptr<Page>> pages_;
+            std::vector<entity_type> entities_;
+            std::vector<value_type> values_;
+        };
+
+        // Entities present in every set. Iterates the smallest set and probes the others
+        template<typename Entity, typename... Sets>
+        class SparseSetView
+        {
+        public:
+            explicit SparseSetView(Sets&... sets) noexcept
+                : sets_(sets...)
+            {
+            }
+
+            // Calls fn(entity, values...) for every entity in all sets, values in the order the sets were given
+            template<typename Fn>
+            void each(Fn&& fn) const
+            {
+                each(fn, std::index_sequence_for<Sets...>{});
+            }
+
+            // Upper bound of the number of entities each() visits
+            [[nodiscard]] std::size_t size_hint() const noexcept { return smallest_entities().size(); }
+
+        private:
+            template<typename Fn, std::size_t... I>
+            void each(Fn& fn, std::index_sequence<I...>) const
+            {
+                std::array<std::uint32_t, sizeof...(Sets)> indices{};
+                for (auto entity : smallest_entities()) {
+                    // Stops probing at the first set without the entity
+                    if ((((indices[I] = std::get<I>(sets_).index_of(entity)) != npos) && ...)) {
+                        fn(entity, std::get<I>(sets_).values()[indices[I]]...);
+                    }
+                }
+            }
+
+            std::span<const Entity> smallest_entities() const noexcept
+            {
+                auto smallest = std::get<0>(sets_).entities();
+                std::apply([&smallest](const auto&... sets) { ((smallest = sets.size() < smallest.size() ? sets.entities() : smallest), ...); }, sets_);
+                return smallest;
+            }
+
+            static constexpr std::uint32_t npos = ~std::uint32_t{0};
+
+            std::tuple<Sets&...> sets_;
+        };
+    } // namespace detail
+
+    template<sparse_set_entity Entity, typename T, std::size_t PageSize = 4096>
+    using sparse_set = detail::SparseSet<Entity, T, PageSize>;
+
+    // Joins sparse sets over the same entity type
+    template<typename Set, typename... Sets>
+    auto view(Set& set, Sets&... sets)
+    {
+        return detail::SparseSetView<typename std::remove_const_t<Set>::entity_type, Set, Sets...>(set, sets...);
+    }
+} // namespace orion
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "orion-utils/type.h"          // orion::cache_line_size
+#include "orion-utils/uninitialized.h" // orion::UninitializedStorage
+
+#include <algorithm> // std::min
+#include <atomic>    // std::atomic
+#include <cstddef>   // std::size_t
+#include <iterator>  // std::input_iterator, std::output_iterator
+#include <memory>    // std::construct_at, std::destroy_at
+#include <optional>  // std::optional
+#include <utility>   // std::move, std::forward
+
+namespace orion
+{
+    namespace detail
+    {
+        // Wait-free ring buffer for exactly one producer thread and one consumer thread.
+        // Each side keeps a private copy of the other side's index and only reloads the shared one when the
+        // copy runs out of free slots (producer) or elements (consumer), so in steady state neither side reads
+        // the cache line the other one writes
+        template<typename T, std::size_t Capacity>
+        class SpscQueue
+        {
+            static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+        public:
+            using value_type = T;
+            using size_type = std::size_t;
+
+            SpscQueue() = default;
+            SpscQueue(const SpscQueue&) = delete;
+            SpscQueue(SpscQueue&&) = delete;
+            SpscQueue& operator=(const SpscQueue&) = delete;
+            SpscQueue& operator=(SpscQueue&&) = delete;
+
+            ~SpscQueue()
+            {
+                const auto tail = tail_.load(std::memory_order_relaxed);
+                for (auto head = head_.load(std::memory_order_relaxed); head != tail; ++head) {
+                    std::destroy_at(slot(head));
+                }
+            }
+
+            // Producer side
+
+            template<typename... Args>
+            [[nodiscard]] bool try_emplace(Args&&... args)
+            {
+                const auto tail = tail_.load(std::memory_order_relaxed);
+                if (free_slots(tail, 1) == 0) {
+                    return false;
+                }
+                std::construct_at(slot(tail), std::forward<Args>(args)...);
+                tail_.store(tail + 1, std::memory_order_release);
+                return true;
+            }
+
+            [[nodiscard]] bool try_push(const value_type& value) { return try_emplace(value); }
+            [[nodiscard]] bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+
+            // Pushes up to count elements read from first and publishes them together, returns how many were pushed
+            template<std::input_iterator InputIt>
+            [[nodiscard]] size_type try_push_n(InputIt first, size_type count)
+            {
+                const auto tail = tail_.load(std::memory_order_relaxed);
+                const auto pushed = std::min(count, free_slots(tail, count));
+                size_type i = 0;
+                try {
+                    for (; i < pushed; ++i, ++first) {
+                        std::construct_at(slot(tail + i), *first);
+                    }
+                } catch (...) {
+                    tail_.store(tail + i, std::memory_order_release);
+                    throw;
+                }
+                tail_.store(tail + pushed, std::memory_order_release);
+                return pushed;
+            }
+
+            // Consumer side
+
+            [[nodiscard]] std::optional<value_type> try_pop()
+            {
+                const auto head = head_.load(std::memory_order_relaxed);
+                if (used_slots(head, 1) == 0) {
+                    return std::nullopt;
+                }
+                auto* element = slot(head);
+                std::optional<value_type> value(std::move(*element));
+                std::destroy_at(element);
+                head_.store(head + 1, std::memory_order_release);
+                return value;
+            }
+
+            // Moves up to count elements to out and releases their slots together, returns how many were popped
+            template<std::output_iterator<value_type> OutputIt>
+            [[nodiscard]] size_type try_pop_n(OutputIt out, size_type count)
+            {
+                const auto head = head_.load(std::memory_order_relaxed);
+                const auto popped = std::min(count, used_slots(head, count));
+                size_type i = 0;
+                try {
+                    for (; i < popped; ++i, ++out) {
+                        auto* element = slot(head + i);
+                        *out = std::move(*element);
+                        std::destroy_at(element);
+                    }
+                } catch (...) {
+                    head_.store(head + i, std::memory_order_release);
+                    throw;
+                }
+                head_.store(head + popped, std::memory_order_release);
+                return popped;
+            }
+
+            // Either side
+
+            // Exact when called from a quiescent queue, a snapshot otherwise
+            [[nodiscard]] size_type size() const noexcept
+            {
+                const auto head = head_.load(std::memory_order_acquire);
+                return tail_.load(std::memory_order_acquire) - head;
+            }
+            [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+            [[nodiscard]] static constexpr size_type capacity() noexcept { return Capacity; }
+
+        private:
+            [[nodiscard]] value_type* slot(size_type index) noexcept
+            {
+                return elements_.data() + (index & (Capacity - 1));
+            }
+
+            // Producer only, reloads head_ when the cached copy shows fewer than wanted free slots
+            [[nodiscard]] size_type free_slots(size_type tail, size_type wanted) noexcept
+            {
+                if (Capacity - (tail - cached_head_) < wanted) {
+                    cached_head_ = head_.load(std::memory_order_acquire);
+                }
+                return Capacity - (tail - cached_head_);
+            }
+
+            // Consumer only, reloads tail_ when the cached copy shows fewer than wanted elements
+            [[nodiscard]] size_type used_slots(size_type head, size_type wanted) noexcept
+            {
+                if (cached_tail_ - head < wanted) {
+                    cached_tail_ = tail_.load(std::memory_order_acquire);
+                }
+                return cached_tail_ - head;
+            }
+
+            // Indices only ever grow, the slot is the index modulo Capacity
+            alignas(cache_line_size) std::atomic<size_type> tail_ = 0; // Written by the producer
+            size_type cached_head_ = 0;                                // Producer's copy of head_
+            alignas(cache_line_size) std::atomic<size_type> head_ = 0; // Written by the consumer
+            size_type cached_tail_ = 0;                                // Consumer's copy of tail_
+            alignas(cache_line_size) UninitializedStorage<value_type, Capacity> elements_;
+        };
+    } // namespace detail
+
+    template<typename T, std::size_t Capacity>
+    using spsc_queue = detail::SpscQueue<T, Capacity>;
+} // namespace orion
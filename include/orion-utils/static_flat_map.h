@@ -0,0 +1,856 @@
+#pragma once
+
+#include "orion-utils/assertion.h"     // ORION_ASSERT
+#include "orion-utils/static_vector.h" // orion::static_vector
+#include "orion-utils/type.h"          // orion::min_unsigned_t
+
+#include <algorithm>        // std::min, std::ranges::sort
+#include <array>            // std::array
+#include <bit>              // std::countr_one
+#include <compare>          // std::strong_ordering
+#include <cstddef>          // std::size_t, std::ptrdiff_t
+#include <cstdint>          // std::uintptr_t
+#include <functional>       // std::less
+#include <initializer_list> // std::initializer_list
+#include <iterator>         // std::random_access_iterator_tag, std::input_iterator
+#include <memory>           // std::addressof
+#include <span>             // std::span
+#include <type_traits>      // std::conditional_t, std::is_constant_evaluated, std::is_convertible_v
+#include <utility>          // std::pair, std::forward, std::move, std::swap
+
+namespace orion
+{
+    namespace detail
+    {
+        // Binary search whose loop count only depends on size. The select compiles to a conditional move, so
+        // there is no branch for the predictor to miss. Returns the index of the first key not less than key
+        template<typename Key, typename K, typename Compare>
+        constexpr std::size_t branchless_lower_bound(const Key* keys, std::size_t size, const K& key, const Compare& compare)
+        {
+            if (size == 0) {
+                return 0;
+            }
+            const Key* base = keys;
+            while (size > 1) {
+                const auto half = size / 2;
+                base = compare(base[half], key) ? base + half : base;
+                size -= half;
+            }
+            return static_cast<std::size_t>(base - keys) + (compare(*base, key) ? 1 : 0);
+        }
+
+        // Moves the element at source[i] to position i for every i, swap(a, b) exchanges two positions.
+        // Walks each cycle of the permutation so every element is swapped into place once
+        template<typename Index, std::size_t Capacity, typename Swap>
+        constexpr void apply_permutation(std::array<Index, Capacity>& source, std::size_t size, Swap& swap)
+        {
+            for (std::size_t start = 0; start < size; ++start) {
+                auto current = start;
+                while (source[current] != start) {
+                    const std::size_t next = source[current];
+                    swap(current, next);
+                    source[current] = static_cast<Index>(current);
+                    current = next;
+                }
+                source[current] = static_cast<Index>(current);
+            }
+        }
+
+        // Sorts the first size elements by key with a single permutation, equal keys keep their relative order.
+        // Only size entries of the scratch array are filled and sorted. The clamp and the span of count entries
+        // keep GCC 12 from flagging the unreachable paths of std::sort beyond the array, std::iota over the span
+        // still trips -Wstringop-overflow where the loop does not
+        template<std::size_t Capacity, typename Key, typename Compare, typename Swap>
+        constexpr void stable_sort_by_key(const Key* keys, std::size_t size, const Compare& compare, Swap&& swap)
+        {
+            const auto count = std::min<std::size_t>(size, Capacity);
+            std::array<min_unsigned_t<Capacity>, Capacity> order{};
+            const std::span<min_unsigned_t<Capacity>> sorted{order.data(), count};
+            for (std::size_t index = 0; index < count; ++index) {
+                sorted[index] = static_cast<min_unsigned_t<Capacity>>(index);
+            }
+            std::ranges::sort(sorted, [keys, &compare](auto lhs, auto rhs) {
+                return compare(keys[lhs], keys[rhs]) || (!compare(keys[rhs], keys[lhs]) && lhs < rhs);
+            });
+            apply_permutation(order, count, swap);
+        }
+
+        // Elements kept in ascending key order, iteration is ordered
+        struct SortedLayout {
+            static constexpr bool is_sorted = true;
+
+            template<typename Key, typename K, typename Compare>
+            static constexpr std::size_t lower_bound(const Key* keys, std::size_t size, const K& key, const Compare& compare)
+            {
+                return branchless_lower_bound(keys, size, key, compare);
+            }
+
+            template<std::size_t Capacity, typename Swap>
+            static constexpr void to_sorted(std::size_t, Swap&&) noexcept
+            {
+            }
+            template<std::size_t Capacity, typename Swap>
+            static constexpr std::size_t from_sorted(std::size_t, std::size_t tracked, Swap&&) noexcept
+            {
+                return tracked;
+            }
+        };
+
+        // Elements kept in the breadth-first order of a complete binary search tree: the children of position
+        // k - 1 are at 2k - 1 and 2k. The first levels share cache lines and the search prefetches the
+        // levels below it, which beats binary search once the keys no longer fit in L1.
+        //
+        // Iteration follows the storage order, not the key order, and every insert or erase rebuilds the
+        // layout in O(n), it is meant for tables built once and searched often
+        struct EytzingerLayout {
+            static constexpr bool is_sorted = false;
+
+            // Returns the position of the first key not less than key, size when there is none
+            template<typename Key, typename K, typename Compare>
+            static constexpr std::size_t lower_bound(const Key* keys, std::size_t size, const K& key, const Compare& compare)
+            {
+                std::size_t k = 1;
+                while (k <= size) {
+                    // The 16 descendants four levels down are contiguous, fetch them while the levels above are compared.
+                    // Computed as an integer since the address may lie past the end of the storage
+                    if (!std::is_constant_evaluated()) {
+                        prefetch(reinterpret_cast<std::uintptr_t>(keys) + (16 * k - 1) * sizeof(Key));
+                    }
+                    k = 2 * k + (compare(keys[k - 1], key) ? 1 : 0);
+                }
+                // Undo the right turns taken after the last left turn, k then names the answer
+                k >>= std::countr_one(k) + 1;
+                return k == 0 ? size : k - 1;
+            }
+
+            template<std::size_t Capacity, typename Swap>
+            static constexpr void to_sorted(std::size_t size, Swap&& swap)
+            {
+                std::array<min_unsigned_t<Capacity>, Capacity> ranks{};
+                assign_ranks(ranks.data(), size, 0, 1);
+                std::array<min_unsigned_t<Capacity>, Capacity> source{};
+                for (std::size_t position = 0; position < size; ++position) {
+                    source[ranks[position]] = static_cast<min_unsigned_t<Capacity>>(position);
+                }
+                apply_permutation(source, size, swap);
+            }
+            // Returns the new position of the element at sorted index tracked
+            template<std::size_t Capacity, typename Swap>
+            static constexpr std::size_t from_sorted(std::size_t size, std::size_t tracked, Swap&& swap)
+            {
+                std::array<min_unsigned_t<Capacity>, Capacity> source{};
+                assign_ranks(source.data(), size, 0, 1);
+                std::size_t tracked_position = size;
+                for (std::size_t position = 0; position < size; ++position) {
+                    if (source[position] == tracked) {
+                        tracked_position = position;
+                    }
+                }
+                apply_permutation(source, size, swap);
+                return tracked_position;
+            }
+
+        private:
+            static void prefetch([[maybe_unused]] std::uintptr_t address) noexcept
+            {
+#if defined(__GNUC__) || defined(__clang__)
+                __builtin_prefetch(reinterpret_cast<const void*>(address));
+#endif
+            }
+
+            // In-order walk of the implicit tree, stores the sorted index of every position in ranks
+            template<typename Index>
+            static constexpr std::size_t assign_ranks(Index* ranks, std::size_t size, std::size_t rank, std::size_t k) noexcept
+            {
+                if (k <= size) {
+                    rank = assign_ranks(ranks, size, rank, 2 * k);
+                    ranks[k - 1] = static_cast<Index>(rank++);
+                    rank = assign_ranks(ranks, size, rank, 2 * k + 1);
+                }
+                return rank;
+            }
+        };
+
+        // Sorted associative container over two static_vectors, keys are stored apart from the values so
+        // searching only touches keys. Lookups use a branchless binary search or, with EytzingerLayout, a
+        // prefetching search over a breadth-first layout.
+        //
+        // Inserting shifts the elements after the insertion point, the container suits small tables that are
+        // built once and read often. Building from a range sorts once instead of inserting one by one, the
+        // first of several equal keys is kept. Like std::flat_map, iterators yield pair<const Key&, T&> proxies
+        template<typename Key, typename T, std::size_t Capacity, typename Compare, typename Layout>
+        class FlatMap
+        {
+            template<bool Const>
+            class Iterator
+            {
+                using value_pointer = std::conditional_t<Const, const T*, T*>;
+
+            public:
+                using iterator_category = std::random_access_iterator_tag;
+                using value_type = std::pair<Key, T>;
+                using difference_type = std::ptrdiff_t;
+                using reference = std::pair<const Key&, std::conditional_t<Const, const T&, T&>>;
+
+                struct pointer {
+                    reference pair;
+                    constexpr const reference* operator->() const noexcept { return std::addressof(pair); }
+                };
+
+                constexpr Iterator() = default;
+                constexpr Iterator(const Key* key, value_pointer value) noexcept
+                    : key_(key)
+                    , value_(value)
+                {
+                }
+                template<bool OtherConst>
+                    requires(Const && !OtherConst)
+                constexpr Iterator(const Iterator<OtherConst>& other) noexcept
+                    : key_(other.key_)
+                    , value_(other.value_)
+                {
+                }
+
+                constexpr reference operator*() const noexcept { return {*key_, *value_}; }
+                constexpr pointer operator->() const noexcept { return {**this}; }
+                constexpr reference operator[](difference_type n) const noexcept { return {key_[n], value_[n]}; }
+
+                constexpr Iterator& operator++() noexcept
+                {
+                    ++key_;
+                    ++value_;
+                    return *this;
+                }
+                constexpr Iterator operator++(int) noexcept
+                {
+                    auto copy = *this;
+                    ++*this;
+                    return copy;
+                }
+                constexpr Iterator& operator--() noexcept
+                {
+                    --key_;
+                    --value_;
+                    return *this;
+                }
+                constexpr Iterator operator--(int) noexcept
+                {
+                    auto copy = *this;
+                    --*this;
+                    return copy;
+                }
+                constexpr Iterator& operator+=(difference_type n) noexcept
+                {
+                    key_ += n;
+                    value_ += n;
+                    return *this;
+                }
+                constexpr Iterator& operator-=(difference_type n) noexcept { return *this += -n; }
+
+                constexpr friend Iterator operator+(Iterator iterator, difference_type n) noexcept { return iterator += n; }
+                constexpr friend Iterator operator+(difference_type n, Iterator iterator) noexcept { return iterator += n; }
+                constexpr friend Iterator operator-(Iterator iterator, difference_type n) noexcept { return iterator -= n; }
+                constexpr friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) noexcept { return lhs.key_ - rhs.key_; }
+
+                constexpr bool operator==(const Iterator& rhs) const noexcept { return key_ == rhs.key_; }
+                constexpr std::strong_ordering operator<=>(const Iterator& rhs) const noexcept { return key_ <=> rhs.key_; }
+
+            private:
+                friend class FlatMap;
+                friend class Iterator<true>;
+
+                const Key* key_ = nullptr;
+                value_pointer value_ = nullptr;
+            };
+
+            // Excludes iterators so erase(iterator) never picks the key overload
+            template<typename K>
+            static constexpr bool transparent = requires { typename Compare::is_transparent; } && !std::is_convertible_v<const K&, Iterator<true>>;
+
+        public:
+            using key_type = Key;
+            using mapped_type = T;
+            using value_type = std::pair<Key, T>;
+            using key_compare = Compare;
+            using size_type = typename static_vector<Key, Capacity>::size_type;
+            using difference_type = std::ptrdiff_t;
+            using iterator = Iterator<false>;
+            using const_iterator = Iterator<true>;
+
+            constexpr FlatMap() = default;
+            template<std::input_iterator InputIt>
+            constexpr FlatMap(InputIt first, InputIt last)
+            {
+                insert(first, last);
+            }
+            constexpr FlatMap(std::initializer_list<value_type> list)
+                : FlatMap(list.begin(), list.end())
+            {
+            }
+
+            // Iterators
+
+            [[nodiscard]] constexpr iterator begin() noexcept { return {keys_.data(), values_.data()}; }
+            [[nodiscard]] constexpr const_iterator begin() const noexcept { return {keys_.data(), values_.data()}; }
+            [[nodiscard]] constexpr iterator end() noexcept { return iterator_at(size()); }
+            [[nodiscard]] constexpr const_iterator end() const noexcept { return iterator_at(size()); }
+            [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return begin(); }
+            [[nodiscard]] constexpr const_iterator cend() const noexcept { return end(); }
+
+            // Capacity
+
+            [[nodiscard]] constexpr bool empty() const noexcept { return keys_.empty(); }
+            [[nodiscard]] constexpr size_type size() const noexcept { return keys_.size(); }
+            [[nodiscard]] static constexpr size_type max_size() noexcept { return Capacity; }
+            [[nodiscard]] static constexpr size_type capacity() noexcept { return Capacity; }
+
+            // Storage, in the order of the layout
+
+            [[nodiscard]] constexpr std::span<const key_type> keys() const noexcept { return {keys_.data(), keys_.size()}; }
+            [[nodiscard]] constexpr std::span<mapped_type> values() noexcept { return {values_.data(), values_.size()}; }
+            [[nodiscard]] constexpr std::span<const mapped_type> values() const noexcept { return {values_.data(), values_.size()}; }
+
+            // Modifiers
+
+            template<typename... Args>
+            constexpr std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args)
+            {
+                return try_emplace_impl(key, std::forward<Args>(args)...);
+            }
+            template<typename... Args>
+            constexpr std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args)
+            {
+                return try_emplace_impl(std::move(key), std::forward<Args>(args)...);
+            }
+            template<typename... Args>
+            constexpr std::pair<iterator, bool> emplace(Args&&... args)
+            {
+                value_type value(std::forward<Args>(args)...);
+                return try_emplace_impl(std::move(value.first), std::move(value.second));
+            }
+            constexpr std::pair<iterator, bool> insert(const value_type& value) { return try_emplace_impl(value.first, value.second); }
+            constexpr std::pair<iterator, bool> insert(value_type&& value) { return try_emplace_impl(std::move(value.first), std::move(value.second)); }
+
+            template<typename M>
+            constexpr std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& object)
+            {
+                auto result = try_emplace_impl(key, std::forward<M>(object));
+                if (!result.second) {
+                    result.first->second = std::forward<M>(object);
+                }
+                return result;
+            }
+
+            // Appends the whole range and sorts once, keys already in the map win over the new ones
+            template<std::input_iterator InputIt>
+            constexpr void insert(InputIt first, InputIt last)
+            {
+                Layout::template to_sorted<Capacity>(size(), swapper());
+                const auto old_size = size();
+                try {
+                    for (; first != last; ++first) {
+                        const value_type& value = *first;
+                        keys_.push_back(value.first);
+                        try {
+                            values_.push_back(value.second);
+                        } catch (...) {
+                            keys_.pop_back();
+                            throw;
+                        }
+                    }
+                } catch (...) {
+                    keys_.erase(keys_.begin() + old_size, keys_.end());
+                    values_.erase(values_.begin() + old_size, values_.end());
+                    Layout::template from_sorted<Capacity>(size(), 0, swapper());
+                    throw;
+                }
+                sort_unique();
+                Layout::template from_sorted<Capacity>(size(), 0, swapper());
+            }
+            constexpr void insert(std::initializer_list<value_type> list) { insert(list.begin(), list.end()); }
+
+            // Returns the number of erased elements (0 or 1)
+            constexpr size_type erase(const key_type& key) { return erase_key(key); }
+            template<typename K>
+                requires transparent<K>
+            constexpr size_type erase(const K& key)
+            {
+                return erase_key(key);
+            }
+            constexpr iterator erase(const_iterator position)
+                requires Layout::is_sorted
+            {
+                ORION_ASSERT(position >= begin() && position < end());
+                const auto index = static_cast<size_type>(position.key_ - keys_.data());
+                keys_.erase(keys_.begin() + index);
+                values_.erase(values_.begin() + index);
+                return iterator_at(index);
+            }
+
+            // Removes every element matching predicate(pair<const Key&, const T&>) in one pass, returns how many
+            template<typename Predicate>
+            constexpr size_type erase_if(Predicate predicate)
+            {
+                Layout::template to_sorted<Capacity>(size(), swapper());
+                std::size_t kept = 0;
+                for (std::size_t index = 0; index < size(); ++index) {
+                    if (!predicate(std::pair<const Key&, const T&>(keys_.data()[index], values_.data()[index]))) {
+                        if (kept != index) {
+                            keys_.data()[kept] = std::move(keys_.data()[index]);
+                            values_.data()[kept] = std::move(values_.data()[index]);
+                        }
+                        ++kept;
+                    }
+                }
+                const auto removed = static_cast<size_type>(size() - kept);
+                keys_.erase(keys_.begin() + kept, keys_.end());
+                values_.erase(values_.begin() + kept, values_.end());
+                Layout::template from_sorted<Capacity>(size(), 0, swapper());
+                return removed;
+            }
+
+            constexpr void clear() noexcept
+            {
+                keys_.clear();
+                values_.clear();
+            }
+
+            // Lookup, the template overloads take any key type when Compare is transparent
+
+            [[nodiscard]] constexpr iterator find(const key_type& key) { return iterator_at(find_index(key)); }
+            [[nodiscard]] constexpr const_iterator find(const key_type& key) const { return iterator_at(find_index(key)); }
+            template<typename K>
+                requires transparent<K>
+            [[nodiscard]] constexpr iterator find(const K& key)
+            {
+                return iterator_at(find_index(key));
+            }
+            template<typename K>
+                requires transparent<K>
+            [[nodiscard]] constexpr const_iterator find(const K& key) const
+            {
+                return iterator_at(find_index(key));
+            }
+
+            [[nodiscard]] constexpr bool contains(const key_type& key) const { return find_index(key) != size(); }
+            template<typename K>
+                requires transparent<K>
+            [[nodiscard]] constexpr bool contains(const K& key) const
+            {
+                return find_index(key) != size();
+            }
+            [[nodiscard]] constexpr size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+            template<typename K>
+                requires transparent<K>
+            [[nodiscard]] constexpr size_type count(const K& key) const
+            {
+                return contains(key) ? 1 : 0;
+            }
+
+            [[nodiscard]] constexpr mapped_type& at(const key_type& key) { return values_.data()[existing_index(key)]; }
+            [[nodiscard]] constexpr const mapped_type& at(const key_type& key) const { return values_.data()[existing_index(key)]; }
+            template<typename K>
+                requires transparent<K>
+            [[nodiscard]] constexpr mapped_type& at(const K& key)
+            {
+                return values_.data()[existing_index(key)];
+            }
+            template<typename K>
+                requires transparent<K>
+            [[nodiscard]] constexpr const mapped_type& at(const K& key) const
+            {
+                return values_.data()[existing_index(key)];
+            }
+            constexpr mapped_type& operator[](const key_type& key) { return try_emplace(key).first->second; }
+            constexpr mapped_type& operator[](key_type&& key) { return try_emplace(std::move(key)).first->second; }
+
+            // Ordered queries need the sorted layout
+
+            [[nodiscard]] constexpr iterator lower_bound(const key_type& key)
+                requires Layout::is_sorted
+            {
+                return iterator_at(branchless_lower_bound(keys_.data(), size(), key, compare_));
+            }
+            [[nodiscard]] constexpr const_iterator lower_bound(const key_type& key) const
+                requires Layout::is_sorted
+            {
+                return iterator_at(branchless_lower_bound(keys_.data(), size(), key, compare_));
+            }
+            [[nodiscard]] constexpr iterator upper_bound(const key_type& key)
+                requires Layout::is_sorted
+            {
+                return iterator_at(upper_bound_index(key));
+            }
+            [[nodiscard]] constexpr const_iterator upper_bound(const key_type& key) const
+                requires Layout::is_sorted
+            {
+                return iterator_at(upper_bound_index(key));
+            }
+
+            // Observers
+
+            [[nodiscard]] constexpr key_compare key_comp() const { return compare_; }
+
+            [[nodiscard]] constexpr friend bool operator==(const FlatMap& lhs, const FlatMap& rhs)
+            {
+                return lhs.keys_ == rhs.keys_ && lhs.values_ == rhs.values_;
+            }
+
+        private:
+            constexpr iterator iterator_at(std::size_t index) noexcept { return begin() + static_cast<difference_type>(index); }
+            constexpr const_iterator iterator_at(std::size_t index) const noexcept { return begin() + static_cast<difference_type>(index); }
+
+            constexpr auto swapper() noexcept
+            {
+                return [this](std::size_t lhs, std::size_t rhs) {
+                    using std::swap;
+                    swap(keys_.data()[lhs], keys_.data()[rhs]);
+                    swap(values_.data()[lhs], values_.data()[rhs]);
+                };
+            }
+
+            template<typename K>
+            constexpr std::size_t find_index(const K& key) const
+            {
+                const auto index = Layout::lower_bound(keys_.data(), size(), key, compare_);
+                return index != size() && !compare_(key, keys_.data()[index]) ? index : size();
+            }
+
+            template<typename K>
+            constexpr std::size_t existing_index(const K& key) const
+            {
+                const auto index = find_index(key);
+                ORION_ASSERT(index != size(), "key not found");
+                return index;
+            }
+
+            template<typename K>
+            constexpr std::size_t upper_bound_index(const K& key) const
+            {
+                // Inverting the comparison turns the lower bound search into an upper bound one
+                return branchless_lower_bound(keys_.data(), size(), key, [this](const key_type& element, const K& value) { return !compare_(value, element); });
+            }
+
+            template<typename K, typename... Args>
+            constexpr std::pair<iterator, bool> try_emplace_impl(K&& key, Args&&... args)
+            {
+                std::size_t index = 0;
+                if constexpr (Layout::is_sorted) {
+                    index = branchless_lower_bound(keys_.data(), size(), key, compare_);
+                    if (index != size() && !compare_(key, keys_.data()[index])) {
+                        return {iterator_at(index), false};
+                    }
+                } else {
+                    if (const auto found = find_index(key); found != size()) {
+                        return {iterator_at(found), false};
+                    }
+                    Layout::template to_sorted<Capacity>(size(), swapper());
+                    index = branchless_lower_bound(keys_.data(), size(), key, compare_);
+                }
+
+                ORION_ASSERT(size() < max_size());
+                try {
+                    keys_.emplace(keys_.begin() + index, std::forward<K>(key));
+                    try {
+                        values_.emplace(values_.begin() + index, std::forward<Args>(args)...);
+                    } catch (...) {
+                        keys_.erase(keys_.begin() + index);
+                        throw;
+                    }
+                } catch (...) {
+                    Layout::template from_sorted<Capacity>(size(), 0, swapper());
+                    throw;
+                }
+                return {iterator_at(Layout::template from_sorted<Capacity>(size(), index, swapper())), true};
+            }
+
+            template<typename K>
+            constexpr size_type erase_key(const K& key)
+            {
+                if (find_index(key) == size()) {
+                    return 0;
+                }
+                Layout::template to_sorted<Capacity>(size(), swapper());
+                const auto index = branchless_lower_bound(keys_.data(), size(), key, compare_);
+                keys_.erase(keys_.begin() + index);
+                values_.erase(values_.begin() + index);
+                Layout::template from_sorted<Capacity>(size(), 0, swapper());
+                return 1;
+            }
+
+            // Sorts the elements by key and drops duplicates, keeping the first
+            constexpr void sort_unique()
+            {
+                stable_sort_by_key<Capacity>(keys_.data(), size(), compare_, swapper());
+
+                std::size_t kept = 0;
+                for (std::size_t index = 0; index < size(); ++index) {
+                    if (kept == 0 || compare_(keys_.data()[kept - 1], keys_.data()[index])) {
+                        if (kept != index) {
+                            keys_.data()[kept] = std::move(keys_.data()[index]);
+                            values_.data()[kept] = std::move(values_.data()[index]);
+                        }
+                        ++kept;
+                    }
+                }
+                keys_.erase(keys_.begin() + kept, keys_.end());
+                values_.erase(values_.begin() + kept, values_.end());
+            }
+
+            static_vector<key_type, Capacity> keys_;
+            static_vector<mapped_type, Capacity> values_;
+            [[no_unique_address]] key_compare compare_;
+        };
+
+        // Sorted set over a static_vector, see FlatMap
+        template<typename Key, std::size_t Capacity, typename Compare, typename Layout>
+        class FlatSet
+        {
+            template<typename K>
+            static constexpr bool transparent = requires { typename Compare::is_transparent; } && !std::is_convertible_v<const K&, const Key*>;
+
+        public:
+            using key_type = Key;
+            using value_type = Key;
+            using key_compare = Compare;
+            using value_compare = Compare;
+            using size_type = typename static_vector<Key, Capacity>::size_type;
+            using difference_type = std::ptrdiff_t;
+            using reference = const value_type&;
+            using const_reference = const value_type&;
+            using iterator = const value_type*;
+            using const_iterator = const value_type*;
+
+            constexpr FlatSet() = default;
+            template<std::input_iterator InputIt>
+            constexpr FlatSet(InputIt first, InputIt last)
+            {
+                insert(first, last);
+            }
+            constexpr FlatSet(std::initializer_list<value_type> list)
+                : FlatSet(list.begin(), list.end())
+            {
+            }
+
+            // Iterators
+
+            [[nodiscard]] constexpr const_iterator begin() const noexcept { return keys_.data(); }
+            [[nodiscard]] constexpr const_iterator end() const noexcept { return keys_.data() + keys_.size(); }
+            [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return begin(); }
+            [[nodiscard]] constexpr const_iterator cend() const noexcept { return end(); }
+
+            // Capacity
+
+            [[nodiscard]] constexpr bool empty() const noexcept { return keys_.empty(); }
+            [[nodiscard]] constexpr size_type size() const noexcept { return keys_.size(); }
+            [[nodiscard]] static constexpr size_type max_size() noexcept { return Capacity; }
+            [[nodiscard]] static constexpr size_type capacity() noexcept { return Capacity; }
+
+            [[nodiscard]] constexpr const value_type* data() const noexcept { return keys_.data(); }
+
+            // Modifiers
+
+            template<typename... Args>
+            constexpr std::pair<iterator, bool> emplace(Args&&... args)
+            {
+                return insert_impl(value_type(std::forward<Args>(args)...));
+            }
+            constexpr std::pair<iterator, bool> insert(const value_type& value) { return insert_impl(value); }
+            constexpr std::pair<iterator, bool> insert(value_type&& value) { return insert_impl(std::move(value)); }
+
+            // Appends the whole range and sorts once, keys already in the set win over the new ones
+            template<std::input_iterator InputIt>
+            constexpr void insert(InputIt first, InputIt last)
+            {
+                Layout::template to_sorted<Capacity>(size(), swapper());
+                const auto old_size = size();
+                try {
+                    for (; first != last; ++first) {
+                        keys_.push_back(*first);
+                    }
+                } catch (...) {
+                    keys_.erase(keys_.begin() + old_size, keys_.end());
+                    Layout::template from_sorted<Capacity>(size(), 0, swapper());
+                    throw;
+                }
+                sort_unique();
+                Layout::template from_sorted<Capacity>(size(), 0, swapper());
+            }
+            constexpr void insert(std::initializer_list<value_type> list) { insert(list.begin(), list.end()); }
+
+            // Returns the number of erased elements (0 or 1)
+            constexpr size_type erase(const key_type& key) { return erase_key(key); }
+            template<typename K>
+                requires transparent<K>
+            constexpr size_type erase(const K& key)
+            {
+                return erase_key(key);
+            }
+            constexpr iterator erase(const_iterator position)
+                requires Layout::is_sorted
+            {
+                ORION_ASSERT(position >= begin() && position < end());
+                const auto index = position - begin();
+                keys_.erase(keys_.begin() + index);
+                return begin() + index;
+            }
+
+            // Removes every key matching the predicate in one pass, returns how many
+            template<typename Predicate>
+            constexpr size_type erase_if(Predicate predicate)
+            {
+                Layout::template to_sorted<Capacity>(size(), swapper());
+                const auto removed = orion::erase_if(keys_, std::move(predicate));
+                Layout::template from_sorted<Capacity>(size(), 0, swapper());
+                return removed;
+            }
+
+            constexpr void clear() noexcept { keys_.clear(); }
+
+            // Lookup, the template overloads take any key type when Compare is transparent
+
+            [[nodiscard]] constexpr const_iterator find(const key_type& key) const { return begin() + find_index(key); }
+            template<typename K>
+                requires transparent<K>
+            [[nodiscard]] constexpr const_iterator find(const K& key) const
+            {
+                return begin() + find_index(key);
+            }
+            [[nodiscard]] constexpr bool contains(const key_type& key) const { return find_index(key) != size(); }
+            template<typename K>
+                requires transparent<K>
+            [[nodiscard]] constexpr bool contains(const K& key) const
+            {
+                return find_index(key) != size();
+            }
+            [[nodiscard]] constexpr size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+            template<typename K>
+                requires transparent<K>
+            [[nodiscard]] constexpr size_type count(const K& key) const
+            {
+                return contains(key) ? 1 : 0;
+            }
+
+            // Ordered queries need the sorted layout
+
+            [[nodiscard]] constexpr const_iterator lower_bound(const key_type& key) const
+                requires Layout::is_sorted
+            {
+                return begin() + branchless_lower_bound(keys_.data(), size(), key, compare_);
+            }
+            [[nodiscard]] constexpr const_iterator upper_bound(const key_type& key) const
+                requires Layout::is_sorted
+            {
+                return begin() + branchless_lower_bound(keys_.data(), size(), key, [this](const key_type& element, const key_type& value) { return !compare_(value, element); });
+            }
+
+            // Observers
+
+            [[nodiscard]] constexpr key_compare key_comp() const { return compare_; }
+            [[nodiscard]] constexpr value_compare value_comp() const { return compare_; }
+
+            [[nodiscard]] constexpr friend bool operator==(const FlatSet& lhs, const FlatSet& rhs) { return lhs.keys_ == rhs.keys_; }
+
+        private:
+            constexpr auto swapper() noexcept
+            {
+                return [this](std::size_t lhs, std::size_t rhs) {
+                    using std::swap;
+                    swap(keys_.data()[lhs], keys_.data()[rhs]);
+                };
+            }
+
+            template<typename K>
+            constexpr std::size_t find_index(const K& key) const
+            {
+                const auto index = Layout::lower_bound(keys_.data(), size(), key, compare_);
+                return index != size() && !compare_(key, keys_.data()[index]) ? index : size();
+            }
+
+            template<typename V>
+            constexpr std::pair<iterator, bool> insert_impl(V&& value)
+            {
+                std::size_t index = 0;
+                if constexpr (Layout::is_sorted) {
+                    index = branchless_lower_bound(keys_.data(), size(), value, compare_);
+                    if (index != size() && !compare_(value, keys_.data()[index])) {
+                        return {begin() + index, false};
+                    }
+                } else {
+                    if (const auto found = find_index(value); found != size()) {
+                        return {begin() + found, false};
+                    }
+                    Layout::template to_sorted<Capacity>(size(), swapper());
+                    index = branchless_lower_bound(keys_.data(), size(), value, compare_);
+                }
+
+                ORION_ASSERT(size() < max_size());
+                try {
+                    keys_.emplace(keys_.begin() + index, std::forward<V>(value));
+                } catch (...) {
+                    Layout::template from_sorted<Capacity>(size(), 0, swapper());
+                    throw;
+                }
+                return {begin() + Layout::template from_sorted<Capacity>(size(), index, swapper()), true};
+            }
+
+            template<typename K>
+            constexpr size_type erase_key(const K& key)
+            {
+                if (find_index(key) == size()) {
+                    return 0;
+                }
+                Layout::template to_sorted<Capacity>(size(), swapper());
+                keys_.erase(keys_.begin() + branchless_lower_bound(keys_.data(), size(), key, compare_));
+                Layout::template from_sorted<Capacity>(size(), 0, swapper());
+                return 1;
+            }
+
+            // Sorts the keys and drops duplicates, keeping the first
+            constexpr void sort_unique()
+            {
+                stable_sort_by_key<Capacity>(keys_.data(), size(), compare_, swapper());
+
+                std::size_t kept = 0;
+                for (std::size_t index = 0; index < size(); ++index) {
+                    if (kept == 0 || compare_(keys_.data()[kept - 1], keys_.data()[index])) {
+                        if (kept != index) {
+                            keys_.data()[kept] = std::move(keys_.data()[index]);
+                        }
+                        ++kept;
+                    }
+                }
+                keys_.erase(keys_.begin() + kept, keys_.end());
+            }
+
+            static_vector<key_type, Capacity> keys_;
+            [[no_unique_address]] key_compare compare_;
+        };
+    } // namespace detail
+
+    template<typename Key, typename T, std::size_t Capacity, typename Compare = std::less<Key>>
+    using static_flat_map = detail::FlatMap<Key, T, Capacity, Compare, detail::SortedLayout>;
+
+    template<typename Key, std::size_t Capacity, typename Compare = std::less<Key>>
+    using static_flat_set = detail::FlatSet<Key, Capacity, Compare, detail::SortedLayout>;
+
+    // Lookup-only variants for larger tables, iteration does not follow key order
+    template<typename Key, typename T, std::size_t Capacity, typename Compare = std::less<Key>>
+    using eytzinger_flat_map = detail::FlatMap<Key, T, Capacity, Compare, detail::EytzingerLayout>;
+
+    template<typename Key, std::size_t Capacity, typename Compare = std::less<Key>>
+    using eytzinger_flat_set = detail::FlatSet<Key, Capacity, Compare, detail::EytzingerLayout>;
+
+    // Removes every element matching the predicate, returns the number of removed elements
+    template<typename Key, typename T, std::size_t Capacity, typename Compare, typename Layout, typename Predicate>
+    constexpr auto erase_if(detail::FlatMap<Key, T, Capacity, Compare, Layout>& map, Predicate predicate)
+    {
+        return map.erase_if(std::move(predicate));
+    }
+
+    template<typename Key, std::size_t Capacity, typename Compare, typename Layout, typename Predicate>
+    constexpr auto erase_if(detail::FlatSet<Key, Capacity, Compare, Layout>& set, Predicate predicate)
+    {
+        return set.erase_if(std::move(predicate));
+    }
+} // namespace orion
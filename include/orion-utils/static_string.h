@@ -0,0 +1,346 @@
+#pragma once
+
+#include "orion-utils/assertion.h"     // ORION_ASSERT
+#include "orion-utils/static_vector.h" // orion::detail::StaticVector
+
+#include <algorithm>   // std::min
+#include <cstddef>     // std::size_t, std::nullptr_t
+#include <functional>  // std::hash, std::less
+#include <string>      // std::char_traits, std::basic_string
+#include <string_view> // std::basic_string_view
+#include <type_traits> // std::type_identity_t, std::is_same_v, std::is_constant_evaluated
+#include <utility>     // std::forward
+
+#include <fmt/format.h> // fmt::formatter, fmt::format_to_n, fmt::format_string
+
+namespace orion
+{
+    namespace detail
+    {
+        // Length of the longest prefix of [data, data + size) that does not end in the middle of a UTF-8 sequence
+        [[nodiscard]] constexpr std::size_t utf8_complete_prefix(const auto* data, std::size_t size) noexcept
+        {
+            std::size_t lead = size;
+            while (lead > 0 && size - lead < 4) {
+                --lead;
+                const auto byte = static_cast<unsigned char>(data[lead]);
+                if ((byte & 0xC0) != 0x80) {
+                    const std::size_t length = byte < 0x80 ? 1 : byte >= 0xF0 ? 4 : byte >= 0xE0 ? 3 : 2;
+                    return size - lead >= length ? size : lead;
+                }
+            }
+            return size;
+        }
+
+        template<typename CharT, std::size_t Capacity, typename Traits = std::char_traits<CharT>>
+        class BasicStaticString
+        {
+        public:
+            using traits_type = Traits;
+            using value_type = CharT;
+            using reference = value_type&;
+            using const_reference = const value_type&;
+            using pointer = value_type*;
+            using const_pointer = const value_type*;
+            using size_type = decltype(StaticVector<CharT, Capacity>::find_min_size_type());
+            using iterator = pointer;
+            using const_iterator = const_pointer;
+            using view_type = std::basic_string_view<CharT, Traits>;
+
+            static constexpr std::size_t npos = view_type::npos;
+
+            constexpr BasicStaticString() noexcept = default;
+
+            constexpr BasicStaticString(const CharT* string)
+                : BasicStaticString(view_type{string})
+            {
+            }
+
+            constexpr BasicStaticString(const CharT* string, std::size_t count)
+                : BasicStaticString(view_type{string, count})
+            {
+            }
+
+            constexpr BasicStaticString(std::size_t count, CharT character)
+            {
+                append(count, character);
+            }
+
+            constexpr explicit BasicStaticString(view_type view)
+            {
+                append(view);
+            }
+
+            BasicStaticString(std::nullptr_t) = delete;
+
+            constexpr BasicStaticString& operator=(view_type view)
+            {
+                return assign(view);
+            }
+            constexpr BasicStaticString& operator=(const CharT* string)
+            {
+                return assign(view_type{string});
+            }
+
+            constexpr BasicStaticString& assign(view_type view)
+            {
+                // The view may alias our own buffer, copy before touching the size
+                ORION_ASSERT(view.size() <= max_size(), "{} characters do not fit in a static_string<{}>", view.size(), Capacity);
+                Traits::move(data_, view.data(), view.size());
+                set_size(view.size());
+                return *this;
+            }
+
+            [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+            [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+            [[nodiscard]] constexpr size_type length() const noexcept { return size_; }
+            [[nodiscard]] static constexpr size_type max_size() noexcept { return Capacity; }
+            [[nodiscard]] static constexpr size_type capacity() noexcept { return Capacity; }
+            [[nodiscard]] constexpr size_type available() const noexcept { return static_cast<size_type>(Capacity - size_); }
+
+            [[nodiscard]] constexpr pointer data() noexcept { return data_; }
+            [[nodiscard]] constexpr const_pointer data() const noexcept { return data_; }
+            [[nodiscard]] constexpr const_pointer c_str() const noexcept { return data_; }
+
+            [[nodiscard]] constexpr view_type view() const noexcept { return view_type{data_, size_}; }
+            [[nodiscard]] constexpr operator view_type() const noexcept { return view(); }
+            [[nodiscard]] explicit operator std::basic_string<CharT, Traits>() const { return std::basic_string<CharT, Traits>{view()}; }
+
+            [[nodiscard]] constexpr iterator begin() noexcept { return data_; }
+            [[nodiscard]] constexpr const_iterator begin() const noexcept { return data_; }
+            [[nodiscard]] constexpr iterator end() noexcept { return data_ + size_; }
+            [[nodiscard]] constexpr const_iterator end() const noexcept { return data_ + size_; }
+            [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return begin(); }
+            [[nodiscard]] constexpr const_iterator cend() const noexcept { return end(); }
+
+            [[nodiscard]] constexpr reference operator[](std::size_t n)
+            {
+                ORION_ASSERT(n < size_);
+                return data_[n];
+            }
+            [[nodiscard]] constexpr const_reference operator[](std::size_t n) const
+            {
+                ORION_ASSERT(n <= size_);
+                return data_[n];
+            }
+            [[nodiscard]] constexpr reference front()
+            {
+                ORION_ASSERT(!empty());
+                return data_[0];
+            }
+            [[nodiscard]] constexpr const_reference front() const
+            {
+                ORION_ASSERT(!empty());
+                return data_[0];
+            }
+            [[nodiscard]] constexpr reference back()
+            {
+                ORION_ASSERT(!empty());
+                return data_[size_ - 1];
+            }
+            [[nodiscard]] constexpr const_reference back() const
+            {
+                ORION_ASSERT(!empty());
+                return data_[size_ - 1];
+            }
+
+            constexpr void clear() noexcept
+            {
+                set_size(0);
+            }
+
+            constexpr void push_back(CharT character)
+            {
+                ORION_ASSERT(size_ < max_size(), "static_string<{}> is full", Capacity);
+                data_[size_] = character;
+                set_size(size_ + std::size_t{1});
+            }
+
+            constexpr void pop_back()
+            {
+                ORION_ASSERT(!empty());
+                set_size(size_ - std::size_t{1});
+            }
+
+            constexpr BasicStaticString& append(view_type view)
+            {
+                ORION_ASSERT(view.size() <= available(), "appending {} characters overflows static_string<{}>", view.size(), Capacity);
+                Traits::move(end(), view.data(), view.size());
+                set_size(size_ + view.size());
+                return *this;
+            }
+            constexpr BasicStaticString& append(std::size_t count, CharT character)
+            {
+                ORION_ASSERT(count <= available(), "appending {} characters overflows static_string<{}>", count, Capacity);
+                Traits::assign(end(), count, character);
+                set_size(size_ + count);
+                return *this;
+            }
+
+            // Appends as much of the view as fits, returns false when it was cut short
+            constexpr bool append_truncated(view_type view)
+            {
+                const auto count = std::min<std::size_t>(view.size(), available());
+                Traits::move(end(), view.data(), count);
+                set_size(size_ + count);
+                return count == view.size();
+            }
+
+            constexpr BasicStaticString& operator+=(view_type view) { return append(view); }
+            constexpr BasicStaticString& operator+=(const CharT* string) { return append(view_type{string}); }
+            constexpr BasicStaticString& operator+=(CharT character)
+            {
+                push_back(character);
+                return *this;
+            }
+
+            constexpr BasicStaticString& insert(std::size_t position, view_type view)
+            {
+                ORION_ASSERT(position <= size_);
+                ORION_ASSERT(view.size() <= available(), "inserting {} characters overflows static_string<{}>", view.size(), Capacity);
+                // A view into this string's characters would be moved by the shift, it goes through a copy.
+                // Pointers into different arrays can't be ordered in constant evaluation, which always copies
+                const std::less<const CharT*> less;
+                if (std::is_constant_evaluated() || (!less(view.data(), data_) && less(view.data(), data_ + size_))) {
+                    const BasicStaticString inserted{view};
+                    insert_disjoint(position, inserted.view());
+                } else {
+                    insert_disjoint(position, view);
+                }
+                return *this;
+            }
+
+            constexpr BasicStaticString& erase(std::size_t position = 0, std::size_t count = npos)
+            {
+                // Erasing from npos, as returned by a failed find, is a no-op
+                position = std::min<std::size_t>(position, size_);
+                count = std::min<std::size_t>(count, size_ - position);
+                Traits::move(data_ + position, data_ + position + count, size_ - position - count);
+                set_size(size_ - count);
+                return *this;
+            }
+
+            constexpr void resize(std::size_t count, CharT character = CharT{})
+            {
+                ORION_ASSERT(count <= max_size(), "{} characters do not fit in a static_string<{}>", count, Capacity);
+                if (count > size_) {
+                    Traits::assign(end(), count - size_, character);
+                }
+                set_size(count);
+            }
+
+            [[nodiscard]] constexpr BasicStaticString substr(std::size_t position = 0, std::size_t count = npos) const
+            {
+                return BasicStaticString{view().substr(position, count)};
+            }
+
+            [[nodiscard]] constexpr std::size_t find(view_type view, std::size_t position = 0) const noexcept { return this->view().find(view, position); }
+            [[nodiscard]] constexpr std::size_t find(CharT character, std::size_t position = 0) const noexcept { return view().find(character, position); }
+            [[nodiscard]] constexpr std::size_t rfind(view_type view, std::size_t position = npos) const noexcept { return this->view().rfind(view, position); }
+            [[nodiscard]] constexpr std::size_t rfind(CharT character, std::size_t position = npos) const noexcept { return view().rfind(character, position); }
+            [[nodiscard]] constexpr bool starts_with(view_type view) const noexcept { return this->view().starts_with(view); }
+            [[nodiscard]] constexpr bool starts_with(CharT character) const noexcept { return view().starts_with(character); }
+            [[nodiscard]] constexpr bool ends_with(view_type view) const noexcept { return this->view().ends_with(view); }
+            [[nodiscard]] constexpr bool ends_with(CharT character) const noexcept { return view().ends_with(character); }
+            [[nodiscard]] constexpr bool contains(view_type view) const noexcept { return find(view) != npos; }
+            [[nodiscard]] constexpr bool contains(CharT character) const noexcept { return find(character) != npos; }
+
+            // Formats at the end of the string, output that does not fit is dropped.
+            // A cut never splits a UTF-8 sequence. Returns false when the output was truncated
+            template<typename... Args>
+                requires std::is_same_v<CharT, char>
+            bool append_format(fmt::format_string<Args...> format, Args&&... args)
+            {
+                const std::size_t room = available();
+                const auto result = fmt::format_to_n(end(), room, format, std::forward<Args>(args)...);
+                if (result.size <= room) {
+                    set_size(size_ + result.size);
+                    return true;
+                }
+                set_size(size_ + detail::utf8_complete_prefix(end(), room));
+                return false;
+            }
+
+        private:
+            constexpr void set_size(std::size_t size) noexcept
+            {
+                size_ = static_cast<size_type>(size);
+                data_[size] = CharT{};
+            }
+
+            // The view must not point into data_
+            constexpr void insert_disjoint(std::size_t position, view_type view) noexcept
+            {
+                Traits::move(data_ + position + view.size(), data_ + position, size_ - position);
+                Traits::copy(data_ + position, view.data(), view.size());
+                set_size(size_ + view.size());
+            }
+
+            CharT data_[Capacity + 1]{};
+            size_type size_ = 0;
+        };
+
+        template<typename CharT, std::size_t Capacity, std::size_t OtherCapacity, typename Traits>
+        [[nodiscard]] constexpr bool operator==(const BasicStaticString<CharT, Capacity, Traits>& lhs, const BasicStaticString<CharT, OtherCapacity, Traits>& rhs) noexcept
+        {
+            return lhs.view() == rhs.view();
+        }
+
+        template<typename CharT, std::size_t Capacity, typename Traits>
+        [[nodiscard]] constexpr bool operator==(const BasicStaticString<CharT, Capacity, Traits>& lhs, std::type_identity_t<std::basic_string_view<CharT, Traits>> rhs) noexcept
+        {
+            return lhs.view() == rhs;
+        }
+
+        template<typename CharT, std::size_t Capacity, std::size_t OtherCapacity, typename Traits>
+        [[nodiscard]] constexpr auto operator<=>(const BasicStaticString<CharT, Capacity, Traits>& lhs, const BasicStaticString<CharT, OtherCapacity, Traits>& rhs) noexcept
+        {
+            return lhs.view() <=> rhs.view();
+        }
+
+        template<typename CharT, std::size_t Capacity, typename Traits>
+        [[nodiscard]] constexpr auto operator<=>(const BasicStaticString<CharT, Capacity, Traits>& lhs, std::type_identity_t<std::basic_string_view<CharT, Traits>> rhs) noexcept
+        {
+            return lhs.view() <=> rhs;
+        }
+    } // namespace detail
+
+    template<typename CharT, std::size_t Capacity, typename Traits = std::char_traits<CharT>>
+    using basic_static_string = detail::BasicStaticString<CharT, Capacity, Traits>;
+
+    template<std::size_t Capacity>
+    using static_string = basic_static_string<char, Capacity>;
+
+    // Appends the formatted output to the inline buffer of the string, see BasicStaticString::append_format
+    template<std::size_t Capacity, typename... Args>
+    bool format_to(static_string<Capacity>& out, fmt::format_string<Args...> format, Args&&... args)
+    {
+        return out.append_format(format, std::forward<Args>(args)...);
+    }
+
+    // Formats into a new string, truncating output longer than Capacity
+    template<std::size_t Capacity, typename... Args>
+    [[nodiscard]] static_string<Capacity> format(fmt::format_string<Args...> format, Args&&... args)
+    {
+        static_string<Capacity> out;
+        out.append_format(format, std::forward<Args>(args)...);
+        return out;
+    }
+} // namespace orion
+
+template<typename CharT, std::size_t Capacity, typename Traits>
+struct std::hash<orion::detail::BasicStaticString<CharT, Capacity, Traits>> {
+    [[nodiscard]] std::size_t operator()(const orion::detail::BasicStaticString<CharT, Capacity, Traits>& string) const noexcept
+    {
+        return std::hash<std::basic_string_view<CharT, Traits>>{}(string.view());
+    }
+};
+
+template<typename CharT, std::size_t Capacity, typename Traits>
+struct fmt::formatter<orion::detail::BasicStaticString<CharT, Capacity, Traits>, CharT> : fmt::formatter<fmt::basic_string_view<CharT>, CharT> {
+    template<typename FormatContext>
+    auto format(const orion::detail::BasicStaticString<CharT, Capacity, Traits>& string, FormatContext& context) const
+    {
+        return fmt::formatter<fmt::basic_string_view<CharT>, CharT>::format(fmt::basic_string_view<CharT>{string.data(), string.size()}, context);
+    }
+};
@@ -0,0 +1,624 @@
+#pragma once
+
+#include "orion-utils/assertion.h"     // ORION_ASSERT
+#include "orion-utils/uninitialized.h" // orion::UninitializedStorage, orion::uninitialized_relocate
+
+#include <algorithm>   // std::max
+#include <array>       // std::array
+#include <bit>         // std::bit_ceil, std::countr_zero
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <cstdint>     // std::uint8_t, std::uint64_t
+#include <functional>  // std::hash, std::equal_to
+#include <iterator>    // std::forward_iterator_tag
+#include <memory>      // std::construct_at, std::destroy_at, std::addressof
+#include <tuple>       // std::forward_as_tuple
+#include <type_traits> // std::conditional_t, std::is_nothrow_move_constructible_v
+#include <utility>     // std::pair, std::forward, std::move, std::piecewise_construct
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+#endif
+
+namespace orion
+{
+    namespace detail
+    {
+        // Control byte of an empty slot, full slots hold the low 7 bits of the key hash so the top bit
+        // alone tells empty and full slots apart
+        inline constexpr std::uint8_t control_empty = 0x80;
+
+        // Slots of a group that matched, one bit per slot (Shift 0) or the top bit of one byte per slot (Shift 3)
+        template<typename Bits, int Shift>
+        class GroupMask
+        {
+        public:
+            constexpr explicit GroupMask(Bits bits) noexcept
+                : bits_(bits)
+            {
+            }
+
+            constexpr explicit operator bool() const noexcept { return bits_ != 0; }
+            constexpr std::size_t lowest() const noexcept { return static_cast<std::size_t>(std::countr_zero(bits_)) >> Shift; }
+            constexpr void clear_lowest() noexcept { bits_ &= bits_ - 1; }
+
+        private:
+            Bits bits_;
+        };
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+        // 16 control bytes compared at once
+        class ControlGroup
+        {
+        public:
+            static constexpr std::size_t width = 16;
+
+            explicit ControlGroup(const std::uint8_t* controls) noexcept
+                : controls_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(controls)))
+            {
+            }
+
+            GroupMask<std::uint32_t, 0> match(std::uint8_t h2) const noexcept
+            {
+                const auto equal = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)), controls_);
+                return GroupMask<std::uint32_t, 0>{static_cast<std::uint32_t>(_mm_movemask_epi8(equal))};
+            }
+            GroupMask<std::uint32_t, 0> match_empty() const noexcept
+            {
+                return GroupMask<std::uint32_t, 0>{static_cast<std::uint32_t>(_mm_movemask_epi8(controls_))};
+            }
+
+        private:
+            __m128i controls_;
+        };
+#elif defined(__ARM_NEON)
+        // 8 control bytes compared at once, NEON has no movemask so matches keep the top bit of each byte
+        class ControlGroup
+        {
+        public:
+            static constexpr std::size_t width = 8;
+
+            explicit ControlGroup(const std::uint8_t* controls) noexcept
+                : controls_(vld1_u8(controls))
+            {
+            }
+
+            GroupMask<std::uint64_t, 3> match(std::uint8_t h2) const noexcept
+            {
+                const auto equal = vceq_u8(controls_, vdup_n_u8(h2));
+                return GroupMask<std::uint64_t, 3>{vget_lane_u64(vreinterpret_u64_u8(equal), 0) & msbs};
+            }
+            GroupMask<std::uint64_t, 3> match_empty() const noexcept
+            {
+                return GroupMask<std::uint64_t, 3>{vget_lane_u64(vreinterpret_u64_u8(controls_), 0) & msbs};
+            }
+
+        private:
+            static constexpr std::uint64_t msbs = 0x8080808080808080;
+
+            uint8x8_t controls_;
+        };
+#else
+        // 8 control bytes compared at once in a 64-bit word
+        class ControlGroup
+        {
+        public:
+            static constexpr std::size_t width = 8;
+
+            constexpr explicit ControlGroup(const std::uint8_t* controls) noexcept
+            {
+                // Byte i ends up in bits [8i, 8i + 8) on any platform, compilers turn this into a load
+                for (std::size_t i = 0; i < width; ++i) {
+                    controls_ |= std::uint64_t{controls[i]} << (i * 8);
+                }
+            }
+
+            // May report a false match next to a real one, callers compare the keys anyway
+            constexpr GroupMask<std::uint64_t, 3> match(std::uint8_t h2) const noexcept
+            {
+                const auto x = controls_ ^ (lsbs * h2);
+                return GroupMask<std::uint64_t, 3>{(x - lsbs) & ~x & msbs};
+            }
+            constexpr GroupMask<std::uint64_t, 3> match_empty() const noexcept
+            {
+                return GroupMask<std::uint64_t, 3>{controls_ & msbs};
+            }
+
+        private:
+            static constexpr std::uint64_t lsbs = 0x0101010101010101;
+            static constexpr std::uint64_t msbs = 0x8080808080808080;
+
+            std::uint64_t controls_ = 0;
+        };
+#endif
+
+        // Open-addressing hash map with all slots stored inline. Keys and values live in separate arrays and
+        // every slot has a control byte, lookups compare a whole group of control bytes against 7 bits of the
+        // hash and only touch keys whose byte matched.
+        //
+        // Slots are probed linearly from the home slot given by the hash, so deletion shifts the following
+        // elements back instead of leaving tombstones and lookups never slow down after erasing.
+        //
+        // Like std::flat_map, iterators yield pair<const Key&, T&> proxies instead of references to pairs
+        template<typename Key, typename T, std::size_t Capacity, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+        class StaticUnorderedMap
+        {
+            static_assert(Capacity > 0, "StaticUnorderedMap needs room for at least one element");
+            static_assert(std::is_nothrow_move_constructible_v<Key> && std::is_nothrow_move_constructible_v<T>,
+                          "Erasing moves elements, moving must not throw");
+
+            // At most 7/8 of the slots are used so probe sequences stay short
+            static constexpr std::size_t slot_count = std::bit_ceil(std::max(Capacity + Capacity / 7 + 1, ControlGroup::width));
+            static constexpr std::size_t slot_mask = slot_count - 1;
+            // The first group is cloned past the end so a group can be loaded at any slot without wrapping
+            static constexpr std::size_t control_count = slot_count + ControlGroup::width - 1;
+
+            template<bool Const>
+            class Iterator
+            {
+                using map_type = std::conditional_t<Const, const StaticUnorderedMap, StaticUnorderedMap>;
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = std::pair<Key, T>;
+                using difference_type = std::ptrdiff_t;
+                using reference = std::pair<const Key&, std::conditional_t<Const, const T&, T&>>;
+
+                struct pointer {
+                    reference pair;
+                    constexpr const reference* operator->() const noexcept { return std::addressof(pair); }
+                };
+
+                constexpr Iterator() = default;
+                constexpr Iterator(map_type* map, std::size_t slot) noexcept
+                    : map_(map)
+                    , slot_(slot)
+                {
+                    skip_empty();
+                }
+                template<bool OtherConst>
+                    requires(Const && !OtherConst)
+                constexpr Iterator(const Iterator<OtherConst>& other) noexcept
+                    : map_(other.map_)
+                    , slot_(other.slot_)
+                {
+                }
+
+                constexpr reference operator*() const noexcept { return {map_->keys_.data()[slot_], map_->values_.data()[slot_]}; }
+                constexpr pointer operator->() const noexcept { return {**this}; }
+
+                constexpr Iterator& operator++() noexcept
+                {
+                    ++slot_;
+                    skip_empty();
+                    return *this;
+                }
+                constexpr Iterator operator++(int) noexcept
+                {
+                    auto copy = *this;
+                    ++*this;
+                    return copy;
+                }
+
+                constexpr bool operator==(const Iterator& rhs) const noexcept { return slot_ == rhs.slot_; }
+
+            private:
+                friend class StaticUnorderedMap;
+                friend class Iterator<true>;
+
+                constexpr void skip_empty() noexcept
+                {
+                    while (slot_ < slot_count && map_->controls_[slot_] == control_empty) {
+                        ++slot_;
+                    }
+                }
+
+                map_type* map_ = nullptr;
+                std::size_t slot_ = slot_count;
+            };
+
+
+            // Excludes iterators so erase(iterator) never picks the key overload
+            template<typename K>
+            static constexpr bool transparent = requires {
+                typename Hash::is_transparent;
+                typename KeyEqual::is_transparent;
+            } && !std::is_convertible_v<const K&, Iterator<true>>;
+
+        public:
+            using key_type = Key;
+            using mapped_type = T;
+            using value_type = std::pair<Key, T>;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using hasher = Hash;
+            using key_equal = KeyEqual;
+            using iterator = Iterator<false>;
+            using const_iterator = Iterator<true>;
+
+            StaticUnorderedMap() noexcept { controls_.fill(control_empty); }
+
+            StaticUnorderedMap(const StaticUnorderedMap& other)
+                : StaticUnorderedMap()
+            {
+                hash_ = other.hash_;
+                equal_ = other.equal_;
+                try {
+                    copy_slots(other);
+                } catch (...) {
+                    clear();
+                    throw;
+                }
+            }
+            StaticUnorderedMap(StaticUnorderedMap&& other) noexcept
+                : StaticUnorderedMap()
+            {
+                hash_ = other.hash_;
+                equal_ = other.equal_;
+                copy_slots(std::move(other));
+            }
+
+            StaticUnorderedMap& operator=(const StaticUnorderedMap& other)
+            {
+                if (&other != this) {
+                    clear();
+                    hash_ = other.hash_;
+                    equal_ = other.equal_;
+                    copy_slots(other);
+                }
+                return *this;
+            }
+            StaticUnorderedMap& operator=(StaticUnorderedMap&& other) noexcept
+            {
+                if (&other != this) {
+                    clear();
+                    hash_ = other.hash_;
+                    equal_ = other.equal_;
+                    copy_slots(std::move(other));
+                }
+                return *this;
+            }
+
+            ~StaticUnorderedMap() { clear(); }
+
+            // Iterators
+
+            [[nodiscard]] iterator begin() noexcept { return {this, 0}; }
+            [[nodiscard]] const_iterator begin() const noexcept { return {this, 0}; }
+            [[nodiscard]] iterator end() noexcept { return {this, slot_count}; }
+            [[nodiscard]] const_iterator end() const noexcept { return {this, slot_count}; }
+            [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+            [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+            // Capacity
+
+            [[nodiscard]] size_type size() const noexcept { return size_; }
+            [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+            [[nodiscard]] static constexpr size_type max_size() noexcept { return Capacity; }
+            [[nodiscard]] static constexpr size_type capacity() noexcept { return Capacity; }
+
+            // Modifiers
+
+            void clear() noexcept
+            {
+                if constexpr (!std::is_trivially_destructible_v<Key> || !std::is_trivially_destructible_v<T>) {
+                    for (std::size_t slot = 0; slot < slot_count && size_ != 0; ++slot) {
+                        if (controls_[slot] != control_empty) {
+                            destroy_slot(slot);
+                            --size_;
+                        }
+                    }
+                }
+                controls_.fill(control_empty);
+                size_ = 0;
+            }
+
+            template<typename... Args>
+            std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args)
+            {
+                return try_emplace_impl(key, std::forward<Args>(args)...);
+            }
+            template<typename... Args>
+            std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args)
+            {
+                return try_emplace_impl(std::move(key), std::forward<Args>(args)...);
+            }
+            template<typename... Args>
+            std::pair<iterator, bool> emplace(Args&&... args)
+            {
+                value_type value(std::forward<Args>(args)...);
+                return try_emplace_impl(std::move(value.first), std::move(value.second));
+            }
+            std::pair<iterator, bool> insert(const value_type& value) { return try_emplace_impl(value.first, value.second); }
+            std::pair<iterator, bool> insert(value_type&& value) { return try_emplace_impl(std::move(value.first), std::move(value.second)); }
+
+            template<typename M>
+            std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& object)
+            {
+                auto result = try_emplace_impl(key, std::forward<M>(object));
+                if (!result.second) {
+                    values_.data()[result.first.slot_] = std::forward<M>(object);
+                }
+                return result;
+            }
+
+            // Returns the number of erased elements (0 or 1)
+            size_type erase(const key_type& key) { return erase_key(key); }
+            template<typename K>
+                requires transparent<K>
+            size_type erase(const K& key)
+            {
+                return erase_key(key);
+            }
+            // Erasing shifts later elements back and invalidates iterators, use erase_if() to remove while iterating
+            void erase(const_iterator position)
+            {
+                ORION_ASSERT(position.slot_ < slot_count && controls_[position.slot_] != control_empty);
+                erase_slot(position.slot_);
+            }
+
+            // Lookup, the template overloads take any key type when both Hash and KeyEqual are transparent
+
+            [[nodiscard]] iterator find(const key_type& key) noexcept { return {this, find_slot(key)}; }
+            [[nodiscard]] const_iterator find(const key_type& key) const noexcept { return {this, find_slot(key)}; }
+            template<typename K>
+                requires transparent<K>
+            [[nodiscard]] iterator find(const K& key) noexcept
+            {
+                return {this, find_slot(key)};
+            }
+            template<typename K>
+                requires transparent<K>
+            [[nodiscard]] const_iterator find(const K& key) const noexcept
+            {
+                return {this, find_slot(key)};
+            }
+
+            [[nodiscard]] bool contains(const key_type& key) const noexcept { return find_slot(key) != slot_count; }
+            template<typename K>
+                requires transparent<K>
+            [[nodiscard]] bool contains(const K& key) const noexcept
+            {
+                return find_slot(key) != slot_count;
+            }
+            [[nodiscard]] size_type count(const key_type& key) const noexcept { return contains(key) ? 1 : 0; }
+            template<typename K>
+                requires transparent<K>
+            [[nodiscard]] size_type count(const K& key) const noexcept
+            {
+                return contains(key) ? 1 : 0;
+            }
+
+            [[nodiscard]] mapped_type& at(const key_type& key) { return values_.data()[existing_slot(key)]; }
+            [[nodiscard]] const mapped_type& at(const key_type& key) const { return values_.data()[existing_slot(key)]; }
+            template<typename K>
+                requires transparent<K>
+            [[nodiscard]] mapped_type& at(const K& key)
+            {
+                return values_.data()[existing_slot(key)];
+            }
+            template<typename K>
+                requires transparent<K>
+            [[nodiscard]] const mapped_type& at(const K& key) const
+            {
+                return values_.data()[existing_slot(key)];
+            }
+            mapped_type& operator[](const key_type& key) { return try_emplace(key).first->second; }
+            mapped_type& operator[](key_type&& key) { return try_emplace(std::move(key)).first->second; }
+
+            // Removes every element matching predicate(pair<const Key&, const T&>) and returns how many were removed.
+            // Survivors are moved closer to their home slot afterwards, in one pass over the table
+            template<typename Predicate>
+            size_type erase_if(Predicate predicate)
+            {
+                if (empty()) {
+                    return 0;
+                }
+                // No probe sequence crosses a slot that is empty before anything is removed, start right after one
+                std::size_t start = 0;
+                while (controls_[start] != control_empty) {
+                    ++start;
+                }
+
+                size_type removed = 0;
+                for (std::size_t slot = 0; slot < slot_count; ++slot) {
+                    if (controls_[slot] != control_empty && predicate(std::pair<const Key&, const T&>(keys_.data()[slot], values_.data()[slot]))) {
+                        destroy_slot(slot);
+                        set_control(slot, control_empty);
+                        ++removed;
+                    }
+                }
+                size_ -= removed;
+
+                if (removed != 0) {
+                    for (std::size_t offset = 1; offset <= slot_count; ++offset) {
+                        const auto slot = (start + offset) & slot_mask;
+                        if (controls_[slot] == control_empty) {
+                            continue;
+                        }
+                        for (auto target = home_slot(hash_of(keys_.data()[slot])); target != slot; target = (target + 1) & slot_mask) {
+                            if (controls_[target] == control_empty) {
+                                move_slot(slot, target);
+                                break;
+                            }
+                        }
+                    }
+                }
+                return removed;
+            }
+
+            // Observers
+
+            [[nodiscard]] hasher hash_function() const { return hash_; }
+            [[nodiscard]] key_equal key_eq() const { return equal_; }
+
+        private:
+            // The maps share the slot layout, elements go to the same slot without rehashing. *this must be empty
+            void copy_slots(const StaticUnorderedMap& other)
+            {
+                for (std::size_t slot = 0; slot < slot_count; ++slot) {
+                    if (other.controls_[slot] != control_empty) {
+                        construct_slot(slot, other.controls_[slot], other.keys_.data()[slot], other.values_.data()[slot]);
+                    }
+                }
+            }
+            void copy_slots(StaticUnorderedMap&& other) noexcept
+            {
+                for (std::size_t slot = 0; slot < slot_count; ++slot) {
+                    if (other.controls_[slot] != control_empty) {
+                        construct_slot(slot, other.controls_[slot], std::move(other.keys_.data()[slot]), std::move(other.values_.data()[slot]));
+                    }
+                }
+            }
+
+            template<typename K, typename... Args>
+            void construct_slot(std::size_t slot, std::uint8_t control, K&& key, Args&&... args)
+            {
+                std::construct_at(keys_.data() + slot, std::forward<K>(key));
+                try {
+                    std::construct_at(values_.data() + slot, std::forward<Args>(args)...);
+                } catch (...) {
+                    std::destroy_at(keys_.data() + slot);
+                    throw;
+                }
+                set_control(slot, control);
+                ++size_;
+            }
+
+            static constexpr std::uint64_t mix(std::size_t hash) noexcept
+            {
+                // std::hash is the identity for integers, spread the bits before splitting the hash
+                const auto mixed = static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15;
+                return mixed ^ (mixed >> 32);
+            }
+            static constexpr std::size_t home_slot(std::uint64_t hash) noexcept { return static_cast<std::size_t>(hash >> 7) & slot_mask; }
+            static constexpr std::uint8_t h2(std::uint64_t hash) noexcept { return static_cast<std::uint8_t>(hash & 0x7F); }
+
+            template<typename K>
+            std::uint64_t hash_of(const K& key) const noexcept
+            {
+                return mix(hash_(key));
+            }
+
+            // Slot holding the key, slot_count when it isn't in the map
+            template<typename K>
+            std::size_t find_slot(const K& key) const noexcept
+            {
+                const auto hash = hash_of(key);
+                const auto fingerprint = h2(hash);
+                for (auto position = home_slot(hash);; position = (position + ControlGroup::width) & slot_mask) {
+                    const ControlGroup group(controls_.data() + position);
+                    for (auto match = group.match(fingerprint); match; match.clear_lowest()) {
+                        const auto slot = (position + match.lowest()) & slot_mask;
+                        if (equal_(keys_.data()[slot], key)) {
+                            return slot;
+                        }
+                    }
+                    // Probe sequences have no holes, an empty slot ends the search
+                    if (group.match_empty()) {
+                        return slot_count;
+                    }
+                }
+            }
+
+            template<typename K>
+            std::size_t existing_slot(const K& key) const noexcept
+            {
+                const auto slot = find_slot(key);
+                ORION_ASSERT(slot != slot_count, "key not found");
+                return slot;
+            }
+
+            template<typename K>
+            size_type erase_key(const K& key)
+            {
+                const auto slot = find_slot(key);
+                if (slot == slot_count) {
+                    return 0;
+                }
+                erase_slot(slot);
+                return 1;
+            }
+
+            template<typename K, typename... Args>
+            std::pair<iterator, bool> try_emplace_impl(K&& key, Args&&... args)
+            {
+                const auto hash = hash_of(key);
+                const auto fingerprint = h2(hash);
+                for (auto position = home_slot(hash);; position = (position + ControlGroup::width) & slot_mask) {
+                    const ControlGroup group(controls_.data() + position);
+                    for (auto match = group.match(fingerprint); match; match.clear_lowest()) {
+                        const auto slot = (position + match.lowest()) & slot_mask;
+                        if (equal_(keys_.data()[slot], key)) {
+                            return {iterator{this, slot}, false};
+                        }
+                    }
+                    if (const auto empty = group.match_empty()) {
+                        // The first empty slot of the probe sequence, keeps it free of holes
+                        ORION_ASSERT(size() < max_size());
+                        const auto slot = (position + empty.lowest()) & slot_mask;
+                        construct_slot(slot, fingerprint, std::forward<K>(key), std::forward<Args>(args)...);
+                        return {iterator{this, slot}, true};
+                    }
+                }
+            }
+
+            // Backward shift deletion: walks the rest of the probe run and moves back every element whose home
+            // slot allows it, so no tombstone is needed
+            void erase_slot(std::size_t hole)
+            {
+                destroy_slot(hole);
+                set_control(hole, control_empty);
+                --size_;
+                for (auto slot = (hole + 1) & slot_mask; controls_[slot] != control_empty; slot = (slot + 1) & slot_mask) {
+                    const auto home = home_slot(hash_of(keys_.data()[slot]));
+                    // The element may move to the hole if the hole lies on its probe path [home, slot)
+                    if (((slot - home) & slot_mask) >= ((slot - hole) & slot_mask)) {
+                        move_slot(slot, hole);
+                        hole = slot;
+                    }
+                }
+            }
+
+            void move_slot(std::size_t from, std::size_t to) noexcept
+            {
+                orion::uninitialized_relocate(keys_.data() + from, keys_.data() + from + 1, keys_.data() + to);
+                orion::uninitialized_relocate(values_.data() + from, values_.data() + from + 1, values_.data() + to);
+                set_control(to, controls_[from]);
+                set_control(from, control_empty);
+            }
+
+            void destroy_slot(std::size_t slot) noexcept
+            {
+                std::destroy_at(keys_.data() + slot);
+                std::destroy_at(values_.data() + slot);
+            }
+
+            void set_control(std::size_t slot, std::uint8_t control) noexcept
+            {
+                controls_[slot] = control;
+                if (slot < ControlGroup::width - 1) {
+                    controls_[slot_count + slot] = control;
+                }
+            }
+
+            std::array<std::uint8_t, control_count> controls_;
+            UninitializedStorage<Key, slot_count> keys_;
+            UninitializedStorage<T, slot_count> values_;
+            size_type size_ = 0;
+            [[no_unique_address]] Hash hash_;
+            [[no_unique_address]] KeyEqual equal_;
+        };
+    } // namespace detail
+
+    template<typename Key, typename T, std::size_t Capacity, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    using static_unordered_map = detail::StaticUnorderedMap<Key, T, Capacity, Hash, KeyEqual>;
+
+    // Removes every element matching the predicate, returns the number of removed elements
+    template<typename Key, typename T, std::size_t Capacity, typename Hash, typename KeyEqual, typename Predicate>
+    auto erase_if(detail::StaticUnorderedMap<Key, T, Capacity, Hash, KeyEqual>& map, Predicate predicate)
+    {
+        return map.erase_if(std::move(predicate));
+    }
+} // namespace orion
@@ -1,15 +1,19 @@
 #pragma once
 
 #include "orion-utils/assertion.h"     // ORION_ASSERT
-#include "orion-utils/uninitialized.h" // orion::UninitializedArray, orion::uninitialized_default_construct
+#include "orion-utils/type.h"          // orion::min_unsigned_t
+#include "orion-utils/uninitialized.h" // orion::UninitializedStorage, orion::uninitialized_*, orion::is_trivially_relocatable
 
-#include <algorithm>        // std::move_backwards, std::move, std::equal
+#include <algorithm>        // std::move_backward, std::move, std::equal, std::copy, std::fill_n, std::rotate, std::remove_if, std::ranges::adjacent_find
 #include <cstddef>          // std::size_t, std::ptrdiff_t
+#include <functional>       // std::ranges::greater_equal
 #include <initializer_list> // std::initializer_list
-#include <iterator>         // std::reverse_iterator
-#include <limits>           // std::numeric_limits
-#include <memory>           // std::destroy_n
+#include <iterator>         // std::reverse_iterator, std::make_move_iterator
+#include <memory>           // std::destroy_n, std::destroy, std::destroy_at
+#include <ranges>           // std::ranges::input_range, std::ranges::subrange
+#include <span>             // std::span
 #include <type_traits>      // std::make_signed, std::is_*
+#include <utility>          // std::exchange
 
 namespace orion
 {
@@ -21,17 +25,7 @@ namespace orion
         public:
             static consteval auto find_min_size_type() noexcept
             {
-                if constexpr (Capacity <= std::numeric_limits<std::uint8_t>::max()) {
-                    return std::uint8_t{};
-                } else if constexpr (Capacity <= std::numeric_limits<std::uint16_t>::max()) {
-                    return std::uint16_t{};
-                } else if constexpr (Capacity <= std::numeric_limits<std::uint32_t>::max()) {
-                    return std::uint32_t{};
-                } else if constexpr (Capacity <= std::numeric_limits<std::uint64_t>::max()) {
-                    return std::uint64_t{};
-                } else {
-                    return std::uintmax_t{};
-                }
+                return min_unsigned_t<Capacity>{};
             }
 
             using value_type = T;
@@ -66,10 +60,8 @@ namespace orion
 
             template<std::input_iterator InputIt>
             constexpr StaticVector(InputIt first, InputIt last)
-                : size_(static_cast<size_type>(std::distance(first, last)))
             {
-                ORION_ASSERT(size() <= max_size());
-                orion::uninitialized_copy(first, last, begin());
+                assign(first, last);
             }
 
             constexpr StaticVector(const StaticVector& other) noexcept(std::is_nothrow_copy_constructible_v<value_type>)
@@ -81,7 +73,13 @@ namespace orion
             constexpr StaticVector(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>)
                 : size_(other.size_)
             {
-                orion::uninitialized_move(other.begin(), other.end(), begin());
+                if constexpr (is_trivially_relocatable_v<value_type>) {
+                    // Relocated elements are gone from other, which is left empty
+                    orion::uninitialized_relocate(other.begin(), other.end(), begin());
+                    other.size_ = 0;
+                } else {
+                    orion::uninitialized_move(other.begin(), other.end(), begin());
+                }
             }
 
             constexpr StaticVector& operator=(const StaticVector& other) noexcept(std::is_nothrow_copy_assignable_v<value_type>)
@@ -98,12 +96,62 @@ namespace orion
             {
                 if (&other != this) {
                     clear();
-                    orion::uninitialized_move(other.begin(), other.end(), begin());
-                    size_ = other.size_;
+                    if constexpr (is_trivially_relocatable_v<value_type>) {
+                        orion::uninitialized_relocate(other.begin(), other.end(), begin());
+                        size_ = std::exchange(other.size_, size_type{0});
+                    } else {
+                        orion::uninitialized_move(other.begin(), other.end(), begin());
+                        size_ = other.size_;
+                    }
                 }
                 return *this;
             }
 
+            constexpr void assign(size_type count, const_reference value)
+            {
+                ORION_ASSERT(count <= max_size());
+                std::fill_n(begin(), std::min(count, size_), value);
+                if (count > size_) {
+                    orion::uninitialized_fill(end(), begin() + count, value);
+                } else {
+                    std::destroy(begin() + count, end());
+                }
+                size_ = count;
+            }
+            template<std::input_iterator InputIt>
+            constexpr void assign(InputIt first, InputIt last)
+            {
+                assign_range(std::ranges::subrange(first, last));
+            }
+            constexpr void assign(std::initializer_list<value_type> list)
+            {
+                assign(list.begin(), list.end());
+            }
+            template<std::ranges::input_range Range>
+            constexpr void assign_range(Range&& range)
+            {
+                if constexpr (std::ranges::forward_range<Range>) {
+                    // Checked before narrowing, a range longer than size_type can hold would wrap around
+                    const auto distance = static_cast<std::size_t>(std::ranges::distance(range));
+                    ORION_ASSERT(distance <= max_size());
+                    const auto count = static_cast<size_type>(distance);
+                    auto first = std::ranges::begin(range);
+                    auto mid = std::ranges::next(first, std::min(count, size_));
+                    std::copy(first, mid, begin());
+                    if (count > size_) {
+                        orion::uninitialized_copy(mid, std::ranges::next(mid, count - size_), end());
+                    } else {
+                        std::destroy(begin() + count, end());
+                    }
+                    size_ = count;
+                } else {
+                    clear();
+                    for (auto&& element : range) {
+                        emplace_back(std::forward<decltype(element)>(element));
+                    }
+                }
+            }
+
             constexpr ~StaticVector()
                 requires std::is_trivially_destructible_v<value_type>
             = default;
@@ -125,14 +173,14 @@ namespace orion
             [[nodiscard]] constexpr const_iterator begin() const noexcept { return data(); }
             [[nodiscard]] constexpr iterator end() noexcept { return data() + size_; }
             [[nodiscard]] constexpr const_iterator end() const noexcept { return data() + size_; }
-            [[nodiscard]] constexpr reverse_iterator rbegin() noexcept { return data() + size_ - 1; }
-            [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return data() + size_ - 1; }
-            [[nodiscard]] constexpr reverse_iterator rend() noexcept { return data() - 1; }
-            [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return data() - 1; }
+            [[nodiscard]] constexpr reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+            [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+            [[nodiscard]] constexpr reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+            [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
             [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return data(); }
             [[nodiscard]] constexpr const_iterator cend() const noexcept { return data() + size_; }
-            [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept { return data() + size_ - 1; }
-            [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept { return data() - 1; }
+            [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+            [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept { return rend(); }
 
             [[nodiscard]] constexpr reference operator[](size_type n)
             {
@@ -173,16 +221,43 @@ namespace orion
                 size_ = 0;
             }
 
+            constexpr void resize(size_type count)
+                requires std::is_default_constructible_v<value_type>
+            {
+                ORION_ASSERT(count <= max_size());
+                if (count > size_) {
+                    orion::uninitialized_default_construct(end(), begin() + count);
+                } else {
+                    std::destroy(begin() + count, end());
+                }
+                size_ = count;
+            }
+            constexpr void resize(size_type count, const_reference value)
+            {
+                ORION_ASSERT(count <= max_size());
+                if (count > size_) {
+                    orion::uninitialized_fill(end(), begin() + count, value);
+                } else {
+                    std::destroy(begin() + count, end());
+                }
+                size_ = count;
+            }
+
             template<typename... Args>
             constexpr iterator emplace(const_iterator position, Args&&... args)
             {
                 ORION_ASSERT(size() < max_size());
                 ORION_ASSERT(position <= end());
-                auto where = const_cast<iterator>(position);
-                std::move_backward(where, end(), end() + 1);
-                std::construct_at(std::addressof(*position), std::forward<Args>(args)...);
-                ++size_;
-                return where;
+                if (position == end()) {
+                    auto where = std::construct_at(end(), std::forward<Args>(args)...);
+                    ++size_;
+                    return where;
+                }
+                // args may refer to an element that is about to be shifted
+                value_type value(std::forward<Args>(args)...);
+                return insert_gap(position, 1, [&](iterator where) {
+                    std::construct_at(where, std::move(value));
+                });
             }
             template<typename... Args>
             constexpr iterator emplace_back(Args&&... args)
@@ -207,46 +282,113 @@ namespace orion
             {
                 return emplace(position, std::move(value));
             }
+            constexpr iterator insert(const_iterator position, size_type count, const_reference value)
+            {
+                // value may refer to an element that is about to be shifted
+                const value_type copy = value;
+                return insert_gap(position, count, [&](iterator where) {
+                    orion::uninitialized_fill(where, where + count, copy);
+                });
+            }
             template<std::input_iterator InputIt>
             constexpr iterator insert(const_iterator position, InputIt first, InputIt last)
             {
-                iterator inserted = nullptr;
-                for (; first != last; ++first, (void)++position) {
-                    inserted = emplace(position, *first);
-                }
-                return inserted;
+                return insert_range(position, std::ranges::subrange(first, last));
             }
             constexpr iterator insert(const_iterator position, std::initializer_list<value_type> list)
             {
-                iterator inserted = nullptr;
-                for (auto iter = list.begin(); iter != list.end(); ++iter, (void)++position) {
-                    inserted = emplace(position, *iter);
+                return insert(position, list.begin(), list.end());
+            }
+            template<std::ranges::input_range Range>
+            constexpr iterator insert_range(const_iterator position, Range&& range)
+            {
+                if constexpr (std::ranges::forward_range<Range>) {
+                    const auto distance = static_cast<std::size_t>(std::ranges::distance(range));
+                    ORION_ASSERT(distance <= std::size_t{max_size()} - size());
+                    const auto count = static_cast<size_type>(distance);
+                    auto first = std::ranges::begin(range);
+                    auto last = std::ranges::next(first, count);
+                    return insert_gap(position, count, [&](iterator where) {
+                        orion::uninitialized_copy(first, last, where);
+                    });
+                } else {
+                    // Single pass ranges can't be measured up front, append and rotate into place instead
+                    const auto offset = position - begin();
+                    const auto old_size = size();
+                    for (auto&& element : range) {
+                        emplace_back(std::forward<decltype(element)>(element));
+                    }
+                    std::rotate(begin() + offset, begin() + old_size, end());
+                    return begin() + offset;
                 }
-                return inserted;
+            }
+            template<std::ranges::input_range Range>
+            constexpr void append_range(Range&& range)
+            {
+                insert_range(end(), std::forward<Range>(range));
             }
 
             constexpr iterator erase(const_iterator position)
             {
-                ORION_ASSERT(position <= end());
-                auto where = const_cast<iterator>(position);
-                std::destroy_at(std::addressof(*where));
-                std::move(where + 1, end(), where);
-                --size_;
-                return where;
+                ORION_ASSERT(position < end());
+                return erase(position, position + 1);
             }
             constexpr iterator erase(const_iterator first, const_iterator last)
             {
-                ORION_ASSERT(last <= end());
+                ORION_ASSERT(first <= last && last <= end());
                 auto where = const_cast<iterator>(first);
-                size_type count = 0;
-                for (; first != last; ++first, (void)++count) {
-                    std::destroy_at(std::addressof(*first));
+                auto gap_last = const_cast<iterator>(last);
+                if (where == gap_last) {
+                    return where;
                 }
-                std::move(const_cast<iterator>(last), end(), where);
-                size_ -= count;
+                std::destroy(where, gap_last);
+                detail::close_gap(where, gap_last, end());
+                size_ -= static_cast<size_type>(gap_last - where);
                 return where;
             }
 
+            // Removes an element in O(1) by moving the last element into its place, doesn't keep the order
+            constexpr iterator erase_unordered(const_iterator position)
+            {
+                ORION_ASSERT(position < end());
+                auto where = const_cast<iterator>(position);
+                auto last = end() - 1;
+                if (where == last) {
+                    std::destroy_at(last);
+                } else if constexpr (is_trivially_relocatable_v<value_type>) {
+                    std::destroy_at(where);
+                    orion::uninitialized_relocate(last, end(), where);
+                } else {
+                    *where = std::move(*last);
+                    std::destroy_at(last);
+                }
+                --size_;
+                return where;
+            }
+            constexpr iterator swap_remove(const_iterator position)
+            {
+                return erase_unordered(position);
+            }
+
+            // Removes the elements at the given sorted, unique indices in a single pass, keeping the order
+            // of the others. Every remaining element is moved at most once
+            constexpr void remove_indices(std::span<const std::size_t> indices)
+            {
+                if (indices.empty()) {
+                    return;
+                }
+                ORION_ASSERT(indices.back() < size());
+                ORION_ASSERT_AUDIT(std::ranges::adjacent_find(indices, std::ranges::greater_equal{}) == indices.end());
+                auto out = begin() + indices.front();
+                for (std::size_t i = 0; i < indices.size(); ++i) {
+                    auto kept_first = begin() + indices[i] + 1;
+                    auto kept_last = i + 1 < indices.size() ? begin() + indices[i + 1] : end();
+                    out = std::move(kept_first, kept_last, out);
+                }
+                std::destroy(out, end());
+                size_ = static_cast<size_type>(out - begin());
+            }
+
             constexpr void pop_back()
             {
                 erase(end() - 1);
@@ -254,10 +396,30 @@ namespace orion
 
             [[nodiscard]] constexpr friend bool operator==(const StaticVector& lhs, const StaticVector& rhs)
             {
-                return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+                return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
             }
 
         private:
+            template<typename Construct>
+            constexpr iterator insert_gap(const_iterator position, size_type count, Construct&& construct)
+            {
+                ORION_ASSERT(position >= begin() && position <= end());
+                ORION_ASSERT(count <= max_size() - size());
+                if (count == 0) {
+                    return const_cast<iterator>(position);
+                }
+                auto where = const_cast<iterator>(position);
+                detail::open_gap(where, end(), count);
+                try {
+                    construct(where);
+                } catch (...) {
+                    detail::close_gap(where, where + count, end() + count);
+                    throw;
+                }
+                size_ += count;
+                return where;
+            }
+
             UninitializedStorage<value_type, Capacity> elements_{};
             size_type size_ = 0;
         };
@@ -265,4 +427,34 @@ namespace orion
 
     template<typename T, std::size_t Capacity>
     using static_vector = detail::StaticVector<T, Capacity>;
+
+    // Removes every element matching the predicate in a single pass, keeping the order of the others.
+    // Returns the number of removed elements
+    template<typename T, std::size_t Capacity, typename Predicate>
+    constexpr auto erase_if(detail::StaticVector<T, Capacity>& vector, Predicate predicate)
+    {
+        auto removed = std::remove_if(vector.begin(), vector.end(), std::move(predicate));
+        const auto count = static_cast<typename detail::StaticVector<T, Capacity>::size_type>(vector.end() - removed);
+        vector.erase(removed, vector.end());
+        return count;
+    }
+
+    template<typename T, std::size_t Capacity, typename U>
+    constexpr auto erase(detail::StaticVector<T, Capacity>& vector, const U& value)
+    {
+        return orion::erase_if(vector, [&value](const T& element) { return element == value; });
+    }
+
+    // Moves the static_vector returned by Builder into one whose capacity is exactly its size.
+    // A constexpr variable can't hold uninitialized elements, so tables of non-trivially default
+    // constructible types built at compile time must be stored full:
+    //     static constexpr auto table = orion::fit_static_vector<[]() { ...; return vector; }>();
+    template<auto Builder>
+    consteval auto fit_static_vector()
+    {
+        using value_type = typename decltype(Builder())::value_type;
+        constexpr std::size_t size = Builder().size();
+        auto built = Builder();
+        return static_vector<value_type, size>(std::make_move_iterator(built.begin()), std::make_move_iterator(built.end()));
+    }
 } // namespace orion
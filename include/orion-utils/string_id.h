@@ -0,0 +1,177 @@
+#pragma once
+
+#include "orion-utils/assertion.h" // ORION_ASSERT
+#include "orion-utils/hash.h"      // orion::hash_bytes
+
+#include <algorithm>     // std::copy_n
+#include <array>         // std::array
+#include <compare>       // std::strong_ordering
+#include <cstddef>       // std::size_t
+#include <cstdint>       // std::uint64_t
+#include <functional>    // std::hash
+#include <mutex>         // std::mutex, std::scoped_lock
+#include <string>        // std::string
+#include <string_view>   // std::string_view
+#include <type_traits>   // std::is_constant_evaluated
+#include <unordered_map> // std::unordered_map
+
+#include <fmt/format.h> // fmt::formatter, fmt::format_to_n
+
+// Reverse lookup from string ids to their names, on by default in debug builds
+#ifndef ORION_STRING_ID_LOOKUP
+    #ifndef NDEBUG
+        #define ORION_STRING_ID_LOOKUP 1
+    #else
+        #define ORION_STRING_ID_LOOKUP 0
+    #endif
+#endif
+
+namespace orion
+{
+    namespace detail
+    {
+#if ORION_STRING_ID_LOOKUP
+        // Names of the ids hashed at run time. Entries are never removed, so the views handed out stay valid
+        class StringIdRegistry
+        {
+        public:
+            static StringIdRegistry& instance()
+            {
+                static StringIdRegistry registry;
+                return registry;
+            }
+
+            void add(std::uint64_t id, std::string_view name)
+            {
+                const std::scoped_lock lock{mutex_};
+                [[maybe_unused]] const auto [it, inserted] = names_.try_emplace(id, name);
+                ORION_ASSERT(inserted || it->second == name, "string id collision between \"{}\" and \"{}\"", it->second, name);
+            }
+
+            [[nodiscard]] std::string_view find(std::uint64_t id) const
+            {
+                const std::scoped_lock lock{mutex_};
+                const auto it = names_.find(id);
+                return it != names_.end() ? std::string_view{it->second} : std::string_view{};
+            }
+
+        private:
+            mutable std::mutex mutex_;
+            std::unordered_map<std::uint64_t, std::string> names_;
+        };
+#endif
+
+        // Characters of a _sid literal passed as a template argument, so each literal can record its name once
+        template<std::size_t Size>
+        struct StringIdLiteral {
+            consteval StringIdLiteral(const char (&name)[Size]) { std::copy_n(name, Size, chars); }
+
+            [[nodiscard]] constexpr std::string_view view() const noexcept { return {chars, Size - 1}; }
+
+            char chars[Size]{};
+        };
+
+        // Name reduced to its 64-bit hash, compared and hashed as an integer. Ids hashed at compile time through
+        // the _sid literal cost nothing at run time, ids of names only known at run time (e.g. read from an
+        // asset) hash the name once and equal the literal of the same name
+        class StringId
+        {
+        public:
+            using value_type = std::uint64_t;
+
+            constexpr StringId() noexcept = default;
+
+            // Outside constant evaluation the name is recorded for name() when ORION_STRING_ID_LOOKUP is on
+            constexpr explicit StringId(std::string_view name)
+                : value_(orion::hash_bytes(name))
+            {
+#if ORION_STRING_ID_LOOKUP
+                if (!std::is_constant_evaluated()) {
+                    StringIdRegistry::instance().add(value_, name);
+                }
+#endif
+            }
+
+            // Id from a value stored earlier, e.g. in a serialized asset
+            [[nodiscard]] static constexpr StringId from_value(value_type value) noexcept
+            {
+                StringId id;
+                id.value_ = value;
+                return id;
+            }
+
+            [[nodiscard]] constexpr value_type value() const noexcept { return value_; }
+
+            // Name the id was hashed from, empty when it is unknown or the lookup is compiled out. _sid literals
+            // are recorded at startup, ids from make_string_id only once the same name is hashed at run time
+            [[nodiscard]] std::string_view name() const
+            {
+#if ORION_STRING_ID_LOOKUP
+                return StringIdRegistry::instance().find(value_);
+#else
+                return {};
+#endif
+            }
+
+            [[nodiscard]] constexpr friend bool operator==(StringId lhs, StringId rhs) noexcept = default;
+            [[nodiscard]] constexpr friend std::strong_ordering operator<=>(StringId lhs, StringId rhs) noexcept = default;
+
+        private:
+            value_type value_ = 0;
+        };
+
+#if ORION_STRING_ID_LOOKUP
+        // Initialized at startup for every _sid literal in the program. Calls the registry directly, the StringId
+        // constructor would be constant evaluated here and record nothing
+        template<StringIdLiteral Name>
+        inline const bool string_id_literal_recorded = (StringIdRegistry::instance().add(orion::hash_bytes(Name.view()), Name.view()), true);
+#endif
+    } // namespace detail
+
+    using string_id = detail::StringId;
+
+    // Id computed at compile time, e.g. for a name that isn't a literal but a constant. Unlike _sid literals its
+    // name is not recorded for name()
+    [[nodiscard]] consteval string_id make_string_id(std::string_view name)
+    {
+        return string_id{name};
+    }
+
+    inline namespace literals
+    {
+        // "transform"_sid
+        template<detail::StringIdLiteral Name>
+        [[nodiscard]] consteval string_id operator""_sid()
+        {
+#if ORION_STRING_ID_LOOKUP
+            // Odr-using the variable instantiates it, no code runs here
+            static_cast<void>(&detail::string_id_literal_recorded<Name>);
+#endif
+            return string_id{Name.view()};
+        }
+    } // namespace literals
+} // namespace orion
+
+// The value is already a well mixed hash
+template<>
+struct std::hash<orion::detail::StringId> {
+    [[nodiscard]] std::size_t operator()(orion::detail::StringId id) const noexcept
+    {
+        return static_cast<std::size_t>(id.value());
+    }
+};
+
+// Formats the name when it is known, the value in hex otherwise
+template<>
+struct fmt::formatter<orion::detail::StringId> : fmt::formatter<std::string_view> {
+    template<typename FormatContext>
+    auto format(orion::detail::StringId id, FormatContext& context) const
+    {
+        if (const auto name = id.name(); !name.empty()) {
+            return fmt::formatter<std::string_view>::format(name, context);
+        }
+        std::array<char, 18> buffer{};
+        const auto result = fmt::format_to_n(buffer.data(), buffer.size(), "#{:016x}", id.value());
+        return fmt::formatter<std::string_view>::format(std::string_view{buffer.data(), result.size}, context);
+    }
+};
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <type_traits>
 
 namespace orion
@@ -14,6 +17,20 @@ namespace orion
     template<typename... Ts>
     concept not_empty = (sizeof...(Ts) > 0);
 
+    // Smallest unsigned integer type that can hold every value in [0, Max]
+    template<std::uintmax_t Max>
+    using min_unsigned_t = std::conditional_t<
+        Max <= std::numeric_limits<std::uint8_t>::max(), std::uint8_t,
+        std::conditional_t<
+            Max <= std::numeric_limits<std::uint16_t>::max(), std::uint16_t,
+            std::conditional_t<
+                Max <= std::numeric_limits<std::uint32_t>::max(), std::uint32_t,
+                std::conditional_t<Max <= std::numeric_limits<std::uint64_t>::max(), std::uint64_t, std::uintmax_t>>>>;
+
+    // Alignment that keeps data written by different threads on separate cache lines. Fixed instead of
+    // std::hardware_destructive_interference_size so the layout does not change with compiler flags
+    inline constexpr std::size_t cache_line_size = 64;
+
     template<typename Enum>
     [[nodiscard]] constexpr auto to_underlying(Enum value) noexcept -> std::underlying_type_t<Enum>
     {
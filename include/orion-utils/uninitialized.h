@@ -1,13 +1,73 @@
 #pragma once
 
+#include <algorithm>   // std::fill, std::move, std::move_backward
 #include <array>       // std::array
+#include <concepts>    // std::same_as
 #include <cstddef>     // std::byte
-#include <iterator>    // std::forward_iterator, std::iterator_traits
-#include <memory>      // std::addressof, std::construct_at, std::destroy_at, std::destroy
+#include <cstring>     // std::memcpy, std::memmove
+#include <iterator>    // std::forward_iterator, std::contiguous_iterator, std::iter_value_t
+#include <memory>      // std::addressof, std::construct_at, std::destroy_at, std::destroy, std::to_address
 #include <type_traits> // std::is_trivially_default_constructible, is_trivially_destructible, std::conditional
 
 namespace orion
 {
+    // A type is trivially relocatable if moving an object to a new address and destroying the old one
+    // is equivalent to copying its bytes. Trivially copyable types are always trivially relocatable,
+    // other types (e.g. ones holding a unique pointer) can opt in by specializing this trait
+    template<typename T>
+    struct is_trivially_relocatable : std::is_trivially_copyable<T> {
+    };
+
+    template<typename T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    namespace detail
+    {
+        template<typename InputIt, typename OutputIt>
+        concept same_contiguous = std::contiguous_iterator<InputIt> &&
+                                  std::contiguous_iterator<OutputIt> &&
+                                  std::same_as<std::iter_value_t<InputIt>, std::iter_value_t<OutputIt>>;
+
+        template<typename InputIt, typename OutputIt>
+        concept memcpy_copyable = same_contiguous<InputIt, OutputIt> &&
+                                  std::is_trivially_copyable_v<std::iter_value_t<OutputIt>>;
+
+        template<typename InputIt, typename OutputIt>
+        concept memcpy_relocatable = same_contiguous<InputIt, OutputIt> &&
+                                     is_trivially_relocatable_v<std::iter_value_t<OutputIt>>;
+
+        // Copies the bytes of [first, last) to out_first, the ranges may overlap
+        template<std::contiguous_iterator InputIt, std::contiguous_iterator OutputIt>
+        OutputIt memmove_range(InputIt first, InputIt last, OutputIt out_first) noexcept
+        {
+            const auto count = last - first;
+            if (count > 0) {
+                std::memmove(static_cast<void*>(std::to_address(out_first)),
+                             static_cast<const void*>(std::to_address(first)),
+                             static_cast<std::size_t>(count) * sizeof(std::iter_value_t<OutputIt>));
+            }
+            return out_first + count;
+        }
+    } // namespace detail
+
+    namespace detail
+    {
+        // Array of Capacity objects whose lifetimes are managed by the owner. Being a union member, the
+        // elements are neither constructed nor destroyed with the array, yet they are real T objects.
+        // Unlike a byte buffer this needs no reinterpret_cast, so it can be used in constant evaluation
+        template<typename T, std::size_t Capacity>
+        union UninitializedArray {
+            constexpr UninitializedArray() noexcept {}
+
+            constexpr ~UninitializedArray()
+                requires std::is_trivially_destructible_v<T>
+            = default;
+            constexpr ~UninitializedArray() {}
+
+            T elements[Capacity];
+        };
+    } // namespace detail
+
     template<typename T, std::size_t Capacity>
     class UninitializedStorage
     {
@@ -22,27 +82,27 @@ namespace orion
         using const_pointer = const T*;
         using storage_type = std::conditional_t<is_trivial_storage(),
                                                 std::array<T, Capacity>,
-                                                std::byte[sizeof(T) * Capacity]>;
+                                                detail::UninitializedArray<T, Capacity>>;
 
         [[nodiscard]] constexpr pointer data() noexcept
         {
             if constexpr (is_trivial_storage()) {
-                return static_cast<pointer>(storage_.data());
+                return storage_.data();
             } else {
-                return reinterpret_cast<pointer>(std::addressof(storage_));
+                return storage_.elements;
             }
         }
         [[nodiscard]] constexpr const_pointer data() const noexcept
         {
             if constexpr (is_trivial_storage()) {
-                return static_cast<const_pointer>(storage_.data());
+                return storage_.data();
             } else {
-                return reinterpret_cast<const_pointer>(std::addressof(storage_));
+                return storage_.elements;
             }
         }
 
     private:
-        alignas(alignof(T)) storage_type storage_;
+        storage_type storage_;
     };
 
     template<std::forward_iterator ForwardIt>
@@ -54,7 +114,7 @@ namespace orion
                 std::construct_at(std::addressof(*current));
             }
         } catch (...) {
-            std::destroy(first, last);
+            std::destroy(first, current);
             throw;
         }
     }
@@ -62,6 +122,15 @@ namespace orion
     template<std::forward_iterator ForwardIt, typename T>
     constexpr void uninitialized_fill(ForwardIt first, ForwardIt last, const T& value)
     {
+        using value_type = std::iter_value_t<ForwardIt>;
+        if constexpr (std::is_trivially_copyable_v<value_type> && std::is_copy_assignable_v<value_type> && std::same_as<value_type, T>) {
+            if (!std::is_constant_evaluated()) {
+                // Trivially copyable types begin their lifetime when their bytes are written
+                std::fill(first, last, value);
+                return;
+            }
+        }
+
         ForwardIt current = first;
         try {
             for (; current != last; ++current) {
@@ -78,6 +147,12 @@ namespace orion
     template<std::input_iterator InputIt, std::forward_iterator ForwardIt>
     constexpr ForwardIt uninitialized_copy(InputIt first, InputIt last, ForwardIt out_first)
     {
+        if constexpr (detail::memcpy_copyable<InputIt, ForwardIt>) {
+            if (!std::is_constant_evaluated()) {
+                return detail::memmove_range(first, last, out_first);
+            }
+        }
+
         ForwardIt current = out_first;
         try {
             for (; first != last; ++first, (void)++current) {
@@ -95,6 +170,12 @@ namespace orion
     template<std::input_iterator InputIt, std::forward_iterator ForwardIt>
     constexpr ForwardIt uninitialized_move(InputIt first, InputIt last, ForwardIt out_first)
     {
+        if constexpr (detail::memcpy_copyable<InputIt, ForwardIt>) {
+            if (!std::is_constant_evaluated()) {
+                return detail::memmove_range(first, last, out_first);
+            }
+        }
+
         ForwardIt current = out_first;
         try {
             for (; first != last; ++first, (void)++current) {
@@ -106,4 +187,92 @@ namespace orion
             throw;
         }
     }
+
+    // Moves [first, last) into the uninitialized range starting at out_first and destroys the source objects,
+    // leaving [first, last) uninitialized. The ranges may overlap if out_first comes before first.
+    // Trivially relocatable types are relocated with a single memmove at runtime
+    template<std::forward_iterator InputIt, std::forward_iterator ForwardIt>
+    constexpr ForwardIt uninitialized_relocate(InputIt first, InputIt last, ForwardIt out_first)
+    {
+        using value_type = std::iter_value_t<ForwardIt>;
+        static_assert(is_trivially_relocatable_v<value_type> || std::is_nothrow_move_constructible_v<value_type>,
+                      "Relocation can't be undone, moving must not throw");
+
+        if constexpr (detail::memcpy_relocatable<InputIt, ForwardIt>) {
+            if (!std::is_constant_evaluated()) {
+                return detail::memmove_range(first, last, out_first);
+            }
+        }
+
+        for (; first != last; ++first, (void)++out_first) {
+            std::construct_at(std::addressof(*out_first), std::move(*first));
+            std::destroy_at(std::addressof(*first));
+        }
+        return out_first;
+    }
+
+    // Same as uninitialized_relocate() but relocates back to front into the range ending at out_last,
+    // the ranges may overlap if out_last comes after last
+    template<std::bidirectional_iterator InputIt, std::bidirectional_iterator BidirIt>
+    constexpr BidirIt uninitialized_relocate_backward(InputIt first, InputIt last, BidirIt out_last)
+    {
+        using value_type = std::iter_value_t<BidirIt>;
+        static_assert(is_trivially_relocatable_v<value_type> || std::is_nothrow_move_constructible_v<value_type>,
+                      "Relocation can't be undone, moving must not throw");
+
+        if constexpr (detail::memcpy_relocatable<InputIt, BidirIt>) {
+            if (!std::is_constant_evaluated()) {
+                const auto out_first = out_last - (last - first);
+                detail::memmove_range(first, last, out_first);
+                return out_first;
+            }
+        }
+
+        while (first != last) {
+            std::construct_at(std::addressof(*--out_last), std::move(*--last));
+            std::destroy_at(std::addressof(*last));
+        }
+        return out_last;
+    }
+
+    namespace detail
+    {
+        // Shifts [first, last) back by count in a single pass, leaving [first, first + count) uninitialized.
+        // Shared by the vector types to make room for insertions
+        template<typename T>
+        constexpr void open_gap(T* first, T* last, std::size_t count)
+        {
+            if (first == last) {
+                return;
+            }
+            const auto offset = static_cast<std::ptrdiff_t>(count);
+            if constexpr (is_trivially_relocatable_v<T>) {
+                orion::uninitialized_relocate_backward(first, last, last + offset);
+            } else if (offset >= last - first) {
+                orion::uninitialized_move(first, last, first + offset);
+                std::destroy(first, last);
+            } else {
+                orion::uninitialized_move(last - offset, last, last);
+                std::move_backward(first, last - offset, last);
+                std::destroy(first, first + offset);
+            }
+        }
+
+        // Inverse of open_gap(), moves [gap_last, tail_last) down to the uninitialized [gap_first, gap_last)
+        template<typename T>
+        constexpr void close_gap(T* gap_first, T* gap_last, T* tail_last)
+        {
+            const auto count = gap_last - gap_first;
+            if constexpr (is_trivially_relocatable_v<T>) {
+                orion::uninitialized_relocate(gap_last, tail_last, gap_first);
+            } else if (count >= tail_last - gap_last) {
+                orion::uninitialized_move(gap_last, tail_last, gap_first);
+                std::destroy(gap_last, tail_last);
+            } else {
+                orion::uninitialized_move(gap_last, gap_last + count, gap_first);
+                std::move(gap_last + count, tail_last, gap_last);
+                std::destroy(tail_last - count, tail_last);
+            }
+        }
+    } // namespace detail
 } // namespace orion
@@ -0,0 +1,194 @@
+#include "orion-utils/arena.h"
+#include "orion-utils/small_vector.h"
+
+#include <cstdint> // std::uintptr_t
+#include <gtest/gtest.h>
+#include <limits>          // std::numeric_limits
+#include <memory_resource> // std::pmr::vector
+#include <new>             // std::bad_alloc
+#include <vector>          // std::pmr::vector
+
+namespace
+{
+    // Counts outstanding upstream allocations
+    class CountingResource : public std::pmr::memory_resource
+    {
+    public:
+        int allocations = 0;
+        int total_allocations = 0;
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            ++allocations;
+            ++total_allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+        {
+            --allocations;
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+
+    bool is_aligned(void* ptr, std::size_t alignment)
+    {
+        return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+    }
+
+    TEST(Arena, Alignment)
+    {
+        orion::Arena arena;
+        for (std::size_t alignment = 1; alignment <= 256; alignment *= 2) {
+            (void)arena.allocate(1, 1);
+            EXPECT_TRUE(is_aligned(arena.allocate(8, alignment), alignment));
+        }
+    }
+
+    TEST(Arena, Buffer)
+    {
+        CountingResource upstream;
+        alignas(16) std::byte buffer[256];
+        orion::Arena arena(buffer, &upstream);
+
+        auto* first = static_cast<std::byte*>(arena.allocate(128, 16));
+        EXPECT_EQ(first, buffer);
+        auto* second = static_cast<std::byte*>(arena.allocate(128, 16));
+        EXPECT_EQ(second, buffer + 128);
+        EXPECT_EQ(upstream.allocations, 0);
+
+        // Buffer is exhausted, falls back to upstream
+        (void)arena.allocate(1, 1);
+        EXPECT_EQ(upstream.allocations, 1);
+
+        arena.release();
+        EXPECT_EQ(upstream.allocations, 0);
+        EXPECT_EQ(arena.allocate(16, 16), buffer);
+    }
+
+    TEST(Arena, Chunks)
+    {
+        CountingResource upstream;
+        {
+            orion::Arena arena(1024, &upstream);
+            for (int i = 0; i < 4; ++i) {
+                (void)arena.allocate(512, 8);
+            }
+            EXPECT_GE(upstream.allocations, 2);
+
+            // Larger than a chunk gets a dedicated one
+            const auto before = upstream.allocations;
+            (void)arena.allocate(4096, 8);
+            EXPECT_EQ(upstream.allocations, before + 1);
+        }
+        EXPECT_EQ(upstream.allocations, 0);
+    }
+
+    TEST(Arena, Rewind)
+    {
+        CountingResource upstream;
+        orion::Arena arena(1024, &upstream);
+        (void)arena.allocate(100, 8);
+
+        const auto marker = arena.mark();
+        auto* first = arena.allocate(800, 8);
+        (void)arena.allocate(800, 8);
+        (void)arena.allocate(800, 8);
+        const auto total = upstream.total_allocations;
+
+        arena.rewind(marker);
+        EXPECT_EQ(arena.allocate(800, 8), first);
+        (void)arena.allocate(800, 8);
+        (void)arena.allocate(800, 8);
+        EXPECT_EQ(upstream.total_allocations, total);
+    }
+
+    TEST(Arena, Reset)
+    {
+        CountingResource upstream;
+        orion::Arena arena(1024, &upstream);
+        for (int frame = 0; frame < 8; ++frame) {
+            for (int i = 0; i < 16; ++i) {
+                (void)arena.allocate(256, 8);
+            }
+            arena.reset();
+        }
+        // Chunks from the first frame are reused by every later frame
+        EXPECT_EQ(upstream.total_allocations, upstream.allocations);
+    }
+
+    TEST(Arena, DeallocateLast)
+    {
+        orion::Arena arena;
+        auto* first = arena.allocate(64, 8);
+        arena.deallocate(first, 64, 8);
+        EXPECT_EQ(arena.allocate(64, 8), first);
+    }
+
+    TEST(Arena, Fixed)
+    {
+        orion::FixedArena<128> arena;
+        (void)arena.allocate(64, alignof(std::max_align_t));
+        (void)arena.allocate(64, alignof(std::max_align_t));
+        EXPECT_THROW((void)arena.allocate(1, 1), std::bad_alloc);
+
+        arena.reset();
+        EXPECT_NO_THROW((void)arena.allocate(128, 1));
+    }
+
+// The sizes are meant to be impossible, GCC flags them at the call site
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Walloc-size-larger-than="
+#endif
+    TEST(Arena, HugeRequest)
+    {
+        CountingResource upstream;
+        orion::Arena arena(1024, &upstream);
+        constexpr auto max = std::numeric_limits<std::size_t>::max();
+        // Misaligns the cursor so the padding added to the size wraps around
+        (void)arena.allocate(1, 1);
+        EXPECT_THROW((void)arena.allocate(max, 8), std::bad_alloc);
+        EXPECT_THROW((void)arena.allocate(max - 8, 1), std::bad_alloc);
+        EXPECT_THROW((void)arena.allocate(max - 64, 512), std::bad_alloc);
+        EXPECT_EQ(upstream.allocations, 1);
+
+        // The arena is still usable
+        EXPECT_TRUE(is_aligned(arena.allocate(8, 8), 8));
+    }
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic pop
+#endif
+
+    TEST(Arena, MemoryResource)
+    {
+        CountingResource upstream;
+        orion::Arena arena(1024, &upstream);
+        std::pmr::vector<int> vector(&arena);
+        for (int i = 0; i < 100; ++i) {
+            vector.push_back(i);
+        }
+        EXPECT_EQ(vector.size(), 100);
+        EXPECT_EQ(vector[99], 99);
+        EXPECT_GT(upstream.allocations, 0);
+    }
+
+    TEST(Arena, Allocator)
+    {
+        alignas(std::max_align_t) std::byte buffer[1024];
+        orion::Arena arena(buffer, std::pmr::null_memory_resource());
+
+        orion::small_vector<int, 2, orion::ArenaAllocator<int>> vector(orion::ArenaAllocator<int>{arena});
+        vector.assign({1, 2, 3, 4});
+        EXPECT_FALSE(vector.is_inline());
+        EXPECT_GE(reinterpret_cast<std::byte*>(vector.data()), buffer);
+        EXPECT_LT(reinterpret_cast<std::byte*>(vector.data()), buffer + sizeof(buffer));
+        EXPECT_EQ(vector.back(), 4);
+
+        EXPECT_EQ(orion::ArenaAllocator<int>{arena}, orion::ArenaAllocator<float>{arena});
+    }
+} // namespace
@@ -0,0 +1,114 @@
+// Check every level regardless of the build type
+#define ORION_ASSERTION_LEVEL 2
+#include "orion-utils/assertion.h"
+
+#include <gtest/gtest.h>
+#include <string> // std::string
+
+namespace
+{
+    struct AssertionFailure {
+        std::string kind;
+        std::string condition;
+        std::string function;
+        std::string message;
+        int line;
+    };
+
+    void throwing_handler(const orion::AssertionInfo& info, const char* function, std::string_view message)
+    {
+        throw AssertionFailure{info.kind, info.condition, function, std::string(message), info.line};
+    }
+
+    // Installs the throwing handler for the duration of a test
+    class Assertion : public ::testing::Test
+    {
+    protected:
+        void SetUp() override { previous_ = orion::set_assertion_handler(&throwing_handler); }
+        void TearDown() override { orion::set_assertion_handler(previous_); }
+
+        template<typename Fn>
+        static AssertionFailure failure_of(Fn&& fn)
+        {
+            try {
+                fn();
+            } catch (const AssertionFailure& failure) {
+                return failure;
+            }
+            ADD_FAILURE() << "check did not fail";
+            return {};
+        }
+
+    private:
+        orion::AssertionHandler previous_ = nullptr;
+    };
+
+    void checked_function(int value)
+    {
+        ORION_ASSERT(value > 0);
+    }
+    constexpr int checked_function_line = __LINE__ - 2;
+
+    constexpr int checked_square(int value)
+    {
+        ORION_ASSERT(value < 100, "{} is too large", value);
+        return value * value;
+    }
+
+    TEST_F(Assertion, Passing)
+    {
+        int evaluated = 0;
+        const auto count = [&evaluated]() { return ++evaluated; };
+        ORION_ASSERT(true, "{}", count());
+        ORION_ASSERT_AUDIT(true, "{}", count());
+        ORION_ASSERT_ALWAYS(true, "{}", count());
+        ORION_EXPECTS(true, "{}", count());
+        ORION_ENSURES(true, "{}", count());
+        // Message arguments are only evaluated on failure
+        EXPECT_EQ(evaluated, 0);
+    }
+
+    TEST_F(Assertion, Record)
+    {
+        const auto failure = failure_of([]() { checked_function(-1); });
+        EXPECT_EQ(failure.kind, "Assertion");
+        EXPECT_EQ(failure.condition, "value > 0");
+        EXPECT_EQ(failure.function, "checked_function");
+        EXPECT_EQ(failure.line, checked_function_line);
+        EXPECT_TRUE(failure.message.empty());
+    }
+
+    TEST_F(Assertion, Message)
+    {
+        const auto failure = failure_of([]() { checked_square(200); });
+        EXPECT_EQ(failure.condition, "value < 100");
+        EXPECT_EQ(failure.message, "200 is too large");
+    }
+
+    TEST_F(Assertion, Levels)
+    {
+        EXPECT_EQ(failure_of([]() { ORION_ASSERT_AUDIT(1 + 1 == 3); }).kind, "Audit assertion");
+        EXPECT_EQ(failure_of([]() { ORION_ASSERT_ALWAYS(false, "always {}", "checked"); }).message, "always checked");
+        EXPECT_EQ(failure_of([]() { ORION_EXPECTS(false); }).kind, "Pre-condition");
+        EXPECT_EQ(failure_of([]() { ORION_ENSURES(false); }).kind, "Post-condition");
+    }
+
+    TEST_F(Assertion, Constexpr)
+    {
+        // Passing checks are allowed in constant expressions
+        static_assert(checked_square(9) == 81);
+    }
+
+    TEST(AssertionHandler, Restore)
+    {
+        const auto previous = orion::set_assertion_handler(&throwing_handler);
+        EXPECT_EQ(orion::set_assertion_handler(nullptr), &throwing_handler);
+        // nullptr installs the default handler
+        EXPECT_EQ(orion::set_assertion_handler(previous), previous);
+    }
+
+    TEST(AssertionHandler, DefaultAborts)
+    {
+        EXPECT_DEATH(ORION_ASSERT(1 > 2, "value {}", 7), "Assertion failed .*: 1 > 2: value 7");
+    }
+} // namespace
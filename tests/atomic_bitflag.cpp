@@ -0,0 +1,130 @@
+#include "orion-utils/atomic_bitflag.h"
+
+#include <cstdint> // std::uint8_t, std::uint64_t
+#include <gtest/gtest.h>
+#include <thread> // std::thread
+#include <vector> // std::vector
+
+namespace
+{
+    enum class State : std::uint8_t {
+        dirty,
+        uploading,
+        resident,
+    };
+    using StateFlags = orion::Bitflag<State>;
+    using AtomicStateFlags = orion::AtomicBitflag<State>;
+
+    static_assert(AtomicStateFlags::is_always_lock_free);
+
+    TEST(AtomicBitflag, LoadStore)
+    {
+        AtomicStateFlags flags;
+        EXPECT_TRUE(flags.load().has_none());
+        flags.store(StateFlags::disjunction({State::dirty, State::resident}));
+        EXPECT_TRUE(flags.load(std::memory_order_acquire).has(State::resident));
+        EXPECT_EQ(flags.exchange(State::uploading), StateFlags::disjunction({State::dirty, State::resident}));
+        EXPECT_EQ(flags.load(), StateFlags{State::uploading});
+
+        const AtomicStateFlags initialized{State::dirty};
+        EXPECT_TRUE(initialized.test(State::dirty));
+    }
+
+    TEST(AtomicBitflag, FetchOperations)
+    {
+        AtomicStateFlags flags{State::dirty};
+        EXPECT_EQ(flags.fetch_set(StateFlags::disjunction({State::uploading, State::resident})), StateFlags{State::dirty});
+        EXPECT_TRUE(flags.load().has_all_of(StateFlags::disjunction({State::dirty, State::uploading, State::resident})));
+        EXPECT_EQ(flags.fetch_clear(State::uploading, std::memory_order_release).count(), 3);
+        EXPECT_FALSE(flags.test(State::uploading));
+        EXPECT_TRUE(flags.fetch_toggle(StateFlags::disjunction({State::dirty, State::uploading})).has(State::dirty));
+        EXPECT_EQ(flags.load(), StateFlags::disjunction({State::uploading, State::resident}));
+    }
+
+    TEST(AtomicBitflag, TestAndModify)
+    {
+        AtomicStateFlags flags;
+        EXPECT_FALSE(flags.test_and_set(State::resident));
+        EXPECT_TRUE(flags.test_and_set(State::resident));
+        EXPECT_TRUE(flags.test_and_clear(State::resident));
+        EXPECT_FALSE(flags.test_and_clear(State::resident));
+        EXPECT_FALSE(flags.test_and_toggle(State::dirty, std::memory_order_relaxed));
+        EXPECT_TRUE(flags.test_and_toggle(State::dirty));
+        EXPECT_TRUE(flags.load().has_none());
+    }
+
+    TEST(AtomicBitflag, CompareExchange)
+    {
+        AtomicStateFlags flags{State::dirty};
+        StateFlags expected = State::resident;
+        EXPECT_FALSE(flags.compare_exchange_strong(expected, State::uploading));
+        EXPECT_EQ(expected, StateFlags{State::dirty});
+        EXPECT_TRUE(flags.compare_exchange_strong(expected, State::uploading, std::memory_order_acq_rel, std::memory_order_acquire));
+        EXPECT_EQ(flags.load(), StateFlags{State::uploading});
+
+        // Transition uploading -> resident, keeping any other bit
+        auto current = flags.load();
+        while (!flags.compare_exchange_weak(current, (current & ~StateFlags{State::uploading}) | State::resident)) {
+        }
+        EXPECT_EQ(flags.load(), StateFlags{State::resident});
+    }
+
+    TEST(AtomicBitflag, WideEnum)
+    {
+        enum class Wide : std::uint64_t {};
+        orion::AtomicBitflag<Wide> flags;
+        EXPECT_FALSE(flags.test_and_set(Wide{63}));
+        EXPECT_TRUE(flags.test(Wide{63}));
+        EXPECT_FALSE(flags.test(Wide{31}));
+        EXPECT_EQ(flags.load().value(), std::uint64_t{1} << 63);
+    }
+
+    TEST(AtomicBitflag, ConcurrentUpdates)
+    {
+        enum class Bit : std::uint64_t {};
+        orion::AtomicBitflag<Bit> flags;
+        constexpr int thread_count = 8;
+        constexpr int iterations = 10'000;
+
+        // Every thread owns 8 bits and toggles them an even number of times, set-and-clear must never lose updates
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < thread_count; ++thread) {
+            threads.emplace_back([&flags, thread]() {
+                for (int i = 0; i < iterations; ++i) {
+                    const auto bit = static_cast<Bit>(thread * 8 + i % 8);
+                    EXPECT_FALSE(flags.test_and_set(bit));
+                    EXPECT_TRUE(flags.test_and_clear(bit, std::memory_order_relaxed));
+                    flags.fetch_toggle(bit);
+                    flags.fetch_toggle(bit);
+                }
+                flags.fetch_set(static_cast<Bit>(thread * 8));
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        EXPECT_EQ(flags.load().count(), thread_count);
+    }
+
+    TEST(AtomicBitflag, WaitNotify)
+    {
+        AtomicStateFlags flags{State::uploading};
+        std::thread uploader([&flags]() {
+            flags.fetch_clear(State::uploading, std::memory_order_release);
+            flags.notify_all();
+            flags.fetch_set(State::resident, std::memory_order_release);
+            flags.notify_all();
+        });
+        const auto resident = flags.wait_until([](StateFlags current) { return current.has(State::resident); }, std::memory_order_acquire);
+        EXPECT_FALSE(resident.has(State::uploading));
+        uploader.join();
+
+        std::thread dirtier([&flags]() {
+            flags.fetch_set(State::dirty);
+            flags.notify_one();
+        });
+        flags.wait(State::resident);
+        EXPECT_TRUE(flags.test(State::dirty));
+        dirtier.join();
+    }
+} // namespace
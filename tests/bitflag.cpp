@@ -1,6 +1,8 @@
 #include "orion-utils/bitflag.h"
 
 #include <gtest/gtest.h>
+#include <iterator> // std::forward_iterator
+#include <vector>   // std::vector
 
 namespace
 {
@@ -177,4 +179,86 @@ namespace
         EXPECT_EQ((MyEnumFlags{MyEnum::Third} >> 1), MyEnumFlags{MyEnum::Second});
         EXPECT_EQ((MyEnumFlags{MyEnum::Third} >> 2), MyEnumFlags{MyEnum::First});
     }
+
+    TEST(Bitflag, WideEnum)
+    {
+        enum class Wide : std::uint64_t {
+            Low = 1,
+            High = 40,
+        };
+        const auto flags = orion::Bitflag<Wide>::disjunction({Wide::Low, Wide::High});
+        EXPECT_EQ(flags.value(), (std::uint64_t{1} << 40) | 2u);
+        EXPECT_TRUE(flags.has(Wide::High));
+        EXPECT_EQ(flags.last(), Wide::High);
+    }
+
+    TEST(Bitflag, Count)
+    {
+        EXPECT_EQ(MyEnumFlags::none().count(), 0);
+        EXPECT_EQ(MyEnumFlags::all().count(), 8);
+        EXPECT_EQ(MyEnumFlags::disjunction({MyEnum::First, MyEnum::Third}).count(), 2);
+    }
+
+    TEST(Bitflag, FirstLast)
+    {
+        const auto flags = MyEnumFlags::disjunction({MyEnum::Second, MyEnum::Third});
+        EXPECT_EQ(flags.first(), MyEnum::Second);
+        EXPECT_EQ(flags.last(), MyEnum::Third);
+
+        const auto single = MyEnumFlags{MyEnum::First};
+        EXPECT_EQ(single.first(), MyEnum::First);
+        EXPECT_EQ(single.last(), MyEnum::First);
+    }
+
+    TEST(Bitflag, SetBits)
+    {
+        static_assert(std::forward_iterator<MyEnumFlags::SetBitIterator>);
+
+        std::vector<MyEnum> visited;
+        for (auto bit : MyEnumFlags::disjunction({MyEnum::Third, MyEnum::First}).set_bits()) {
+            visited.push_back(bit);
+        }
+        EXPECT_EQ(visited, (std::vector{MyEnum::First, MyEnum::Third}));
+
+        for ([[maybe_unused]] auto bit : MyEnumFlags::none().set_bits()) {
+            FAIL();
+        }
+    }
+
+    TEST(Bitflag, ForEachSet)
+    {
+        std::vector<MyEnum> visited;
+        MyEnumFlags::disjunction({MyEnum::Second, MyEnum::Third}).for_each_set([&visited](MyEnum bit) { visited.push_back(bit); });
+        EXPECT_EQ(visited, (std::vector{MyEnum::Second, MyEnum::Third}));
+    }
+
+    TEST(Bitflag, MaskTests)
+    {
+        const auto flags = MyEnumFlags::disjunction({MyEnum::First, MyEnum::Second});
+        EXPECT_TRUE(flags.has_all_of(MyEnumFlags{MyEnum::First}));
+        EXPECT_TRUE(flags.has_all_of(flags));
+        EXPECT_FALSE(flags.has_all_of(MyEnumFlags::disjunction({MyEnum::First, MyEnum::Third})));
+        EXPECT_TRUE(flags.has_all_of(MyEnumFlags::none()));
+
+        EXPECT_TRUE(flags.has_any_of(MyEnumFlags::disjunction({MyEnum::Second, MyEnum::Third})));
+        EXPECT_FALSE(flags.has_any_of(MyEnumFlags{MyEnum::Third}));
+        EXPECT_FALSE(flags.has_any_of(MyEnumFlags::none()));
+    }
+
+    TEST(Bitflag, BitQueriesConstexpr)
+    {
+        constexpr auto flags = MyEnumFlags::disjunction({MyEnum::First, MyEnum::Third});
+        static_assert(flags.count() == 2);
+        static_assert(flags.first() == MyEnum::First);
+        static_assert(flags.last() == MyEnum::Third);
+        static_assert(flags.has_all_of(MyEnumFlags{MyEnum::Third}));
+        static_assert([flags]() {
+            int sum = 0;
+            for (auto bit : flags.set_bits()) {
+                sum += orion::to_underlying(bit);
+            }
+            flags.for_each_set([&sum](MyEnum bit) { sum += orion::to_underlying(bit); });
+            return sum;
+        }() == 4);
+    }
 } // namespace
@@ -0,0 +1,152 @@
+#include "orion-utils/enum_set.h"
+
+#include <gtest/gtest.h>
+#include <iterator> // std::forward_iterator
+#include <vector>   // std::vector
+
+namespace
+{
+    // More values than fit in any integer type
+    enum class Material : std::uint16_t {
+        Stone = 0,
+        Wood = 1,
+        Glass = 63,
+        Metal = 64,
+        Water = 130,
+        Lava = 199,
+    };
+    using Materials = orion::EnumSet<Material, 200>;
+
+    TEST(EnumSet, Layout)
+    {
+        static_assert(Materials::word_count == 4);
+        static_assert(sizeof(Materials) == 4 * sizeof(std::uint64_t));
+        static_assert(orion::EnumSet<Material, 64>::word_count == 1);
+    }
+
+    TEST(EnumSet, DefaultCtor)
+    {
+        const Materials set;
+        EXPECT_TRUE(set.has_none());
+        EXPECT_FALSE(set.has_any());
+        EXPECT_EQ(set.count(), 0);
+    }
+
+    TEST(EnumSet, ValueCtor)
+    {
+        const Materials set{Material::Water};
+        EXPECT_TRUE(set.has(Material::Water));
+        EXPECT_FALSE(set.has(Material::Stone));
+        EXPECT_EQ(set.words()[2], std::uint64_t{1} << 2);
+    }
+
+    TEST(EnumSet, Factories)
+    {
+        EXPECT_TRUE(Materials::all().has_all());
+        EXPECT_EQ(Materials::all().count(), 200);
+        EXPECT_TRUE(Materials::none().has_none());
+
+        const auto set = Materials::disjunction({Material::Stone, Material::Metal, Material::Lava});
+        EXPECT_EQ(set.count(), 3);
+        EXPECT_TRUE(set.has(Material::Metal));
+        EXPECT_TRUE(Materials::conjunction({Material::Stone, Material::Wood}).has_none());
+        EXPECT_EQ(Materials::conjunction({Material::Lava}), Material::Lava);
+    }
+
+    TEST(EnumSet, BitwiseOperators)
+    {
+        const auto a = Materials::disjunction({Material::Stone, Material::Metal});
+        const auto b = Materials::disjunction({Material::Metal, Material::Water});
+
+        EXPECT_EQ(a | b, Materials::disjunction({Material::Stone, Material::Metal, Material::Water}));
+        EXPECT_EQ(a & b, Material::Metal);
+        EXPECT_EQ(a ^ b, Materials::disjunction({Material::Stone, Material::Water}));
+        EXPECT_EQ(a.and_not(b), Material::Stone);
+
+        // Complement stays within the N values
+        EXPECT_EQ((~a).count(), 198);
+        EXPECT_EQ(~Materials::none(), Materials::all());
+
+        auto c = a;
+        c |= Material::Lava;
+        c &= ~Materials{Material::Stone};
+        c ^= Material::Water;
+        EXPECT_EQ(c, Materials::disjunction({Material::Metal, Material::Lava, Material::Water}));
+    }
+
+    TEST(EnumSet, Shifts)
+    {
+        const Materials glass{Material::Glass};
+        EXPECT_EQ(glass << 1, Material::Metal);
+        EXPECT_EQ((glass << 67), Material::Water);
+        EXPECT_EQ((Materials{Material::Water} >> 67), Material::Glass);
+        EXPECT_EQ((Materials{Material::Metal} >> 1), Material::Glass);
+
+        // Bits shifted past N are dropped
+        EXPECT_TRUE((Materials{Material::Lava} << 1).has_none());
+        EXPECT_TRUE((Materials{Material::Stone} >> 1).has_none());
+
+        auto shifted = Materials{Material::Stone};
+        shifted <<= 130;
+        shifted >>= 129;
+        EXPECT_EQ(shifted, Material::Wood);
+    }
+
+    TEST(EnumSet, MaskTests)
+    {
+        const auto set = Materials::disjunction({Material::Stone, Material::Metal, Material::Lava});
+        EXPECT_TRUE(set.has_all_of(Materials::disjunction({Material::Metal, Material::Lava})));
+        EXPECT_FALSE(set.has_all_of(Materials::disjunction({Material::Metal, Material::Water})));
+        EXPECT_TRUE(set.has_any_of(Materials::disjunction({Material::Metal, Material::Water})));
+        EXPECT_FALSE(set.has_any_of(Material::Water));
+
+        EXPECT_TRUE(Materials{Material::Lava}.is_subset_of(set));
+        EXPECT_FALSE(set.is_subset_of(Material::Lava));
+        EXPECT_TRUE(Materials::none().is_subset_of(set));
+    }
+
+    TEST(EnumSet, FirstLast)
+    {
+        const auto set = Materials::disjunction({Material::Metal, Material::Water});
+        EXPECT_EQ(set.first(), Material::Metal);
+        EXPECT_EQ(set.last(), Material::Water);
+        EXPECT_EQ(Materials{Material::Lava}.first(), Material::Lava);
+    }
+
+    TEST(EnumSet, SetBits)
+    {
+        static_assert(std::forward_iterator<Materials::SetBitIterator>);
+        const std::vector expected{Material::Stone, Material::Glass, Material::Metal, Material::Lava};
+
+        std::vector<Material> visited;
+        for (auto value : (Materials{Material::Lava} | Materials::disjunction({Material::Stone, Material::Glass, Material::Metal})).set_bits()) {
+            visited.push_back(value);
+        }
+        EXPECT_EQ(visited, expected);
+
+        visited.clear();
+        Materials::disjunction({Material::Lava, Material::Metal, Material::Glass, Material::Stone}).for_each_set([&visited](Material value) { visited.push_back(value); });
+        EXPECT_EQ(visited, expected);
+
+        for ([[maybe_unused]] auto value : Materials::none().set_bits()) {
+            FAIL();
+        }
+    }
+
+    TEST(EnumSet, Constexpr)
+    {
+        constexpr auto set = Materials::disjunction({Material::Wood, Material::Water}) | Material::Lava;
+        static_assert(set.count() == 3);
+        static_assert(set.first() == Material::Wood);
+        static_assert(set.last() == Material::Lava);
+        static_assert(set.has_all_of(Material::Water));
+        static_assert((set << 1).has(Material::Wood) == false);
+        static_assert([set]() {
+            int sum = 0;
+            for (auto value : set.set_bits()) {
+                sum += orion::to_underlying(value);
+            }
+            return sum;
+        }() == 1 + 130 + 199);
+    }
+} // namespace
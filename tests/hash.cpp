@@ -0,0 +1,152 @@
+#include "orion-utils/hash.h"
+
+#include <algorithm> // std::swap_ranges
+#include <array>     // std::array
+#include <bit>       // std::popcount
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t
+#include <gtest/gtest.h>
+#include <functional>    // std::equal_to
+#include <span>          // std::span, std::as_bytes
+#include <string>        // std::string, std::to_string
+#include <string_view>   // std::string_view
+#include <unordered_map> // std::unordered_map
+#include <unordered_set> // std::unordered_set
+
+namespace
+{
+    using namespace std::string_view_literals;
+
+    // Sizes around every branch of the short, medium and striped paths
+    constexpr std::array<std::size_t, 30> sizes = {0, 1, 2, 3, 4, 7, 8, 15, 16, 17, 32, 47, 48, 49, 96, 97,
+                                                   511, 512, 513, 575, 576, 1023, 1024, 1025, 1088, 2047, 2048, 2049, 3000, 4159};
+    constexpr std::size_t max_size = 4159;
+
+    constexpr char byte_at(std::size_t index) noexcept
+    {
+        return static_cast<char>((index * 131 + 7) ^ (index >> 8));
+    }
+
+    constexpr std::array<char, max_size> make_bytes() noexcept
+    {
+        std::array<char, max_size> bytes{};
+        for (std::size_t i = 0; i < bytes.size(); ++i) {
+            bytes[i] = byte_at(i);
+        }
+        return bytes;
+    }
+
+    constexpr std::array<char, max_size> bytes = make_bytes();
+
+    constexpr std::array<std::uint64_t, sizes.size()> compile_time_hashes = []() {
+        std::array<std::uint64_t, sizes.size()> hashes{};
+        for (std::size_t i = 0; i < sizes.size(); ++i) {
+            hashes[i] = orion::hash_bytes(std::string_view{bytes.data(), sizes[i]}, i);
+        }
+        return hashes;
+    }();
+
+    // The values are part of the interface, they may be stored in asset files. Short inputs hash like wyhash,
+    // whose test vector for the empty input is the first value
+    static_assert(orion::hash_bytes("") == 0x93228a4de0eec5a2);
+    static_assert(orion::hash_bytes("orion") == 0x763775911ee56435);
+    static_assert([]() {
+        std::array<char, 2048> input{};
+        input.fill('x');
+        return orion::hash_bytes(std::string_view{input.data(), input.size()});
+    }() == 0x984520033158ed9b);
+
+    TEST(Hash, CompileTimeMatchesRunTime)
+    {
+        // A copy the compiler can't see through takes the runtime path
+        const std::string runtime_bytes{bytes.data(), bytes.size()};
+        for (std::size_t i = 0; i < sizes.size(); ++i) {
+            EXPECT_EQ(orion::hash_bytes(std::string_view{runtime_bytes.data(), sizes[i]}, i), compile_time_hashes[i]) << "size " << sizes[i];
+            EXPECT_EQ(orion::hash_bytes(std::as_bytes(std::span{runtime_bytes.data(), sizes[i]}), i), compile_time_hashes[i]) << "size " << sizes[i];
+        }
+    }
+
+    TEST(Hash, EveryByteMatters)
+    {
+        std::string input{bytes.data(), bytes.size()};
+        for (const auto size : sizes) {
+            if (size == 0) {
+                continue;
+            }
+            const auto original = orion::hash_bytes(std::string_view{input.data(), size});
+            for (const auto position : {std::size_t{0}, size / 2, size - 1}) {
+                input[position] = static_cast<char>(input[position] ^ 1);
+                EXPECT_NE(orion::hash_bytes(std::string_view{input.data(), size}), original) << "size " << size << ", byte " << position;
+                input[position] = static_cast<char>(input[position] ^ 1);
+            }
+        }
+    }
+
+    TEST(Hash, Avalanche)
+    {
+        // Flipping one input bit flips about half of the output bits
+        std::string input{bytes.data(), bytes.size()};
+        for (const auto size : {std::size_t{8}, std::size_t{100}, std::size_t{2048}}) {
+            const auto original = orion::hash_bytes(std::string_view{input.data(), size});
+            int flipped = 0;
+            int flips = 0;
+            for (std::size_t bit = 0; bit < size * 8; bit += 3) {
+                input[bit / 8] = static_cast<char>(input[bit / 8] ^ (1 << (bit % 8)));
+                flipped += std::popcount(orion::hash_bytes(std::string_view{input.data(), size}) ^ original);
+                ++flips;
+                input[bit / 8] = static_cast<char>(input[bit / 8] ^ (1 << (bit % 8)));
+            }
+            const auto average = static_cast<double>(flipped) / flips;
+            EXPECT_GT(average, 30.0) << "size " << size;
+            EXPECT_LT(average, 34.0) << "size " << size;
+        }
+    }
+
+    TEST(Hash, StripeOrderMatters)
+    {
+        // Swapping two stripes of a block changes the hash even though their lanes are summed
+        std::string input{bytes.data(), 2048};
+        const auto original = orion::hash_bytes(input);
+        std::swap_ranges(input.begin(), input.begin() + 64, input.begin() + 64);
+        EXPECT_NE(orion::hash_bytes(input), original);
+    }
+
+    TEST(Hash, Seed)
+    {
+        EXPECT_NE(orion::hash_bytes("mesh", 1), orion::hash_bytes("mesh", 2));
+        EXPECT_NE(orion::hash_bytes(std::string_view{bytes.data(), 2048}, 1), orion::hash_bytes(std::string_view{bytes.data(), 2048}, 2));
+        EXPECT_EQ(orion::hash_bytes("mesh", 7), orion::hash_bytes("mesh", 7));
+    }
+
+    TEST(Hash, Collisions)
+    {
+        std::unordered_set<std::uint64_t> hashes;
+        for (int i = 0; i < 100000; ++i) {
+            hashes.insert(orion::hash_bytes(std::to_string(i)));
+        }
+        EXPECT_EQ(hashes.size(), 100000);
+    }
+
+    TEST(Hash, PortableMultiply)
+    {
+        for (const auto [a, b] : std::array<std::array<std::uint64_t, 2>, 4>{{{0, 0}, {~0ULL, ~0ULL}, {0x123456789abcdef0, 0xfedcba9876543210}, {1ULL << 63, 3}}}) {
+            auto a0 = a;
+            auto b0 = b;
+            orion::detail::multiply(a0, b0);
+            auto a1 = a;
+            auto b1 = b;
+            orion::detail::multiply_portable(a1, b1);
+            EXPECT_EQ(a0, a1);
+            EXPECT_EQ(b0, b1);
+        }
+    }
+
+    TEST(Hash, StringHash)
+    {
+        std::unordered_map<std::string, int, orion::string_hash, std::equal_to<>> map{{"transform", 1}, {"mesh", 2}};
+        EXPECT_EQ(map.find("mesh"sv)->second, 2);
+        EXPECT_EQ(map.find("transform")->second, 1);
+        EXPECT_EQ(map.find("light"), map.end());
+        EXPECT_EQ(orion::string_hash{}("mesh"), static_cast<std::size_t>(orion::hash_bytes("mesh")));
+    }
+} // namespace
@@ -0,0 +1,201 @@
+#include "orion-utils/hierarchical_bitset.h"
+
+#include <algorithm> // std::min
+#include <bitset>    // std::bitset
+#include <cstddef>   // std::size_t
+#include <gtest/gtest.h>
+#include <iterator> // std::forward_iterator
+#include <optional> // std::nullopt
+#include <random>   // std::mt19937
+#include <utility>  // std::swap
+#include <vector>   // std::vector
+
+namespace
+{
+    static_assert(orion::hierarchical_bitset<64>::level_count == 1);
+    static_assert(orion::hierarchical_bitset<65>::level_count == 2);
+    static_assert(orion::hierarchical_bitset<4096>::level_count == 2);
+    static_assert(orion::hierarchical_bitset<4097>::level_count == 3);
+    static_assert(orion::hierarchical_bitset<262144>::level_count == 3);
+    static_assert(std::forward_iterator<orion::hierarchical_bitset<100>::SetBitIterator>);
+
+    constexpr auto npos = orion::hierarchical_bitset<1>::npos;
+
+    // Lowest bit at or after from with the wanted value, the linear scan the bitset replaces
+    template<std::size_t N>
+    std::size_t scan(const std::bitset<N>& bits, std::size_t from, bool value)
+    {
+        for (auto index = from; index < N; ++index) {
+            if (bits[index] == value) {
+                return index;
+            }
+        }
+        return npos;
+    }
+
+    TEST(HierarchicalBitset, SetClear)
+    {
+        orion::hierarchical_bitset<200> bits;
+        EXPECT_TRUE(bits.has_none());
+        EXPECT_EQ(bits.find_first_set(), npos);
+        EXPECT_EQ(bits.find_first_clear(), 0);
+
+        bits.set(3);
+        bits.set(130);
+        EXPECT_TRUE(bits.test(3));
+        EXPECT_FALSE(bits.test(4));
+        EXPECT_EQ(bits.count(), 2);
+        EXPECT_EQ(bits.find_first_set(), 3);
+        EXPECT_EQ(bits.find_first_set(4), 130);
+        EXPECT_EQ(bits.find_first_set(131), npos);
+
+        bits.clear(3);
+        EXPECT_EQ(bits.find_first_set(), 130);
+        bits.clear();
+        EXPECT_TRUE(bits.has_none());
+    }
+
+    TEST(HierarchicalBitset, Ranges)
+    {
+        orion::hierarchical_bitset<300> bits;
+        bits.set(10, 290);
+        EXPECT_EQ(bits.count(), 280);
+        EXPECT_EQ(bits.find_first_set(), 10);
+        EXPECT_EQ(bits.find_first_clear(10), 290);
+        bits.clear(64, 128);
+        EXPECT_EQ(bits.find_first_clear(10), 64);
+        EXPECT_EQ(bits.find_first_set(64), 128);
+
+        bits.set(0, 300);
+        EXPECT_TRUE(bits.has_all());
+        EXPECT_EQ(bits.find_first_clear(), npos);
+        bits.clear(299);
+        EXPECT_FALSE(bits.has_all());
+        EXPECT_EQ(bits.find_first_clear(), 299);
+        bits.set(5, 5);
+        EXPECT_EQ(bits.count(), 299);
+    }
+
+    TEST(HierarchicalBitset, SetBits)
+    {
+        orion::hierarchical_bitset<5000> bits;
+        const std::vector<std::size_t> expected{0, 63, 64, 4095, 4096, 4999};
+        for (auto index : expected) {
+            bits.set(index);
+        }
+        std::vector<std::size_t> visited;
+        for (auto index : bits.set_bits()) {
+            visited.push_back(index);
+        }
+        EXPECT_EQ(visited, expected);
+
+        visited.clear();
+        bits.for_each_set([&visited](std::size_t index) { visited.push_back(index); });
+        EXPECT_EQ(visited, expected);
+    }
+
+    // Random operations checked against std::bitset, over every level count
+    template<std::size_t N>
+    void check_against_bitset()
+    {
+        orion::hierarchical_bitset<N> bits;
+        std::bitset<N> reference;
+        std::mt19937 engine{N}; // NOLINT(cert-msc32-c, cert-msc51-cpp): deterministic on purpose
+        std::uniform_int_distribution<std::size_t> indices{0, N - 1};
+        for (int step = 0; step < 3000; ++step) {
+            auto first = indices(engine);
+            auto last = indices(engine);
+            if (first > last) {
+                std::swap(first, last);
+            }
+            switch (engine() % 5) {
+            case 0:
+                bits.set(first);
+                reference.set(first);
+                break;
+            case 1:
+                bits.clear(first);
+                reference.reset(first);
+                break;
+            case 2:
+                // Short ranges, long ones would fill the set
+                last = std::min(last, first + 100);
+                bits.set(first, last);
+                for (auto index = first; index < last; ++index) {
+                    reference.set(index);
+                }
+                break;
+            default:
+                bits.clear(first, last);
+                for (auto index = first; index < last; ++index) {
+                    reference.reset(index);
+                }
+                break;
+            }
+            const auto from = indices(engine);
+            ASSERT_EQ(bits.find_first_set(from), scan(reference, from, true)) << step;
+            ASSERT_EQ(bits.find_first_clear(from), scan(reference, from, false)) << step;
+        }
+        EXPECT_EQ(bits.count(), reference.count());
+        EXPECT_EQ(bits.has_all(), reference.all());
+        EXPECT_EQ(bits.has_any(), reference.any());
+    }
+
+    TEST(HierarchicalBitset, MatchesBitset)
+    {
+        check_against_bitset<50>();
+        check_against_bitset<1000>();
+        check_against_bitset<4096>();
+        check_against_bitset<70000>();
+    }
+
+    TEST(IndexAllocator, LowestFree)
+    {
+        orion::index_allocator<130> allocator;
+        EXPECT_TRUE(allocator.empty());
+        EXPECT_EQ(allocator.capacity(), 130);
+        for (std::size_t i = 0; i < 130; ++i) {
+            EXPECT_EQ(allocator.allocate(), i);
+        }
+        EXPECT_TRUE(allocator.full());
+        EXPECT_EQ(allocator.allocate(), std::nullopt);
+
+        allocator.free(100);
+        allocator.free(7);
+        allocator.free(64);
+        EXPECT_FALSE(allocator.is_allocated(64));
+        EXPECT_EQ(allocator.size(), 127);
+        EXPECT_EQ(allocator.allocate(), 7);
+        EXPECT_EQ(allocator.allocate(), 64);
+        EXPECT_EQ(allocator.allocate(), 100);
+        EXPECT_EQ(allocator.allocated().count(), 130);
+
+        allocator.clear();
+        EXPECT_EQ(allocator.allocate(), 0);
+    }
+
+    TEST(HierarchicalBitset, Constexpr)
+    {
+        constexpr auto bits = []() {
+            orion::hierarchical_bitset<10000> result;
+            result.set(0, 9000);
+            result.clear(4321);
+            result.set(9999);
+            return result;
+        }();
+        static_assert(bits.count() == 9000);
+        static_assert(bits.find_first_clear() == 4321);
+        static_assert(bits.find_first_clear(4322) == 9000);
+        static_assert(bits.find_first_set(9000) == 9999);
+
+        constexpr auto allocated = []() {
+            orion::index_allocator<100> allocator;
+            for (int i = 0; i < 10; ++i) {
+                static_cast<void>(allocator.allocate());
+            }
+            allocator.free(4);
+            return *allocator.allocate();
+        }();
+        static_assert(allocated == 4);
+    }
+} // namespace
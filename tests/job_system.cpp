@@ -0,0 +1,151 @@
+#include "orion-utils/job_system.h"
+#include "orion-utils/static_vector.h"
+
+#include <atomic> // std::atomic
+#include <gtest/gtest.h>
+#include <numeric> // std::iota
+#include <span>    // std::span
+#include <thread>  // std::this_thread::yield
+#include <vector>  // std::vector
+
+namespace
+{
+    TEST(JobSystem, Run)
+    {
+        orion::JobSystem jobs(3);
+        EXPECT_EQ(jobs.worker_count(), 3);
+
+        std::atomic<int> sum = 0;
+        orion::JobCounter counter;
+        for (int i = 1; i <= 5000; ++i) {
+            jobs.run([&sum, i]() { sum += i; }, counter);
+        }
+        jobs.wait(counter);
+        EXPECT_TRUE(counter.done());
+        EXPECT_EQ(sum, 5000 * 5001 / 2);
+
+        // Counters can be reused once done
+        jobs.run([&sum]() { sum = 0; }, counter);
+        jobs.wait(counter);
+        EXPECT_EQ(sum, 0);
+    }
+
+    TEST(JobSystem, NoWorkers)
+    {
+        orion::JobSystem jobs(0);
+        int value = 0;
+        orion::JobCounter counter;
+        jobs.run([&value]() { value = 42; }, counter);
+        jobs.wait(counter);
+        EXPECT_EQ(value, 42);
+    }
+
+    // Recursive fork-join, every job starts children and waits for them
+    int fibonacci(orion::JobSystem& jobs, int n)
+    {
+        if (n < 12) {
+            return n < 2 ? n : fibonacci(jobs, n - 1) + fibonacci(jobs, n - 2);
+        }
+        int a = 0;
+        int b = 0;
+        orion::JobCounter counter;
+        jobs.run([&jobs, &a, n]() { a = fibonacci(jobs, n - 1); }, counter);
+        jobs.run([&jobs, &b, n]() { b = fibonacci(jobs, n - 2); }, counter);
+        jobs.wait(counter);
+        return a + b;
+    }
+
+    TEST(JobSystem, Nested)
+    {
+        orion::JobSystem jobs(4);
+        EXPECT_EQ(fibonacci(jobs, 24), 46368);
+    }
+
+    TEST(JobSystem, Dependencies)
+    {
+        orion::JobSystem jobs(2);
+        std::vector<int> stages(3, 0);
+        orion::JobCounter first;
+        orion::JobCounter second;
+        orion::JobCounter third;
+
+        // The first stage is held back until the later ones are registered as its continuations
+        std::atomic<bool> release = false;
+        const auto first_stage = [&stages, &release]() {
+            while (!release) {
+                std::this_thread::yield();
+            }
+            stages[0] = 1;
+        };
+        jobs.run(first_stage, first);
+        // Every stage checks that the previous one has finished
+        jobs.run_after(first, [&stages]() { stages[1] = stages[0] + 1; }, second);
+        jobs.run_after(second, [&stages]() { stages[2] = stages[1] + 1; }, third);
+        EXPECT_FALSE(third.done());
+        release = true;
+
+        jobs.wait(third);
+        EXPECT_EQ(stages[0], 1);
+        EXPECT_EQ(stages[1], 2);
+        EXPECT_EQ(stages[2], 3);
+        EXPECT_TRUE(first.done());
+        EXPECT_TRUE(second.done());
+    }
+
+    TEST(JobSystem, DependencyAlreadyDone)
+    {
+        orion::JobSystem jobs(1);
+        orion::JobCounter dependency;
+        orion::JobCounter counter;
+        bool ran = false;
+        jobs.run_after(dependency, [&ran]() { ran = true; }, counter);
+        jobs.wait(counter);
+        EXPECT_TRUE(ran);
+    }
+
+    TEST(JobSystem, ParallelForIndices)
+    {
+        orion::JobSystem jobs(3);
+        std::vector<int> values(10000, 0);
+        jobs.parallel_for(0, values.size(), 64, [&values](std::size_t index) { values[index] = static_cast<int>(index); });
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            EXPECT_EQ(values[i], static_cast<int>(i));
+        }
+
+        // Empty range
+        jobs.parallel_for(5, 5, 1, [](std::size_t) { FAIL(); });
+    }
+
+    TEST(JobSystem, ParallelForRanges)
+    {
+        orion::JobSystem jobs(2);
+
+        orion::static_vector<int, 256> vector(256);
+        std::iota(vector.begin(), vector.end(), 0);
+        jobs.parallel_for(vector, 16, [](int& value) { value *= 2; });
+        int expected = 0;
+        for (int value : vector) {
+            EXPECT_EQ(value, expected);
+            expected += 2;
+        }
+
+        std::vector<int> storage(1000, 1);
+        std::atomic<int> sum = 0;
+        jobs.parallel_for(std::span<const int>(storage), 100, [&sum](int value) { sum += value; });
+        EXPECT_EQ(sum, 1000);
+    }
+
+    TEST(JobSystem, DestructorRunsPendingJobs)
+    {
+        std::atomic<int> ran = 0;
+        orion::JobCounter counter;
+        {
+            orion::JobSystem jobs(2);
+            for (int i = 0; i < 100; ++i) {
+                jobs.run([&ran]() { ++ran; }, counter);
+            }
+        }
+        EXPECT_EQ(ran, 100);
+        EXPECT_TRUE(counter.done());
+    }
+} // namespace
@@ -0,0 +1,122 @@
+#include "orion-utils/mpmc_queue.h"
+
+#include <atomic> // std::atomic
+#include <gtest/gtest.h>
+#include <memory> // std::unique_ptr, std::make_unique
+#include <string> // std::string
+#include <thread> // std::thread, std::this_thread::yield
+#include <vector> // std::vector
+
+namespace
+{
+    const std::string long_string = "a string that is too long for the small string optimization";
+
+    struct NotDefaultConstructible {
+        explicit NotDefaultConstructible(int v)
+            : value(v)
+        {
+        }
+
+        int value;
+    };
+
+    TEST(MpmcQueue, PushPop)
+    {
+        orion::mpmc_queue<int, 4> queue;
+        EXPECT_TRUE(queue.empty());
+        EXPECT_EQ(queue.capacity(), 4);
+
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_TRUE(queue.try_push(i));
+        }
+        EXPECT_FALSE(queue.try_push(4));
+        EXPECT_EQ(queue.size(), 4);
+
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_EQ(queue.try_pop(), i);
+        }
+        EXPECT_EQ(queue.try_pop(), std::nullopt);
+        EXPECT_TRUE(queue.empty());
+    }
+
+    TEST(MpmcQueue, WrapAround)
+    {
+        orion::mpmc_queue<int, 2> queue;
+        for (int i = 0; i < 10; ++i) {
+            queue.push(i);
+            EXPECT_EQ(queue.pop(), i);
+        }
+    }
+
+    TEST(MpmcQueue, NotDefaultConstructible)
+    {
+        orion::mpmc_queue<NotDefaultConstructible, 2> queue;
+        EXPECT_TRUE(queue.try_emplace(5));
+        EXPECT_EQ(queue.pop().value, 5);
+    }
+
+    TEST(MpmcQueue, NonTrivial)
+    {
+        orion::mpmc_queue<std::string, 4> queue;
+        EXPECT_TRUE(queue.try_emplace(std::size_t{3}, 'x'));
+        queue.push(long_string);
+        EXPECT_EQ(queue.try_pop(), "xxx");
+        EXPECT_EQ(queue.pop(), long_string);
+
+        // Elements left in the queue are destroyed with it
+        queue.push(long_string);
+    }
+
+    TEST(MpmcQueue, MoveOnly)
+    {
+        orion::mpmc_queue<std::unique_ptr<int>, 2> queue;
+        queue.push(std::make_unique<int>(3));
+        EXPECT_EQ(*queue.pop(), 3);
+    }
+
+    TEST(MpmcQueue, Threads)
+    {
+        constexpr int producers = 3;
+        constexpr int consumers = 3;
+        constexpr int per_producer = 5000;
+        orion::mpmc_queue<int, 16> queue;
+        std::atomic<long long> sum = 0;
+
+        std::vector<std::thread> threads;
+        for (int producer = 0; producer < producers; ++producer) {
+            threads.emplace_back([&queue]() {
+                for (int i = 1; i <= per_producer; ++i) {
+                    // Mix blocking and non-blocking pushes
+                    if (i % 2 == 0) {
+                        queue.push(i);
+                    } else {
+                        while (!queue.try_push(i)) {
+                            std::this_thread::yield();
+                        }
+                    }
+                }
+            });
+        }
+        for (int consumer = 0; consumer < consumers; ++consumer) {
+            threads.emplace_back([&queue, &sum, consumer]() {
+                for (int i = 0; i < per_producer; ++i) {
+                    if (consumer == 0) {
+                        sum += queue.pop();
+                    } else {
+                        std::optional<int> value;
+                        while (!(value = queue.try_pop())) {
+                            std::this_thread::yield();
+                        }
+                        sum += *value;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(sum, static_cast<long long>(producers) * per_producer * (per_producer + 1) / 2);
+        EXPECT_TRUE(queue.empty());
+    }
+} // namespace
@@ -0,0 +1,157 @@
+#include "orion-utils/object_pool.h"
+
+#include <cstdint> // std::uintptr_t
+#include <gtest/gtest.h>
+#include <mutex>     // std::mutex
+#include <stdexcept> // std::runtime_error
+#include <string>    // std::string
+#include <thread>    // std::thread
+#include <vector>    // std::vector
+
+namespace
+{
+    struct Tracked {
+        static inline int alive = 0;
+
+        explicit Tracked(int v)
+            : value(v)
+        {
+            if (v < 0) {
+                throw std::runtime_error("negative");
+            }
+            ++alive;
+        }
+        ~Tracked() { --alive; }
+
+        Tracked(const Tracked&) = delete;
+        Tracked& operator=(const Tracked&) = delete;
+
+        int value;
+    };
+
+    struct alignas(64) OverAligned {
+        char value;
+    };
+
+    TEST(ObjectPool, CreateDestroy)
+    {
+        orion::ObjectPool<Tracked> pool;
+        auto* first = pool.create(1);
+        auto* second = pool.create(2);
+        EXPECT_EQ(first->value, 1);
+        EXPECT_EQ(second->value, 2);
+        EXPECT_EQ(Tracked::alive, 2);
+
+        pool.destroy(first);
+        EXPECT_EQ(Tracked::alive, 1);
+
+        // Most recently freed slot is reused first
+        auto* third = pool.create(3);
+        EXPECT_EQ(third, first);
+        pool.destroy(third);
+        pool.destroy(second);
+        EXPECT_EQ(Tracked::alive, 0);
+    }
+
+    TEST(ObjectPool, Counters)
+    {
+        orion::ObjectPool<int, 4> pool;
+        EXPECT_EQ(pool.capacity(), 0);
+
+        std::vector<int*> objects;
+        for (int i = 0; i < 6; ++i) {
+            objects.push_back(pool.create(i));
+        }
+        EXPECT_EQ(pool.size(), 6);
+        EXPECT_EQ(pool.chunk_count(), 2);
+        EXPECT_EQ(pool.capacity(), 8);
+
+        for (auto* object : objects) {
+            pool.destroy(object);
+        }
+        EXPECT_EQ(pool.size(), 0);
+        EXPECT_EQ(pool.high_water_mark(), 6);
+
+        // Freed slots are reused before new chunks are allocated
+        for (int i = 0; i < 8; ++i) {
+            (void)pool.allocate();
+        }
+        EXPECT_EQ(pool.chunk_count(), 2);
+    }
+
+    TEST(ObjectPool, ThrowingConstructor)
+    {
+        orion::ObjectPool<Tracked> pool;
+        EXPECT_THROW((void)pool.create(-1), std::runtime_error);
+        EXPECT_EQ(pool.size(), 0);
+        EXPECT_EQ(Tracked::alive, 0);
+    }
+
+    TEST(ObjectPool, Alignment)
+    {
+        orion::ObjectPool<OverAligned, 3> pool;
+        for (int i = 0; i < 8; ++i) {
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pool.allocate()) % alignof(OverAligned), 0);
+        }
+    }
+
+    TEST(ObjectPool, Magazine)
+    {
+        using Pool = orion::ObjectPool<std::string>;
+        Pool pool;
+        {
+            Pool::Magazine magazine(pool, 4);
+            auto* str = magazine.create("pooled");
+            EXPECT_EQ(*str, "pooled");
+            // The first allocation pulls a whole batch from the pool
+            EXPECT_EQ(pool.size(), 4);
+            EXPECT_EQ(magazine.cached(), 3);
+
+            magazine.destroy(str);
+            EXPECT_EQ(magazine.cached(), 4);
+
+            std::vector<std::string*> strings;
+            for (int i = 0; i < 12; ++i) {
+                strings.push_back(magazine.create(std::to_string(i)));
+            }
+            for (auto* string : strings) {
+                magazine.destroy(string);
+            }
+            // Full batches went back to the pool, one batch stays cached
+            EXPECT_LT(magazine.cached(), 8);
+            EXPECT_EQ(pool.size(), magazine.cached());
+        }
+        EXPECT_EQ(pool.size(), 0);
+    }
+
+    TEST(ObjectPool, Threads)
+    {
+        using Pool = orion::ObjectPool<Tracked, 16, std::mutex>;
+        Pool pool;
+        std::vector<Tracked*> shared(4 * 1000);
+        {
+            std::vector<std::thread> threads;
+            for (std::size_t thread = 0; thread < 4; ++thread) {
+                threads.emplace_back([&pool, &shared, thread]() {
+                    Pool::Magazine magazine(pool);
+                    for (std::size_t i = 0; i < 1000; ++i) {
+                        auto* object = magazine.create(static_cast<int>(i));
+                        magazine.destroy(magazine.create(static_cast<int>(i)));
+                        shared[thread * 1000 + i] = object;
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+        EXPECT_EQ(Tracked::alive, 4000);
+
+        // Objects can be freed by a different thread than the one that created them
+        for (auto* object : shared) {
+            pool.destroy(object);
+        }
+        EXPECT_EQ(Tracked::alive, 0);
+        EXPECT_EQ(pool.size(), 0);
+    }
+} // namespace
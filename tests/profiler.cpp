@@ -0,0 +1,128 @@
+#define ORION_PROFILING 1
+#include "orion-utils/profiler.h"
+
+#include <algorithm> // std::ranges::count_if, std::ranges::find, std::ranges::find_if
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t
+#include <gtest/gtest.h>
+#include <iterator>    // std::back_inserter
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <thread>      // std::thread
+#include <vector>      // std::vector
+
+namespace
+{
+    std::size_t count_zones(std::string_view name)
+    {
+        return static_cast<std::size_t>(std::ranges::count_if(orion::Profiler::instance().events(), [name](const orion::ProfileEvent& event) { return event.zone->name == name; }));
+    }
+
+    const orion::ProfileEvent& find_zone(std::string_view name)
+    {
+        const auto events = orion::Profiler::instance().events();
+        return *std::ranges::find_if(events, [name](const orion::ProfileEvent& event) { return event.zone->name == name; });
+    }
+
+    TEST(Profiler, NestedScopes)
+    {
+        auto& profiler = orion::Profiler::instance();
+        profiler.clear();
+        {
+            ORION_PROFILE_SCOPE("frame");
+            for (int i = 0; i < 3; ++i) {
+                ORION_PROFILE_SCOPE("update");
+            }
+        }
+        EXPECT_EQ(profiler.collect(), 4);
+        EXPECT_EQ(count_zones("update"), 3);
+
+        const auto& frame = find_zone("frame");
+        const auto& update = find_zone("update");
+        EXPECT_LE(frame.begin, update.begin);
+        EXPECT_GE(frame.end, update.end);
+        EXPECT_EQ(frame.thread, update.thread);
+        EXPECT_STREQ(frame.zone->file, __FILE__);
+    }
+
+    TEST(Profiler, Threads)
+    {
+        constexpr std::size_t thread_count = 4;
+        constexpr std::size_t zones_per_thread = 1000;
+
+        auto& profiler = orion::Profiler::instance();
+        profiler.clear();
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < thread_count; ++i) {
+            threads.emplace_back([]() {
+                for (std::size_t zone = 0; zone < zones_per_thread; ++zone) {
+                    ORION_PROFILE_SCOPE("work");
+                }
+            });
+        }
+        // Collecting while the threads record
+        std::size_t collected = 0;
+        while (collected < thread_count * zones_per_thread) {
+            collected += profiler.collect();
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        EXPECT_EQ(profiler.collect(), 0);
+        EXPECT_EQ(count_zones("work"), thread_count * zones_per_thread);
+
+        std::vector<std::uint32_t> ids;
+        for (const auto& event : profiler.events()) {
+            if (std::ranges::find(ids, event.thread) == ids.end()) {
+                ids.push_back(event.thread);
+            }
+        }
+        EXPECT_EQ(ids.size(), thread_count);
+    }
+
+    TEST(Profiler, FullRingDropsZones)
+    {
+        auto& profiler = orion::Profiler::instance();
+        profiler.clear();
+        const auto dropped = profiler.dropped_events();
+        for (std::size_t i = 0; i < orion::Profiler::buffer_capacity + 10; ++i) {
+            ORION_PROFILE_SCOPE("overflow");
+        }
+        profiler.collect();
+        EXPECT_EQ(count_zones("overflow"), orion::Profiler::buffer_capacity);
+        EXPECT_EQ(profiler.dropped_events() - dropped, 10);
+    }
+
+    TEST(Profiler, Disabled)
+    {
+        auto& profiler = orion::Profiler::instance();
+        profiler.clear();
+        orion::Profiler::set_enabled(false);
+        {
+            ORION_PROFILE_SCOPE("disabled");
+        }
+        orion::Profiler::set_enabled(true);
+        EXPECT_EQ(profiler.collect(), 0);
+    }
+
+    TEST(Profiler, ChromeTrace)
+    {
+        auto& profiler = orion::Profiler::instance();
+        profiler.clear();
+        ORION_PROFILE_THREAD_NAME("main \"thread\"");
+        {
+            ORION_PROFILE_SCOPE("load\\mesh");
+        }
+        std::string trace;
+        profiler.write_chrome_trace(std::back_inserter(trace));
+
+        EXPECT_TRUE(trace.starts_with("{\"traceEvents\":["));
+        EXPECT_TRUE(trace.ends_with("]}\n"));
+        EXPECT_NE(trace.find(R"("name":"thread_name","ph":"M")"), std::string::npos);
+        EXPECT_NE(trace.find(R"("args":{"name":"main \"thread\""})"), std::string::npos);
+        EXPECT_NE(trace.find(R"({"name":"load\\mesh","ph":"X","ts":)"), std::string::npos);
+        EXPECT_NE(trace.find(R"(,"line":)"), std::string::npos);
+        // Kept for the next trace until cleared
+        EXPECT_EQ(count_zones("load\\mesh"), 1);
+    }
+} // namespace
@@ -0,0 +1,209 @@
+#include "orion-utils/slot_map.h"
+
+#include <algorithm> // std::ranges::sort
+#include <gtest/gtest.h>
+#include <memory> // std::unique_ptr, std::make_unique
+#include <string> // std::string
+#include <vector> // std::vector
+
+namespace
+{
+    const std::string long_string = "a string that is too long for the small string optimization";
+
+    TEST(SlotMap, Handle)
+    {
+        using Handle = orion::SlotHandle<10>;
+        static_assert(sizeof(Handle) == sizeof(std::uint32_t));
+        static_assert(Handle::generation_bits == 22);
+
+        const Handle handle{5, 3};
+        EXPECT_EQ(handle.index(), 5);
+        EXPECT_EQ(handle.generation(), 3);
+        EXPECT_EQ(Handle::from_value(handle.value()), handle);
+        EXPECT_TRUE(Handle{}.is_null());
+        EXPECT_FALSE(handle.is_null());
+    }
+
+    TEST(SlotMap, IndexBits)
+    {
+        static_assert(orion::slot_map<int, 1>::handle_type::index_bits == 1);
+        static_assert(orion::slot_map<int, 64>::handle_type::index_bits == 6);
+        static_assert(orion::slot_map<int, 65>::handle_type::index_bits == 7);
+        static_assert(orion::dynamic_slot_map<int>::handle_type::index_bits == 20);
+    }
+
+    TEST(SlotMap, InsertFind)
+    {
+        orion::slot_map<std::string, 8> map;
+        EXPECT_TRUE(map.empty());
+        const auto a = map.insert("a");
+        const auto b = map.insert(long_string);
+        const auto c = map.emplace(std::size_t{3}, 'c');
+        EXPECT_EQ(map.size(), 3);
+
+        EXPECT_EQ(map[a], "a");
+        EXPECT_EQ(map[b], long_string);
+        EXPECT_EQ(*map.find(c), "ccc");
+        EXPECT_TRUE(map.contains(b));
+        EXPECT_FALSE(map.contains({}));
+        EXPECT_EQ(map.find({}), nullptr);
+    }
+
+    TEST(SlotMap, Erase)
+    {
+        orion::slot_map<std::string, 8> map;
+        const auto a = map.insert("a");
+        const auto b = map.insert(long_string);
+        const auto c = map.insert("c");
+
+        EXPECT_TRUE(map.erase(a));
+        EXPECT_FALSE(map.erase(a));
+        EXPECT_FALSE(map.contains(a));
+        EXPECT_EQ(map.find(a), nullptr);
+        EXPECT_EQ(map.size(), 2);
+
+        // The last value moved into the hole, handles still find their values
+        EXPECT_EQ(map[b], long_string);
+        EXPECT_EQ(map[c], "c");
+        EXPECT_EQ(map.values().front(), "c");
+
+        // The freed slot is reused with a new generation
+        const auto d = map.insert("d");
+        EXPECT_EQ(d.index(), a.index());
+        EXPECT_NE(d.generation(), a.generation());
+        EXPECT_FALSE(map.contains(a));
+        EXPECT_EQ(map[d], "d");
+    }
+
+    TEST(SlotMap, EraseIterator)
+    {
+        orion::slot_map<int, 8> map;
+        for (int i = 0; i < 6; ++i) {
+            map.insert(i);
+        }
+        // Erase odd values while walking the dense storage
+        for (auto iter = map.begin(); iter != map.end();) {
+            iter = *iter % 2 != 0 ? map.erase(iter) : iter + 1;
+        }
+        std::vector<int> values(map.begin(), map.end());
+        std::ranges::sort(values);
+        EXPECT_EQ(values, (std::vector{0, 2, 4}));
+    }
+
+    TEST(SlotMap, DenseIteration)
+    {
+        orion::slot_map<int, 16> map;
+        std::vector<orion::slot_map<int, 16>::handle_type> handles;
+        for (int i = 0; i < 10; ++i) {
+            handles.push_back(map.insert(i * 10));
+        }
+        map.erase(handles[2]);
+        map.erase(handles[7]);
+
+        EXPECT_EQ(map.end() - map.begin(), 8);
+        for (std::size_t i = 0; i < map.size(); ++i) {
+            const auto handle = map.handle_at(i);
+            EXPECT_EQ(&map[handle], map.data() + i);
+        }
+    }
+
+    TEST(SlotMap, Full)
+    {
+        orion::slot_map<int, 4> map;
+        for (int i = 0; i < 4; ++i) {
+            map.insert(i);
+        }
+        EXPECT_EQ(map.size(), map.max_size());
+        map.erase(map.handle_at(0));
+        map.insert(4);
+        EXPECT_EQ(map.size(), 4);
+    }
+
+    TEST(SlotMap, GenerationWrap)
+    {
+        // One index bit for Capacity 2 leaves 31 generation bits, use a dynamic map with 30 index bits to
+        // exhaust a slot's 2 generation bits quickly
+        orion::dynamic_slot_map<int, 30> map;
+        auto handle = map.insert(0);
+        EXPECT_EQ(handle.generation(), 1);
+        map.erase(handle);
+        handle = map.insert(1);
+        EXPECT_EQ(handle.generation(), 2);
+        map.erase(handle);
+        handle = map.insert(2);
+        EXPECT_EQ(handle.generation(), 3);
+        const auto stale = handle;
+        const auto retired = handle.index();
+        map.erase(handle);
+
+        // The slot ran out of generations and is not handed out again
+        handle = map.insert(3);
+        EXPECT_NE(handle.index(), retired);
+        EXPECT_EQ(handle.generation(), 1);
+
+        // Neither the null handle nor the last handle to the retired slot match it
+        using Handle = decltype(map)::handle_type;
+        EXPECT_FALSE(map.contains(Handle{}));
+        EXPECT_EQ(map.find(Handle{}), nullptr);
+        EXPECT_FALSE(map.contains(stale));
+        EXPECT_EQ(map.find(stale), nullptr);
+        EXPECT_FALSE(map.erase(Handle{}));
+        EXPECT_EQ(map.size(), 1);
+
+        map.clear();
+        EXPECT_FALSE(map.contains(Handle{}));
+        EXPECT_EQ(map.find(Handle{}), nullptr);
+        EXPECT_FALSE(map.contains(stale));
+    }
+
+    TEST(SlotMap, Clear)
+    {
+        orion::slot_map<std::string, 4> map;
+        const auto a = map.insert(long_string);
+        const auto b = map.insert("b");
+        map.clear();
+        EXPECT_TRUE(map.empty());
+        EXPECT_FALSE(map.contains(a));
+        EXPECT_FALSE(map.contains(b));
+        map.insert("c");
+        EXPECT_EQ(map.size(), 1);
+    }
+
+    TEST(SlotMap, Dynamic)
+    {
+        orion::dynamic_slot_map<std::unique_ptr<int>> map;
+        map.reserve(16);
+        std::vector<orion::dynamic_slot_map<std::unique_ptr<int>>::handle_type> handles;
+        for (int i = 0; i < 1000; ++i) {
+            handles.push_back(map.emplace(std::make_unique<int>(i)));
+        }
+        for (std::size_t i = 0; i < handles.size(); i += 3) {
+            EXPECT_TRUE(map.erase(handles[i]));
+        }
+        for (std::size_t i = 0; i < handles.size(); ++i) {
+            if (i % 3 == 0) {
+                EXPECT_FALSE(map.contains(handles[i]));
+            } else {
+                EXPECT_EQ(*map[handles[i]], static_cast<int>(i));
+            }
+        }
+        EXPECT_EQ(map.size(), 666);
+    }
+
+    TEST(SlotMap, Constexpr)
+    {
+        constexpr auto sum = []() {
+            orion::slot_map<int, 8> map;
+            const auto a = map.insert(1);
+            map.insert(2);
+            map.insert(3);
+            map.erase(a);
+            int total = 0;
+            for (int value : map) {
+                total += value;
+            }
+            return total;
+        }();
+        static_assert(sum == 5);
+    }
+} // namespace
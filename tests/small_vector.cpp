@@ -0,0 +1,293 @@
+#include "orion-utils/small_vector.h"
+
+#include <algorithm> // std::all_of, std::equal
+#include <gtest/gtest.h>
+#include <iterator> // std::istream_iterator
+#include <sstream>  // std::istringstream
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+namespace
+{
+    struct DefaultConstructible {
+        constexpr static int expected = 42;
+
+        DefaultConstructible()
+            : value(expected)
+        {
+        }
+
+        int value;
+    };
+
+    // Counts live allocations so tests can tell whether the heap was touched
+    template<typename T>
+    struct CountingAllocator {
+        using value_type = T;
+
+        explicit CountingAllocator(int& counter)
+            : allocations(&counter)
+        {
+        }
+        template<typename U>
+        CountingAllocator(const CountingAllocator<U>& other)
+            : allocations(other.allocations)
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            ++*allocations;
+            return std::allocator<T>{}.allocate(n);
+        }
+        void deallocate(T* ptr, std::size_t n)
+        {
+            --*allocations;
+            std::allocator<T>{}.deallocate(ptr, n);
+        }
+
+        bool operator==(const CountingAllocator& other) const noexcept = default;
+
+        int* allocations;
+    };
+
+    const std::string long_string = "a string that is too long for the small string optimization";
+
+    TEST(SmallVector, DefaultCtor)
+    {
+        constexpr auto capacity = 5;
+        const orion::small_vector<int, capacity> vector;
+        EXPECT_EQ(vector.capacity(), capacity);
+        EXPECT_EQ(vector.inline_capacity(), capacity);
+        EXPECT_EQ(vector.size(), 0);
+        EXPECT_TRUE(vector.empty());
+        EXPECT_TRUE(vector.is_inline());
+        EXPECT_EQ(std::distance(vector.begin(), vector.end()), 0);
+    }
+
+    TEST(SmallVector, SizeType)
+    {
+        static_assert(std::is_same_v<orion::small_vector<int, 4>::size_type, std::uint32_t>);
+        static_assert(sizeof(orion::small_vector<int, 2>) == sizeof(void*) + 2 * sizeof(std::uint32_t) + 2 * sizeof(int));
+    }
+
+    TEST(SmallVector, DefaultNCtor)
+    {
+        const orion::small_vector<DefaultConstructible, 2> vector(4);
+        EXPECT_EQ(vector.size(), 4);
+        EXPECT_FALSE(vector.is_inline());
+        EXPECT_TRUE(std::all_of(vector.begin(), vector.end(), [](auto obj) { return obj.value == DefaultConstructible::expected; }));
+    }
+
+    TEST(SmallVector, FillNCtor)
+    {
+        const orion::small_vector<std::string, 2> vector(3, long_string);
+        EXPECT_EQ(vector.size(), 3);
+        EXPECT_TRUE(std::all_of(vector.begin(), vector.end(), [](const auto& str) { return str == long_string; }));
+    }
+
+    TEST(SmallVector, InitializerListCtor)
+    {
+        const std::array expected{1, 2, 3};
+        const orion::small_vector<int, 3> vector{1, 2, 3};
+        EXPECT_TRUE(vector.is_inline());
+        EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()));
+    }
+
+    TEST(SmallVector, PushBackSpills)
+    {
+        orion::small_vector<int, 4> vector;
+        for (int i = 0; i < 4; ++i) {
+            vector.push_back(i);
+        }
+        EXPECT_TRUE(vector.is_inline());
+
+        vector.push_back(4);
+        EXPECT_FALSE(vector.is_inline());
+        EXPECT_EQ(vector.size(), 5);
+        EXPECT_GE(vector.capacity(), 8);
+        for (int i = 0; i < 5; ++i) {
+            EXPECT_EQ(vector[static_cast<std::uint32_t>(i)], i);
+        }
+    }
+
+    TEST(SmallVector, EmplaceBackAliasing)
+    {
+        orion::small_vector<std::string, 1> vector;
+        vector.push_back(long_string);
+
+        // The argument lives in the inline buffer that is released by the reallocation
+        vector.emplace_back(vector.front());
+        EXPECT_FALSE(vector.is_inline());
+        EXPECT_EQ(vector[0], long_string);
+        EXPECT_EQ(vector[1], long_string);
+    }
+
+    TEST(SmallVector, InsertSpills)
+    {
+        const std::array expected{1, 6, 7, 8, 2, 3};
+        const std::vector inserted{6, 7, 8};
+        orion::small_vector<int, 4> vector{1, 2, 3};
+
+        auto iter = vector.insert(vector.begin() + 1, inserted.begin(), inserted.end());
+        EXPECT_EQ(iter, vector.begin() + 1);
+        EXPECT_FALSE(vector.is_inline());
+        EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()));
+    }
+
+    TEST(SmallVector, InsertNonTrivial)
+    {
+        const std::array<std::string, 5> expected{"a", long_string, "b", "c", long_string};
+        orion::small_vector<std::string, 2> vector{"a", "b"};
+
+        vector.insert(vector.end(), {"c", long_string});
+        vector.insert(vector.begin() + 1, 1, vector.back());
+        EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()));
+    }
+
+    TEST(SmallVector, InsertInputIterator)
+    {
+        const std::array expected{1, 4, 5, 2};
+        std::istringstream stream{"4 5"};
+        orion::small_vector<int, 2> vector{1, 2};
+
+        vector.insert(vector.begin() + 1, std::istream_iterator<int>{stream}, std::istream_iterator<int>{});
+        EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()));
+    }
+
+    TEST(SmallVector, Erase)
+    {
+        const std::array<std::string, 2> expected{"a", long_string};
+        orion::small_vector<std::string, 2> vector{"a", "b", "c", long_string};
+
+        auto iter = vector.erase(vector.begin() + 1, vector.begin() + 3);
+        EXPECT_EQ(*iter, long_string);
+        EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()));
+
+        vector.pop_back();
+        EXPECT_EQ(vector.size(), 1);
+    }
+
+    TEST(SmallVector, Assign)
+    {
+        orion::small_vector<std::string, 2> vector{"a"};
+
+        vector.assign(4, long_string);
+        EXPECT_EQ(vector.size(), 4);
+        EXPECT_TRUE(std::all_of(vector.begin(), vector.end(), [](const auto& str) { return str == long_string; }));
+
+        vector.assign({"x", "y"});
+        EXPECT_EQ(vector.size(), 2);
+        EXPECT_EQ(vector[1], "y");
+    }
+
+    TEST(SmallVector, Resize)
+    {
+        orion::small_vector<int, 2> vector;
+        vector.resize(5, 3);
+        EXPECT_EQ(vector.size(), 5);
+        EXPECT_TRUE(std::all_of(vector.begin(), vector.end(), [](int value) { return value == 3; }));
+
+        vector.resize(1);
+        EXPECT_EQ(vector.size(), 1);
+    }
+
+    TEST(SmallVector, ReserveAndShrink)
+    {
+        orion::small_vector<std::string, 2> vector{"a"};
+        vector.reserve(16);
+        EXPECT_FALSE(vector.is_inline());
+        EXPECT_EQ(vector.capacity(), 16);
+        EXPECT_EQ(vector.front(), "a");
+
+        vector.shrink_to_fit();
+        EXPECT_TRUE(vector.is_inline());
+        EXPECT_EQ(vector.capacity(), 2);
+        EXPECT_EQ(vector.front(), "a");
+    }
+
+    TEST(SmallVector, CopyCtor)
+    {
+        const orion::small_vector<std::string, 2> inline_vector{"a", "b"};
+        const auto inline_copy(inline_vector);
+        EXPECT_EQ(inline_copy, inline_vector);
+
+        const orion::small_vector<std::string, 2> heap_vector{"a", "b", "c"};
+        const auto heap_copy(heap_vector);
+        EXPECT_EQ(heap_copy, heap_vector);
+        EXPECT_NE(heap_copy.data(), heap_vector.data());
+    }
+
+    TEST(SmallVector, MoveCtor)
+    {
+        orion::small_vector<std::string, 2> heap_vector{"a", "b", "c"};
+        const auto* heap = heap_vector.data();
+        const auto moved(std::move(heap_vector));
+        EXPECT_EQ(moved.data(), heap);
+        EXPECT_EQ(moved.size(), 3);
+        EXPECT_TRUE(heap_vector.is_inline()); // NOLINT(bugprone-use-after-move)
+        EXPECT_TRUE(heap_vector.empty());
+
+        orion::small_vector<std::string, 2> inline_vector{"a", long_string};
+        const auto moved_inline(std::move(inline_vector));
+        EXPECT_TRUE(moved_inline.is_inline());
+        EXPECT_EQ(moved_inline[1], long_string);
+    }
+
+    TEST(SmallVector, MoveAssignment)
+    {
+        orion::small_vector<std::string, 2> vector{"x", "y", "z"};
+        vector = orion::small_vector<std::string, 2>{"a"};
+        EXPECT_TRUE(vector.is_inline());
+        EXPECT_EQ(vector.size(), 1);
+
+        vector = orion::small_vector<std::string, 2>{"a", "b", long_string};
+        EXPECT_FALSE(vector.is_inline());
+        EXPECT_EQ(vector.back(), long_string);
+    }
+
+    TEST(SmallVector, Allocator)
+    {
+        int allocations = 0;
+        {
+            using Vector = orion::small_vector<int, 2, CountingAllocator<int>>;
+            Vector vector(CountingAllocator<int>{allocations});
+            vector.push_back(1);
+            vector.push_back(2);
+            EXPECT_EQ(allocations, 0);
+
+            vector.push_back(3);
+            EXPECT_EQ(allocations, 1);
+
+            Vector copy(vector);
+            EXPECT_EQ(allocations, 2);
+
+            Vector moved(std::move(copy));
+            EXPECT_EQ(allocations, 2);
+        }
+        EXPECT_EQ(allocations, 0);
+    }
+
+    TEST(SmallVector, ReverseIteration)
+    {
+        const std::array expected{3, 2, 1};
+        const orion::small_vector<int, 2> vector{1, 2, 3};
+        EXPECT_TRUE(std::equal(vector.rbegin(), vector.rend(), expected.begin(), expected.end()));
+    }
+
+    TEST(SmallVector, Constexpr)
+    {
+        constexpr auto result = []() {
+            orion::small_vector<int, 2> vector{1, 2};
+            vector.push_back(3);
+            vector.insert(vector.begin(), 0);
+            vector.erase(vector.begin() + 1);
+            int sum = 0;
+            for (auto value : vector) {
+                sum += value;
+            }
+            return sum;
+        }();
+        static_assert(result == 5);
+    }
+} // namespace
@@ -0,0 +1,206 @@
+#include "orion-utils/soa_vector.h"
+
+#include <algorithm> // std::ranges::equal, std::find_if, std::count_if
+#include <cstdint>   // std::uintptr_t
+#include <gtest/gtest.h>
+#include <iterator>  // std::random_access_iterator
+#include <memory>    // std::unique_ptr, std::make_unique
+#include <stdexcept> // std::runtime_error
+#include <string>    // std::string, std::to_string
+#include <tuple>     // std::tuple, std::get
+#include <vector>    // std::vector
+
+namespace
+{
+    const std::string long_string = "a string that is too long for the small string optimization";
+
+    struct Vec3 {
+        float x, y, z;
+        bool operator==(const Vec3&) const = default;
+    };
+
+    // Copies throw for negative values
+    struct ThrowingCopy {
+        static inline int alive = 0;
+
+        explicit ThrowingCopy(int v)
+            : value(v)
+        {
+            ++alive;
+        }
+        ThrowingCopy(const ThrowingCopy& other)
+            : value(other.value)
+        {
+            if (value < 0) {
+                throw std::runtime_error("negative");
+            }
+            ++alive;
+        }
+        ThrowingCopy(ThrowingCopy&& other) noexcept
+            : value(other.value)
+        {
+            ++alive;
+        }
+        ThrowingCopy& operator=(const ThrowingCopy&) = default;
+        ThrowingCopy& operator=(ThrowingCopy&&) noexcept = default;
+        ~ThrowingCopy() { --alive; }
+
+        int value;
+    };
+
+    template<typename Span>
+    bool is_cache_line_aligned(Span span)
+    {
+        return reinterpret_cast<std::uintptr_t>(span.data()) % orion::cache_line_size == 0;
+    }
+
+    TEST(SoaVector, PushBackColumns)
+    {
+        orion::soa_vector<int, float, std::string> vector;
+        EXPECT_TRUE(vector.empty());
+        vector.push_back({1, 1.5f, "one"});
+        vector.emplace_back(2, 2.5f, long_string);
+        const std::tuple<int, float, std::string> three{3, 3.5f, "three"};
+        vector.push_back(three);
+        EXPECT_EQ(vector.size(), 3);
+
+        EXPECT_TRUE(std::ranges::equal(vector.column<0>(), std::vector{1, 2, 3}));
+        EXPECT_TRUE(std::ranges::equal(vector.column<float>(), std::vector{1.5f, 2.5f, 3.5f}));
+        EXPECT_EQ(vector.column<std::string>()[1], long_string);
+        EXPECT_EQ(vector.data<0>(), vector.column<int>().data());
+
+        EXPECT_TRUE(is_cache_line_aligned(vector.column<0>()));
+        EXPECT_TRUE(is_cache_line_aligned(vector.column<1>()));
+        EXPECT_TRUE(is_cache_line_aligned(vector.column<2>()));
+    }
+
+    TEST(SoaVector, RowAccess)
+    {
+        orion::static_soa_vector<8, Vec3, Vec3, float> particles;
+        particles.emplace_back(Vec3{0, 0, 0}, Vec3{1, 0, 0}, 1.0f);
+        particles.emplace_back(Vec3{1, 1, 1}, Vec3{0, 2, 0}, 2.0f);
+
+        auto [position, velocity, lifetime] = particles[1];
+        position.y += velocity.y;
+        lifetime = 0.5f;
+        EXPECT_EQ(particles.column<0>()[1], (Vec3{1, 3, 1}));
+        EXPECT_EQ(particles.column<2>()[1], 0.5f);
+
+        for (auto [p, v, l] : particles) {
+            p.x += v.x;
+            l -= 0.5f;
+        }
+        EXPECT_EQ(std::get<0>(particles.front()), (Vec3{1, 0, 0}));
+        EXPECT_EQ(std::get<2>(particles.back()), 0.0f);
+
+        const auto& const_particles = particles;
+        EXPECT_EQ(const_particles.end() - const_particles.begin(), 2);
+        EXPECT_EQ(std::get<1>(const_particles.begin()[1]), (Vec3{0, 2, 0}));
+        EXPECT_TRUE(is_cache_line_aligned(particles.column<1>()));
+    }
+
+    TEST(SoaVector, IteratorAlgorithms)
+    {
+        orion::soa_vector<int, char> vector;
+        for (int i = 0; i < 5; ++i) {
+            vector.emplace_back(i, static_cast<char>('a' + i));
+        }
+        static_assert(std::random_access_iterator<orion::soa_vector<int, char>::iterator>);
+        const auto found = std::find_if(vector.begin(), vector.end(), [](const auto& row) { return std::get<1>(row) == 'c'; });
+        EXPECT_EQ(found - vector.begin(), 2);
+        EXPECT_EQ(std::count_if(vector.cbegin(), vector.cend(), [](const auto& row) { return std::get<0>(row) % 2 == 0; }), 3);
+    }
+
+    TEST(SoaVector, Erase)
+    {
+        orion::soa_vector<int, std::string> vector;
+        for (int i = 0; i < 5; ++i) {
+            vector.emplace_back(i, std::to_string(i) + long_string);
+        }
+        auto next = vector.erase(vector.begin() + 1);
+        EXPECT_EQ(std::get<0>(*next), 2);
+        EXPECT_TRUE(std::ranges::equal(vector.column<int>(), std::vector{0, 2, 3, 4}));
+
+        next = vector.swap_remove(vector.begin());
+        EXPECT_EQ(std::get<0>(*next), 4);
+        EXPECT_EQ(std::get<1>(*next), "4" + long_string);
+        EXPECT_TRUE(std::ranges::equal(vector.column<int>(), std::vector{4, 2, 3}));
+
+        vector.erase_unordered(vector.end() - 1);
+        vector.pop_back();
+        ASSERT_EQ(vector.size(), 1);
+        EXPECT_EQ(std::get<1>(vector[0]), "4" + long_string);
+    }
+
+    TEST(SoaVector, Growth)
+    {
+        orion::soa_vector<std::unique_ptr<int>, double> vector;
+        vector.reserve(4);
+        EXPECT_EQ(vector.capacity(), 4);
+        for (int i = 0; i < 100; ++i) {
+            vector.emplace_back(std::make_unique<int>(i), i * 0.5);
+        }
+        EXPECT_GE(vector.capacity(), 100);
+        for (int i = 0; i < 100; ++i) {
+            const auto& [pointer, value] = vector[static_cast<std::size_t>(i)];
+            EXPECT_EQ(*pointer, i);
+            EXPECT_EQ(value, i * 0.5);
+        }
+        EXPECT_TRUE(is_cache_line_aligned(vector.column<1>()));
+    }
+
+    TEST(SoaVector, Resize)
+    {
+        orion::static_soa_vector<8, int, std::string> vector;
+        vector.resize(3);
+        EXPECT_EQ(vector.size(), 3);
+        EXPECT_EQ(std::get<1>(vector[2]), "");
+        vector.resize(1);
+        EXPECT_EQ(vector.size(), 1);
+        vector.clear();
+        EXPECT_TRUE(vector.empty());
+        EXPECT_EQ(vector.capacity(), 8);
+    }
+
+    TEST(SoaVector, CopyMove)
+    {
+        orion::soa_vector<int, std::string> dynamic;
+        dynamic.emplace_back(1, long_string);
+        dynamic.emplace_back(2, "two");
+
+        auto copy = dynamic;
+        EXPECT_EQ(std::get<1>(copy[0]), long_string);
+        auto moved = std::move(dynamic);
+        EXPECT_EQ(moved.size(), 2);
+        EXPECT_TRUE(dynamic.empty()); // NOLINT(bugprone-use-after-move): moved-from state is specified
+        copy = moved;
+        EXPECT_EQ(copy.size(), 2);
+        moved = std::move(copy);
+        EXPECT_EQ(std::get<1>(moved[1]), "two");
+
+        orion::static_soa_vector<4, int, std::string> fixed;
+        fixed.emplace_back(3, long_string);
+        auto fixed_copy = fixed;
+        auto fixed_moved = std::move(fixed);
+        EXPECT_EQ(std::get<1>(fixed_copy[0]), long_string);
+        EXPECT_EQ(std::get<1>(fixed_moved[0]), long_string);
+        fixed_copy = std::move(fixed_moved);
+        EXPECT_EQ(fixed_copy.size(), 1);
+    }
+
+    TEST(SoaVector, ThrowingCopy)
+    {
+        orion::soa_vector<std::string, ThrowingCopy> dynamic;
+        dynamic.emplace_back(long_string, 1);
+        dynamic.emplace_back(long_string, 2);
+        dynamic.emplace_back(long_string, -1);
+        EXPECT_THROW(auto copy = dynamic, std::runtime_error);
+        EXPECT_EQ(ThrowingCopy::alive, 3);
+
+        orion::static_soa_vector<4, std::string, ThrowingCopy> fixed;
+        fixed.emplace_back(long_string, 1);
+        fixed.emplace_back(long_string, -1);
+        EXPECT_THROW(auto copy = fixed, std::runtime_error);
+        EXPECT_EQ(ThrowingCopy::alive, 5);
+    }
+} // namespace
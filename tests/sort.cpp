@@ -0,0 +1,171 @@
+#include "orion-utils/sort.h"
+
+#include <algorithm>  // std::ranges::is_sorted, std::ranges::stable_sort
+#include <cstdint>    // std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t, std::int32_t, std::int64_t
+#include <functional> // std::ranges::greater
+#include <gtest/gtest.h>
+#include <limits>      // std::numeric_limits
+#include <random>      // std::mt19937_64
+#include <string>      // std::string
+#include <type_traits> // std::is_floating_point_v
+#include <vector>      // std::vector
+
+namespace
+{
+    struct DrawKey {
+        std::uint64_t key;
+        std::uint32_t index;
+
+        bool operator==(const DrawKey&) const = default;
+    };
+
+    std::mt19937_64& engine()
+    {
+        static std::mt19937_64 engine{7}; // NOLINT(cert-msc32-c, cert-msc51-cpp): deterministic on purpose
+        return engine;
+    }
+
+    std::uint64_t random_bits()
+    {
+        return engine()();
+    }
+
+    template<typename T>
+    std::vector<T> random_values(std::size_t count)
+    {
+        std::vector<T> values(count);
+        for (auto& value : values) {
+            if constexpr (std::is_floating_point_v<T>) {
+                value = std::uniform_real_distribution<T>{-1e6, 1e6}(engine());
+            } else {
+                value = static_cast<T>(random_bits());
+            }
+        }
+        return values;
+    }
+
+    template<typename T>
+    void check_radix_sort(std::vector<T> values)
+    {
+        auto expected = values;
+        std::ranges::stable_sort(expected);
+        std::vector<T> scratch(values.size());
+        orion::radix_sort(values, scratch);
+        EXPECT_EQ(values, expected);
+    }
+
+    TEST(RadixSort, KeyTypes)
+    {
+        for (std::size_t size : {0u, 1u, 2u, 100u, 5000u}) {
+            check_radix_sort(random_values<std::uint8_t>(size));
+            check_radix_sort(random_values<std::uint16_t>(size));
+            check_radix_sort(random_values<std::uint32_t>(size));
+            check_radix_sort(random_values<std::uint64_t>(size));
+            check_radix_sort(random_values<std::int32_t>(size));
+            check_radix_sort(random_values<std::int64_t>(size));
+            check_radix_sort(random_values<float>(size));
+            check_radix_sort(random_values<double>(size));
+        }
+        check_radix_sort(std::vector<std::int32_t>{0, -1, std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::max(), 1});
+        check_radix_sort(std::vector<double>{0.5, -0.5, -std::numeric_limits<double>::infinity(), 1e300, -1e-300, std::numeric_limits<double>::infinity()});
+    }
+
+    TEST(RadixSort, ProjectionIsStable)
+    {
+        // Few distinct keys, every key occurs many times
+        std::vector<DrawKey> keys;
+        for (std::uint32_t i = 0; i < 3000; ++i) {
+            keys.push_back(DrawKey{random_bits() % 16 << 40, i});
+        }
+        auto expected = keys;
+        std::ranges::stable_sort(expected, {}, &DrawKey::key);
+        std::vector<DrawKey> scratch(keys.size());
+        orion::radix_sort(keys, scratch, &DrawKey::key);
+        EXPECT_EQ(keys, expected);
+
+        enum class Layer : std::uint8_t { background, world, ui };
+        struct Sprite {
+            Layer layer;
+            int id;
+            bool operator==(const Sprite&) const = default;
+        };
+        std::vector<Sprite> sprites{{Layer::ui, 0}, {Layer::background, 1}, {Layer::world, 2}, {Layer::background, 3}};
+        std::vector<Sprite> sprite_scratch(sprites.size());
+        orion::radix_sort(sprites, sprite_scratch, [](const Sprite& sprite) { return sprite.layer; });
+        EXPECT_EQ(sprites, (std::vector<Sprite>{{Layer::background, 1}, {Layer::background, 3}, {Layer::world, 2}, {Layer::ui, 0}}));
+    }
+
+    TEST(RadixSort, InlineScratch)
+    {
+        orion::static_vector<DrawKey, 1024> keys;
+        for (std::uint32_t i = 0; i < 1000; ++i) {
+            keys.push_back(DrawKey{random_bits(), i});
+        }
+        orion::radix_sort(keys, &DrawKey::key);
+        EXPECT_TRUE(std::ranges::is_sorted(keys, {}, &DrawKey::key));
+    }
+
+    static_assert(orion::detail::sorting_network<32>.size() == 191);
+    static_assert(orion::detail::sorting_network<2>.size() == 1);
+
+    TEST(Sort, NetworksZeroOnePrinciple)
+    {
+        // A comparator network sorts every input iff it sorts every input of zeros and ones
+        for (std::size_t size = 0; size <= 16; ++size) {
+            for (std::uint32_t bits = 0; bits < (1u << size); ++bits) {
+                std::vector<int> values(size);
+                for (std::size_t i = 0; i < size; ++i) {
+                    values[i] = static_cast<int>((bits >> i) & 1);
+                }
+                orion::sort(values);
+                ASSERT_TRUE(std::ranges::is_sorted(values)) << size << " " << bits;
+            }
+        }
+    }
+
+    TEST(Sort, Networks)
+    {
+        for (std::size_t size = 0; size <= orion::detail::max_network_size; ++size) {
+            for (int round = 0; round < 200; ++round) {
+                auto values = random_values<std::uint32_t>(size);
+                for (auto& value : values) {
+                    value %= 8;
+                }
+                auto expected = values;
+                std::ranges::sort(expected);
+                orion::sort(values);
+                ASSERT_EQ(values, expected) << size;
+            }
+        }
+    }
+
+    TEST(Sort, CompareAndProjection)
+    {
+        std::vector<DrawKey> keys;
+        for (std::uint32_t i = 0; i < 20; ++i) {
+            keys.push_back(DrawKey{random_bits() % 100, i});
+        }
+        orion::sort(keys, std::ranges::greater{}, &DrawKey::key);
+        EXPECT_TRUE(std::ranges::is_sorted(keys, std::ranges::greater{}, &DrawKey::key));
+
+        // Too large for a network
+        auto strings = std::vector<std::string>{"d", "a", "c", "b"};
+        orion::sort(strings);
+        EXPECT_TRUE(std::ranges::is_sorted(strings));
+    }
+
+    TEST(Sort, StaticVector)
+    {
+        for (std::size_t size : {10u, 300u, 4096u}) {
+            orion::static_vector<DrawKey, 4096> keys;
+            for (std::uint32_t i = 0; i < size; ++i) {
+                keys.push_back(DrawKey{random_bits(), i});
+            }
+            orion::sort(keys, {}, &DrawKey::key);
+            EXPECT_TRUE(std::ranges::is_sorted(keys, {}, &DrawKey::key)) << size;
+
+            orion::sort(keys, std::ranges::greater{}, &DrawKey::index);
+            EXPECT_TRUE(std::ranges::is_sorted(keys, std::ranges::greater{}, &DrawKey::index)) << size;
+        }
+    }
+} // namespace
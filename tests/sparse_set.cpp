@@ -0,0 +1,187 @@
+#include "orion-utils/sparse_set.h"
+
+#include <gtest/gtest.h>
+#include <string> // std::string
+#include <vector> // std::vector
+
+namespace
+{
+    enum class Entity : std::uint32_t {};
+
+    constexpr Entity entity(std::uint32_t value)
+    {
+        return static_cast<Entity>(value);
+    }
+
+    const std::string long_string = "a string that is too long for the small string optimization";
+
+    TEST(SparseSet, InsertFind)
+    {
+        orion::sparse_set<Entity, std::string> set;
+        EXPECT_TRUE(set.empty());
+        set.insert(entity(3), "three");
+        set.insert(entity(100000), long_string);
+        set.emplace(entity(7), std::size_t{2}, 'x');
+        EXPECT_EQ(set.size(), 3);
+
+        EXPECT_TRUE(set.contains(entity(3)));
+        EXPECT_FALSE(set.contains(entity(4)));
+        // Entities past every allocated page
+        EXPECT_FALSE(set.contains(entity(50000000)));
+        EXPECT_EQ(set.find(entity(50000000)), nullptr);
+
+        EXPECT_EQ(set[entity(100000)], long_string);
+        EXPECT_EQ(*set.find(entity(7)), "xx");
+        EXPECT_EQ(set.index_of(entity(7)), 2);
+        EXPECT_EQ(set.index_of(entity(8)), set.npos);
+    }
+
+    TEST(SparseSet, IntegerEntity)
+    {
+        orion::sparse_set<std::uint16_t, int, 16> set;
+        set.insert(40, 1);
+        set.insert(2, 2);
+        EXPECT_EQ(set[40], 1);
+        EXPECT_EQ(set[2], 2);
+        EXPECT_FALSE(set.contains(3));
+    }
+
+    TEST(SparseSet, Erase)
+    {
+        orion::sparse_set<Entity, std::string> set;
+        set.insert(entity(1), "one");
+        set.insert(entity(2), long_string);
+        set.insert(entity(3), "three");
+
+        EXPECT_TRUE(set.erase(entity(1)));
+        EXPECT_FALSE(set.erase(entity(1)));
+        EXPECT_FALSE(set.contains(entity(1)));
+        EXPECT_EQ(set.size(), 2);
+
+        // The last element took the hole
+        EXPECT_EQ(set.entities()[0], entity(3));
+        EXPECT_EQ(set.values()[0], "three");
+        EXPECT_EQ(set[entity(2)], long_string);
+        EXPECT_EQ(set[entity(3)], "three");
+
+        EXPECT_TRUE(set.erase(entity(3)));
+        EXPECT_TRUE(set.erase(entity(2)));
+        EXPECT_TRUE(set.empty());
+
+        set.insert(entity(1), "again");
+        EXPECT_EQ(set[entity(1)], "again");
+    }
+
+    TEST(SparseSet, Clear)
+    {
+        orion::sparse_set<Entity, int> set;
+        for (std::uint32_t i = 0; i < 100; ++i) {
+            set.insert(entity(i * 97), static_cast<int>(i));
+        }
+        set.clear();
+        EXPECT_TRUE(set.empty());
+        for (std::uint32_t i = 0; i < 100; ++i) {
+            EXPECT_FALSE(set.contains(entity(i * 97)));
+        }
+    }
+
+    TEST(SparseSet, DenseIteration)
+    {
+        orion::sparse_set<Entity, int> set;
+        for (std::uint32_t i = 0; i < 10; ++i) {
+            set.insert(entity(i * 1000), static_cast<int>(i));
+        }
+        set.erase(entity(0));
+        int sum = 0;
+        for (int value : set) {
+            sum += value;
+        }
+        EXPECT_EQ(sum, 45);
+        EXPECT_EQ(set.end() - set.begin(), 9);
+        for (std::size_t i = 0; i < set.size(); ++i) {
+            EXPECT_EQ(set.index_of(set.entities()[i]), i);
+        }
+    }
+
+    TEST(SparseSet, Sort)
+    {
+        orion::sparse_set<Entity, std::string> set;
+        const std::vector<std::uint32_t> order{5, 3, 9, 1, 7, 2};
+        for (auto value : order) {
+            set.insert(entity(value), std::to_string(value) + long_string);
+        }
+        set.sort([](Entity lhs, Entity rhs) { return lhs < rhs; });
+
+        const std::vector expected{entity(1), entity(2), entity(3), entity(5), entity(7), entity(9)};
+        EXPECT_EQ(std::vector(set.entities().begin(), set.entities().end()), expected);
+        for (auto value : order) {
+            EXPECT_EQ(set[entity(value)], std::to_string(value) + long_string);
+        }
+    }
+
+    TEST(SparseSet, SortAs)
+    {
+        orion::sparse_set<Entity, int> positions;
+        orion::sparse_set<Entity, float> velocities;
+        for (std::uint32_t i = 0; i < 8; ++i) {
+            positions.insert(entity(i), static_cast<int>(i));
+        }
+        for (std::uint32_t i : {6u, 2u, 20u, 4u}) {
+            velocities.insert(entity(i), static_cast<float>(i));
+        }
+        positions.sort_as(velocities);
+
+        // Shared entities first, in the order of velocities
+        EXPECT_EQ(positions.entities()[0], entity(6));
+        EXPECT_EQ(positions.entities()[1], entity(2));
+        EXPECT_EQ(positions.entities()[2], entity(4));
+        for (std::uint32_t i = 0; i < 8; ++i) {
+            EXPECT_EQ(positions[entity(i)], static_cast<int>(i));
+        }
+    }
+
+    TEST(SparseSet, View)
+    {
+        orion::sparse_set<Entity, int> positions;
+        orion::sparse_set<Entity, float> velocities;
+        orion::sparse_set<Entity, std::string> names;
+        for (std::uint32_t i = 0; i < 100; ++i) {
+            positions.insert(entity(i), static_cast<int>(i));
+            if (i % 2 == 0) {
+                velocities.insert(entity(i), 0.5f);
+            }
+            if (i % 3 == 0) {
+                names.insert(entity(i), std::to_string(i));
+            }
+        }
+
+        const auto view = orion::view(positions, velocities, names);
+        EXPECT_EQ(view.size_hint(), names.size());
+
+        std::vector<Entity> visited;
+        view.each([&visited](Entity id, int& position, float velocity, const std::string& name) {
+            position += static_cast<int>(velocity * 2);
+            EXPECT_EQ(name, std::to_string(orion::to_underlying(id)));
+            visited.push_back(id);
+        });
+        EXPECT_EQ(visited.size(), 17);
+        for (auto id : visited) {
+            EXPECT_EQ(orion::to_underlying(id) % 6, 0);
+            EXPECT_EQ(positions[id], static_cast<int>(orion::to_underlying(id)) + 1);
+        }
+        EXPECT_EQ(positions[entity(1)], 1);
+    }
+
+    TEST(SparseSet, ConstView)
+    {
+        orion::sparse_set<Entity, int> a;
+        orion::sparse_set<Entity, int> b;
+        a.insert(entity(1), 10);
+        a.insert(entity(2), 20);
+        b.insert(entity(2), 2);
+        const auto& const_a = a;
+        int sum = 0;
+        orion::view(const_a, b).each([&sum](Entity, const int& lhs, int& rhs) { sum += lhs * rhs; });
+        EXPECT_EQ(sum, 40);
+    }
+} // namespace
@@ -0,0 +1,127 @@
+#include "orion-utils/spsc_queue.h"
+
+#include <algorithm> // std::min
+#include <array>     // std::array
+#include <gtest/gtest.h>
+#include <memory> // std::unique_ptr, std::make_unique
+#include <string> // std::string
+#include <thread> // std::thread, std::this_thread::yield
+#include <vector> // std::vector
+
+namespace
+{
+    const std::string long_string = "a string that is too long for the small string optimization";
+
+    TEST(SpscQueue, PushPop)
+    {
+        orion::spsc_queue<int, 4> queue;
+        EXPECT_TRUE(queue.empty());
+        EXPECT_EQ(queue.capacity(), 4);
+
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_TRUE(queue.try_push(i));
+        }
+        EXPECT_FALSE(queue.try_push(4));
+        EXPECT_EQ(queue.size(), 4);
+
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_EQ(queue.try_pop(), i);
+        }
+        EXPECT_EQ(queue.try_pop(), std::nullopt);
+    }
+
+    TEST(SpscQueue, WrapAround)
+    {
+        orion::spsc_queue<int, 4> queue;
+        for (int i = 0; i < 10; ++i) {
+            EXPECT_TRUE(queue.try_push(i));
+            EXPECT_TRUE(queue.try_push(i + 100));
+            EXPECT_EQ(queue.try_pop(), i);
+            EXPECT_EQ(queue.try_pop(), i + 100);
+        }
+        EXPECT_TRUE(queue.empty());
+    }
+
+    TEST(SpscQueue, Batch)
+    {
+        const std::array values{1, 2, 3, 4, 5, 6};
+        orion::spsc_queue<int, 4> queue;
+        EXPECT_TRUE(queue.try_push(0));
+
+        // Only the free slots are filled
+        EXPECT_EQ(queue.try_push_n(values.begin(), values.size()), 3);
+
+        std::array<int, 8> popped{};
+        EXPECT_EQ(queue.try_pop_n(popped.begin(), 2), 2);
+        EXPECT_EQ(popped[0], 0);
+        EXPECT_EQ(popped[1], 1);
+
+        EXPECT_EQ(queue.try_pop_n(popped.begin(), popped.size()), 2);
+        EXPECT_EQ(popped[0], 2);
+        EXPECT_EQ(popped[1], 3);
+        EXPECT_EQ(queue.try_pop_n(popped.begin(), popped.size()), 0);
+    }
+
+    TEST(SpscQueue, NonTrivial)
+    {
+        orion::spsc_queue<std::string, 8> queue;
+        EXPECT_TRUE(queue.try_emplace(long_string));
+        EXPECT_TRUE(queue.try_emplace(3, 'x'));
+        EXPECT_EQ(queue.try_pop(), long_string);
+        EXPECT_EQ(queue.try_pop(), "xxx");
+
+        // Elements left in the queue are destroyed with it
+        EXPECT_TRUE(queue.try_push(long_string));
+    }
+
+    TEST(SpscQueue, MoveOnly)
+    {
+        orion::spsc_queue<std::unique_ptr<int>, 2> queue;
+        EXPECT_TRUE(queue.try_push(std::make_unique<int>(7)));
+
+        std::vector<std::unique_ptr<int>> popped(1);
+        EXPECT_EQ(queue.try_pop_n(popped.begin(), 1), 1);
+        EXPECT_EQ(*popped[0], 7);
+    }
+
+    TEST(SpscQueue, Threads)
+    {
+        constexpr int count = 20000;
+        orion::spsc_queue<int, 64> queue;
+
+        std::thread producer([&queue]() {
+            std::array<int, 16> batch{};
+            int next = 0;
+            while (next < count) {
+                if (next % 2 == 0) {
+                    // Alternate single and batched pushes
+                    const auto size = std::min(batch.size(), static_cast<std::size_t>(count - next));
+                    for (std::size_t i = 0; i < size; ++i) {
+                        batch[i] = next + static_cast<int>(i);
+                    }
+                    next += static_cast<int>(queue.try_push_n(batch.begin(), size));
+                } else {
+                    if (queue.try_push(next)) {
+                        ++next;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        });
+
+        bool in_order = true;
+        int expected = 0;
+        while (expected < count) {
+            if (auto value = queue.try_pop()) {
+                in_order = in_order && *value == expected;
+                ++expected;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        EXPECT_TRUE(in_order);
+        EXPECT_TRUE(queue.empty());
+    }
+} // namespace
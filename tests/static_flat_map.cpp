@@ -0,0 +1,225 @@
+#include "orion-utils/static_flat_map.h"
+
+#include <algorithm>  // std::ranges::equal, std::ranges::is_sorted
+#include <cstddef>    // std::size_t
+#include <functional> // std::less, std::greater
+#include <gtest/gtest.h>
+#include <map>         // std::map
+#include <random>      // std::mt19937
+#include <set>         // std::set
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <utility>     // std::pair
+#include <vector>      // std::vector
+
+namespace
+{
+    const std::string long_string = "a string that is too long for the small string optimization";
+
+    template<typename Map>
+    std::vector<std::pair<int, int>> sorted_elements(const Map& map)
+    {
+        std::vector<std::pair<int, int>> elements;
+        for (const auto& [key, value] : map) {
+            elements.emplace_back(key, value);
+        }
+        std::ranges::sort(elements);
+        return elements;
+    }
+
+    TEST(StaticFlatMap, BranchlessLowerBound)
+    {
+        const std::vector<int> keys{1, 3, 3, 5, 7, 9, 11};
+        for (int key = 0; key <= 12; ++key) {
+            const auto expected = static_cast<std::size_t>(std::ranges::lower_bound(keys, key) - keys.begin());
+            EXPECT_EQ(orion::detail::branchless_lower_bound(keys.data(), keys.size(), key, std::less<>{}), expected) << key;
+        }
+        EXPECT_EQ(orion::detail::branchless_lower_bound(keys.data(), 0, 4, std::less<>{}), 0);
+    }
+
+    TEST(StaticFlatMap, InsertFind)
+    {
+        orion::static_flat_map<int, std::string, 8> map;
+        EXPECT_TRUE(map.empty());
+        EXPECT_TRUE(map.insert({3, "three"}).second);
+        EXPECT_TRUE(map.try_emplace(1, long_string).second);
+        EXPECT_TRUE(map.emplace(2, "two").second);
+        EXPECT_FALSE(map.try_emplace(1, "one").second);
+        EXPECT_EQ(map.size(), 3);
+
+        EXPECT_TRUE(std::ranges::is_sorted(map.keys()));
+        EXPECT_EQ(map.at(1), long_string);
+        EXPECT_EQ(map.find(2)->second, "two");
+        EXPECT_EQ(map.find(4), map.end());
+        EXPECT_TRUE(map.contains(3));
+        EXPECT_EQ(map.count(0), 0);
+
+        map[0] = "zero";
+        EXPECT_EQ(map.begin()->second, "zero");
+        EXPECT_FALSE(map.insert_or_assign(0, "ZERO").second);
+        EXPECT_EQ(map.at(0), "ZERO");
+
+        EXPECT_EQ(map.lower_bound(2)->first, 2);
+        EXPECT_EQ(map.upper_bound(2)->first, 3);
+        EXPECT_EQ(map.upper_bound(3), map.end());
+        EXPECT_EQ(map.end() - map.begin(), 4);
+    }
+
+    TEST(StaticFlatMap, BulkConstruction)
+    {
+        // Unsorted input with duplicates, the first occurrence wins
+        const orion::static_flat_map<int, int, 8> map{{5, 50}, {1, 10}, {3, 30}, {1, 11}, {4, 40}, {5, 51}};
+        EXPECT_EQ(map.size(), 4);
+        EXPECT_TRUE(std::ranges::equal(map.keys(), std::vector{1, 3, 4, 5}));
+        EXPECT_TRUE(std::ranges::equal(map.values(), std::vector{10, 30, 40, 50}));
+
+        // Existing keys win over inserted ones
+        orion::static_flat_map<int, int, 8> merged = map;
+        merged.insert({{2, 20}, {3, 31}, {6, 60}});
+        EXPECT_EQ(sorted_elements(merged), (std::vector<std::pair<int, int>>{{1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 50}, {6, 60}}));
+    }
+
+    TEST(StaticFlatMap, Erase)
+    {
+        orion::static_flat_map<int, std::string, 8> map{{1, "one"}, {2, long_string}, {3, "three"}, {4, "four"}};
+        EXPECT_EQ(map.erase(2), 1);
+        EXPECT_EQ(map.erase(2), 0);
+        const auto next = map.erase(map.find(3));
+        EXPECT_EQ(next->first, 4);
+        EXPECT_EQ(map.size(), 2);
+
+        map.insert({{5, "five"}, {6, long_string}});
+        EXPECT_EQ(orion::erase_if(map, [](auto element) { return element.first % 2 == 0; }), 2);
+        EXPECT_TRUE(std::ranges::equal(map.keys(), std::vector{1, 5}));
+        EXPECT_EQ(map.at(5), "five");
+        map.clear();
+        EXPECT_TRUE(map.empty());
+    }
+
+    TEST(StaticFlatMap, HeterogeneousLookup)
+    {
+        orion::static_flat_map<std::string, int, 4, std::less<>> map{{"b", 2}, {long_string, 1}};
+        const std::string_view key = "b";
+        EXPECT_EQ(map.find(key)->second, 2);
+        EXPECT_TRUE(map.contains(std::string_view{long_string}));
+        EXPECT_EQ(map.at("b"), 2);
+        EXPECT_EQ(map.erase("b"), 1);
+        EXPECT_EQ(map.size(), 1);
+    }
+
+    TEST(StaticFlatMap, CustomCompare)
+    {
+        const orion::static_flat_map<int, char, 4, std::greater<>> map{{1, 'a'}, {3, 'c'}, {2, 'b'}};
+        EXPECT_TRUE(std::ranges::equal(map.keys(), std::vector{3, 2, 1}));
+        EXPECT_EQ(map.lower_bound(2)->second, 'b');
+    }
+
+    TEST(StaticFlatMap, Eytzinger)
+    {
+        orion::eytzinger_flat_map<int, int, 64> map;
+        std::map<int, int> reference;
+        std::mt19937 engine{3}; // NOLINT(cert-msc32-c, cert-msc51-cpp): deterministic on purpose
+        std::uniform_int_distribution<int> keys{0, 100};
+        for (int step = 0; step < 2000; ++step) {
+            const auto key = keys(engine);
+            if (engine() % 2 == 0 && reference.size() < 64) {
+                const bool inserted = reference.try_emplace(key, step).second;
+                const auto [position, map_inserted] = map.try_emplace(key, step);
+                EXPECT_EQ(map_inserted, inserted);
+                EXPECT_EQ(position->first, key);
+            } else {
+                EXPECT_EQ(map.erase(key), reference.erase(key));
+            }
+        }
+        EXPECT_EQ(sorted_elements(map), (std::vector<std::pair<int, int>>(reference.begin(), reference.end())));
+        for (int key = 0; key <= 100; ++key) {
+            EXPECT_EQ(map.contains(key), reference.contains(key)) << key;
+        }
+    }
+
+    TEST(StaticFlatMap, EytzingerLayout)
+    {
+        // Breadth-first order of the tree over 1..7
+        const orion::eytzinger_flat_map<int, int, 8> map{{1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}, {6, 6}, {7, 7}};
+        EXPECT_TRUE(std::ranges::equal(map.keys(), std::vector{4, 2, 6, 1, 3, 5, 7}));
+        for (int key = 1; key <= 7; ++key) {
+            EXPECT_EQ(map.at(key), key);
+        }
+        EXPECT_EQ(map.find(0), map.end());
+        EXPECT_EQ(map.find(8), map.end());
+
+        orion::eytzinger_flat_map<int, int, 8> copy = map;
+        EXPECT_EQ(orion::erase_if(copy, [](auto element) { return element.first > 3; }), 4);
+        EXPECT_TRUE(std::ranges::equal(copy.keys(), std::vector{2, 1, 3}));
+    }
+
+    TEST(StaticFlatSet, Set)
+    {
+        orion::static_flat_set<int, 8> set{4, 1, 3, 1};
+        EXPECT_TRUE(std::ranges::equal(set, std::vector{1, 3, 4}));
+        EXPECT_TRUE(set.insert(2).second);
+        EXPECT_FALSE(set.insert(3).second);
+        EXPECT_EQ(*set.emplace(0).first, 0);
+        EXPECT_TRUE(std::ranges::equal(set, std::vector{0, 1, 2, 3, 4}));
+
+        EXPECT_TRUE(set.contains(2));
+        EXPECT_EQ(set.find(5), set.end());
+        EXPECT_EQ(*set.lower_bound(2), 2);
+        EXPECT_EQ(*set.upper_bound(2), 3);
+
+        EXPECT_EQ(set.erase(0), 1);
+        EXPECT_EQ(*set.erase(set.find(2)), 3);
+        EXPECT_EQ(orion::erase_if(set, [](int key) { return key > 3; }), 1);
+        EXPECT_TRUE(std::ranges::equal(set, std::vector{1, 3}));
+    }
+
+    TEST(StaticFlatSet, Eytzinger)
+    {
+        orion::eytzinger_flat_set<std::string, 16> set{"e", "b", long_string, "c", "e"};
+        EXPECT_EQ(set.size(), 4);
+        EXPECT_TRUE(set.contains(long_string));
+        EXPECT_TRUE(set.insert("d").second);
+        EXPECT_EQ(set.erase("b"), 1);
+        const std::set<std::string> contents(set.begin(), set.end());
+        EXPECT_EQ(contents, (std::set<std::string>{long_string, "c", "d", "e"}));
+        for (const auto& key : contents) {
+            EXPECT_NE(set.find(key), set.end());
+        }
+    }
+
+    enum class Key { a, b, c, d };
+
+    // Tables built at compile time from unsorted initializers
+    constexpr orion::static_flat_map<Key, int, 4> compile_time_map{{Key::c, 3}, {Key::a, 1}, {Key::b, 2}};
+    constexpr orion::eytzinger_flat_set<int, 16> compile_time_set{9, 3, 7, 1, 5, 3};
+
+    TEST(StaticFlatMap, Constexpr)
+    {
+        static_assert(compile_time_map.size() == 3);
+        static_assert(compile_time_map.at(Key::b) == 2);
+        static_assert(!compile_time_map.contains(Key::d));
+        static_assert(compile_time_map.begin()->first == Key::a);
+        static_assert(compile_time_set.size() == 5);
+        static_assert(compile_time_set.contains(7) && !compile_time_set.contains(4));
+
+        constexpr auto edited = []() {
+            orion::static_flat_map<int, int, 8> map{{3, 30}, {1, 10}};
+            map.try_emplace(2, 20);
+            map[4] = 40;
+            map.erase(1);
+            orion::erase_if(map, [](auto element) { return element.second == 40; });
+            return map;
+        }();
+        static_assert(edited == orion::static_flat_map<int, int, 8>{{2, 20}, {3, 30}});
+
+        constexpr auto eytzinger = []() {
+            orion::eytzinger_flat_map<int, int, 8> map;
+            for (int i = 0; i < 8; ++i) {
+                map.try_emplace((i * 5) % 8, i);
+            }
+            map.erase(0);
+            return map;
+        }();
+        static_assert(eytzinger.size() == 7 && eytzinger.at(5) == 1 && !eytzinger.contains(0));
+    }
+} // namespace
@@ -0,0 +1,162 @@
+#include "orion-utils/static_string.h"
+
+#include <cstdint> // std::uint8_t, std::uint16_t
+#include <gtest/gtest.h>
+#include <string>        // std::string
+#include <string_view>   // std::string_view
+#include <type_traits>   // std::is_same_v
+#include <unordered_set> // std::unordered_set
+
+#include <fmt/format.h> // fmt::format
+
+namespace
+{
+    using namespace std::string_view_literals;
+
+    static_assert(std::is_same_v<orion::static_string<15>::size_type, std::uint8_t>);
+    static_assert(std::is_same_v<orion::static_string<1000>::size_type, std::uint16_t>);
+    static_assert(sizeof(orion::static_string<15>) == 17);
+
+    TEST(StaticString, Construction)
+    {
+        const orion::static_string<16> empty;
+        EXPECT_TRUE(empty.empty());
+        EXPECT_EQ(empty.c_str()[0], '\0');
+
+        const orion::static_string<16> name = "player";
+        EXPECT_EQ(name.size(), 6);
+        EXPECT_EQ(name, "player");
+        EXPECT_EQ(name.c_str()[6], '\0');
+
+        const orion::static_string<16> repeated(3, 'x');
+        EXPECT_EQ(repeated, "xxx");
+        const orion::static_string<16> from_view{"view"sv};
+        EXPECT_EQ(from_view.view(), "view");
+        const orion::static_string<16> counted("counted", 5);
+        EXPECT_EQ(std::string{counted}, "count");
+    }
+
+    TEST(StaticString, Modifiers)
+    {
+        orion::static_string<32> key = "entity";
+        key += '/';
+        key += "transform";
+        key.append("."sv).append(2, '!');
+        EXPECT_EQ(key, "entity/transform.!!");
+        key.pop_back();
+        EXPECT_EQ(key.back(), '!');
+        EXPECT_EQ(key.front(), 'e');
+
+        key.erase(key.find('.'));
+        EXPECT_EQ(key, "entity/transform");
+        key.insert(7, "local_");
+        EXPECT_EQ(key, "entity/local_transform");
+        key.insert(0, key.view().substr(0, 3));
+        EXPECT_EQ(key, "ententity/local_transform");
+        key.erase(0, 3);
+        // Views into the shifted tail, and straddling the insert position
+        key.insert(1, key.view().substr(3, 3));
+        EXPECT_EQ(key, "eityntity/local_transform");
+        key.erase(1, 3);
+        key.insert(2, key.view().substr(1, 3));
+        EXPECT_EQ(key, "enntitity/local_transform");
+        key.erase(2, 3);
+
+        key.resize(6);
+        EXPECT_EQ(key, "entity");
+        key.resize(8, '_');
+        EXPECT_EQ(key, "entity__");
+        EXPECT_EQ(key.c_str()[8], '\0');
+
+        key.assign(key.view().substr(2));
+        EXPECT_EQ(key, "tity__");
+        key = "x";
+        EXPECT_EQ(key.size(), 1);
+        key.clear();
+        EXPECT_TRUE(key.empty());
+        EXPECT_EQ(key.available(), 32);
+    }
+
+    TEST(StaticString, Search)
+    {
+        const orion::static_string<32> path = "assets/meshes/rock.mesh";
+        EXPECT_EQ(path.find('/'), 6);
+        EXPECT_EQ(path.rfind('/'), 13);
+        EXPECT_EQ(path.find("rock"), 14);
+        EXPECT_EQ(path.find("tree"), orion::static_string<32>::npos);
+        EXPECT_TRUE(path.starts_with("assets"));
+        EXPECT_TRUE(path.ends_with(".mesh"));
+        EXPECT_TRUE(path.contains("meshes"));
+        EXPECT_EQ(path.substr(14, 4), "rock");
+    }
+
+    TEST(StaticString, Comparison)
+    {
+        const orion::static_string<8> a = "abc";
+        const orion::static_string<16> b = "abd";
+        EXPECT_NE(a, b);
+        EXPECT_LT(a, b);
+        EXPECT_EQ(a, orion::static_string<4>{"abc"});
+        EXPECT_TRUE("abc" == a);
+        EXPECT_TRUE(a == std::string{"abc"});
+        EXPECT_TRUE(a < "abcd"sv);
+        EXPECT_TRUE("b" > a);
+
+        std::unordered_set<orion::static_string<8>> set{a, "def"};
+        EXPECT_TRUE(set.contains("def"));
+    }
+
+    TEST(StaticString, Format)
+    {
+        const orion::static_string<16> name = "rock";
+        EXPECT_EQ(fmt::format("[{:>6}]", name), "[  rock]");
+
+        orion::static_string<16> out = "id=";
+        EXPECT_TRUE(orion::format_to(out, "{}:{}", 42, name));
+        EXPECT_EQ(out, "id=42:rock");
+
+        // Output past the capacity is dropped
+        EXPECT_FALSE(orion::format_to(out, "{}", "0123456789"));
+        EXPECT_EQ(out, "id=42:rock012345");
+        EXPECT_FALSE(orion::format_to(out, "more"));
+        EXPECT_EQ(out.size(), 16);
+
+        EXPECT_EQ((orion::format<8>("{:04}-{}", 7, "abcdef")), "0007-abc");
+    }
+
+    TEST(StaticString, FormatKeepsUtf8Sequences)
+    {
+        // "é" is two bytes and "€" three, neither is split when the output is cut
+        EXPECT_EQ(orion::format<4>("abc{}", "é"), "abc");
+        EXPECT_EQ(orion::format<5>("abc{}", "é"), "abcé");
+        EXPECT_EQ(orion::format<5>("ab{}", "€€"), "ab€");
+        EXPECT_EQ(orion::format<4>("ab{}", "€"), "ab");
+        EXPECT_EQ(orion::format<6>("{}", "ééé"), "ééé");
+    }
+
+    TEST(StaticString, AppendTruncated)
+    {
+        orion::static_string<8> out = "abc";
+        EXPECT_TRUE(out.append_truncated("de"));
+        EXPECT_FALSE(out.append_truncated("fghij"));
+        EXPECT_EQ(out, "abcdefgh");
+    }
+
+    TEST(StaticString, Constexpr)
+    {
+        constexpr auto key = []() {
+            orion::static_string<32> result = "mesh";
+            result += '/';
+            result.append("lod").append(1, '0');
+            result.insert(0, "a:");
+            result.erase(0, 2);
+            return result;
+        }();
+        static_assert(key == "mesh/lod0");
+        static_assert(key.size() == 9);
+        static_assert(key.find("lod") == 5);
+        static_assert(key.substr(5) == "lod0");
+        static_assert(key.ends_with('0'));
+        static_assert(orion::detail::utf8_complete_prefix("a\xc3", 2) == 1);
+    }
+} // namespace
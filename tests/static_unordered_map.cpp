@@ -0,0 +1,260 @@
+#include "orion-utils/static_unordered_map.h"
+
+#include <algorithm>  // std::ranges::sort
+#include <cstddef>    // std::size_t
+#include <functional> // std::hash, std::equal_to
+#include <gtest/gtest.h>
+#include <map>         // std::map
+#include <memory>      // std::unique_ptr, std::make_unique
+#include <random>      // std::mt19937
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <utility>     // std::pair
+#include <vector>      // std::vector
+
+namespace
+{
+    const std::string long_string = "a string that is too long for the small string optimization";
+
+    // Sends every key to the same home slot so probe runs get long
+    struct CollidingHash {
+        std::size_t operator()(int) const noexcept { return 0; }
+    };
+
+    // Only a few home slots, keys collide and runs of different homes interleave
+    struct ClusteringHash {
+        std::size_t operator()(int key) const noexcept { return static_cast<std::size_t>(key % 3); }
+    };
+
+    struct StringHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view key) const noexcept { return std::hash<std::string_view>{}(key); }
+    };
+
+    template<typename Map>
+    std::vector<std::pair<int, int>> sorted_elements(const Map& map)
+    {
+        std::vector<std::pair<int, int>> elements;
+        for (const auto& [key, value] : map) {
+            elements.emplace_back(key, value);
+        }
+        std::ranges::sort(elements);
+        return elements;
+    }
+
+    TEST(StaticUnorderedMap, InsertFind)
+    {
+        orion::static_unordered_map<int, std::string, 16> map;
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(map.capacity(), 16);
+
+        EXPECT_TRUE(map.insert({1, "one"}).second);
+        EXPECT_TRUE(map.try_emplace(2, long_string).second);
+        EXPECT_TRUE(map.emplace(3, "three").second);
+        EXPECT_FALSE(map.try_emplace(2, "two").second);
+        EXPECT_EQ(map.size(), 3);
+
+        EXPECT_EQ(map.at(1), "one");
+        EXPECT_EQ(map.at(2), long_string);
+        EXPECT_EQ(map.find(3)->second, "three");
+        EXPECT_EQ(map.find(4), map.end());
+        EXPECT_TRUE(map.contains(1));
+        EXPECT_FALSE(map.contains(4));
+        EXPECT_EQ(map.count(3), 1);
+        EXPECT_EQ(map.count(4), 0);
+
+        map[4] = "four";
+        map[1] += "!";
+        EXPECT_EQ(map.at(4), "four");
+        EXPECT_EQ(map.at(1), "one!");
+
+        EXPECT_FALSE(map.insert_or_assign(4, "FOUR").second);
+        EXPECT_EQ(map.at(4), "FOUR");
+        EXPECT_EQ(map.size(), 4);
+    }
+
+    TEST(StaticUnorderedMap, Iteration)
+    {
+        orion::static_unordered_map<int, int, 32> map;
+        for (int i = 0; i < 20; ++i) {
+            map.try_emplace(i, i * i);
+        }
+        for (auto&& [key, value] : map) {
+            value += key;
+        }
+        const auto elements = sorted_elements(map);
+        ASSERT_EQ(elements.size(), 20);
+        for (int i = 0; i < 20; ++i) {
+            EXPECT_EQ(elements[static_cast<std::size_t>(i)], std::pair(i, i * i + i));
+        }
+
+        const auto& const_map = map;
+        EXPECT_EQ(std::distance(const_map.begin(), const_map.end()), 20);
+        orion::static_unordered_map<int, int, 32>::const_iterator iter = map.begin();
+        EXPECT_EQ(iter, const_map.begin());
+    }
+
+    TEST(StaticUnorderedMap, EraseCollisions)
+    {
+        // Every erase has to shift the rest of the run back, or later keys become unreachable
+        orion::static_unordered_map<int, int, 24, CollidingHash> map;
+        for (int i = 0; i < 24; ++i) {
+            map.try_emplace(i, i);
+        }
+        EXPECT_EQ(map.size(), map.max_size());
+        for (int i = 0; i < 24; i += 2) {
+            EXPECT_EQ(map.erase(i), 1);
+            EXPECT_EQ(map.erase(i), 0);
+        }
+        EXPECT_EQ(map.size(), 12);
+        for (int i = 0; i < 24; ++i) {
+            EXPECT_EQ(map.contains(i), i % 2 != 0) << i;
+        }
+        for (int i = 0; i < 24; i += 2) {
+            EXPECT_TRUE(map.try_emplace(i, -i).second);
+        }
+        EXPECT_EQ(map.size(), 24);
+        EXPECT_EQ(map.at(10), -10);
+        EXPECT_EQ(map.at(11), 11);
+    }
+
+    TEST(StaticUnorderedMap, RandomOperations)
+    {
+        // Checks against std::map with runs of different home slots interleaving and wrapping around
+        orion::static_unordered_map<int, int, 48, ClusteringHash> clustered;
+        orion::static_unordered_map<int, int, 48> spread;
+        std::map<int, int> reference;
+        std::mt19937 engine{7}; // NOLINT(cert-msc32-c, cert-msc51-cpp): deterministic on purpose
+        std::uniform_int_distribution<int> keys{0, 80};
+        for (int step = 0; step < 5000; ++step) {
+            const auto key = keys(engine);
+            if (engine() % 2 == 0 && reference.size() < 48) {
+                const bool inserted = reference.try_emplace(key, step).second;
+                EXPECT_EQ(clustered.try_emplace(key, step).second, inserted);
+                EXPECT_EQ(spread.try_emplace(key, step).second, inserted);
+            } else {
+                const auto erased = reference.erase(key);
+                EXPECT_EQ(clustered.erase(key), erased);
+                EXPECT_EQ(spread.erase(key), erased);
+            }
+        }
+        const std::vector<std::pair<int, int>> expected(reference.begin(), reference.end());
+        EXPECT_EQ(sorted_elements(clustered), expected);
+        EXPECT_EQ(sorted_elements(spread), expected);
+        for (int key = 0; key <= 80; ++key) {
+            EXPECT_EQ(clustered.contains(key), reference.contains(key));
+        }
+    }
+
+    TEST(StaticUnorderedMap, EraseIterator)
+    {
+        orion::static_unordered_map<int, std::string, 8> map;
+        map.try_emplace(1, "one");
+        map.try_emplace(2, long_string);
+        map.erase(map.find(1));
+        EXPECT_FALSE(map.contains(1));
+        EXPECT_EQ(map.at(2), long_string);
+        EXPECT_EQ(map.size(), 1);
+    }
+
+    TEST(StaticUnorderedMap, EraseIf)
+    {
+        orion::static_unordered_map<int, int, 40, ClusteringHash> map;
+        for (int i = 0; i < 40; ++i) {
+            map.try_emplace(i, i);
+        }
+        EXPECT_EQ(orion::erase_if(map, [](auto element) { return element.first % 4 != 1; }), 30);
+        EXPECT_EQ(map.size(), 10);
+        for (int i = 0; i < 40; ++i) {
+            EXPECT_EQ(map.contains(i), i % 4 == 1) << i;
+        }
+        // Survivors were moved towards their home slots, inserting still finds the free ones
+        for (int i = 0; i < 40; i += 4) {
+            EXPECT_TRUE(map.try_emplace(i, i).second);
+        }
+        EXPECT_EQ(map.size(), 20);
+        EXPECT_EQ(orion::erase_if(map, [](auto) { return false; }), 0);
+        EXPECT_EQ(orion::erase_if(map, [](auto) { return true; }), 20);
+        EXPECT_TRUE(map.empty());
+    }
+
+    TEST(StaticUnorderedMap, HeterogeneousLookup)
+    {
+        orion::static_unordered_map<std::string, int, 8, StringHash, std::equal_to<>> map;
+        map.try_emplace(long_string, 1);
+        map.try_emplace("short", 2);
+
+        const std::string_view view = long_string;
+        EXPECT_EQ(map.find(view)->second, 1);
+        EXPECT_TRUE(map.contains("short"));
+        EXPECT_EQ(map.count(std::string_view{"missing"}), 0);
+        EXPECT_EQ(map.at("short"), 2);
+        EXPECT_EQ(map.erase("short"), 1);
+        EXPECT_FALSE(map.contains("short"));
+        map.erase(map.begin());
+        EXPECT_TRUE(map.empty());
+    }
+
+    TEST(StaticUnorderedMap, MoveOnly)
+    {
+        orion::static_unordered_map<int, std::unique_ptr<int>, 16, CollidingHash> map;
+        for (int i = 0; i < 10; ++i) {
+            map.try_emplace(i, std::make_unique<int>(i));
+        }
+        map.erase(3);
+        EXPECT_EQ(*map.at(9), 9);
+
+        auto moved = std::move(map);
+        EXPECT_EQ(moved.size(), 9);
+        EXPECT_EQ(*moved.at(4), 4);
+
+        orion::static_unordered_map<int, std::unique_ptr<int>, 16, CollidingHash> assigned;
+        assigned.try_emplace(42, std::make_unique<int>(42));
+        assigned = std::move(moved);
+        EXPECT_FALSE(assigned.contains(42));
+        EXPECT_EQ(*assigned.at(0), 0);
+    }
+
+    TEST(StaticUnorderedMap, Copy)
+    {
+        orion::static_unordered_map<std::string, std::string, 8> map;
+        map.try_emplace("a", long_string);
+        map.try_emplace(long_string, "b");
+
+        auto copy = map;
+        EXPECT_EQ(copy.size(), 2);
+        EXPECT_EQ(copy.at("a"), long_string);
+        EXPECT_EQ(copy.at(long_string), "b");
+
+        orion::static_unordered_map<std::string, std::string, 8> assigned;
+        assigned.try_emplace("c", "c");
+        assigned = map;
+        EXPECT_FALSE(assigned.contains("c"));
+        EXPECT_EQ(assigned.at("a"), long_string);
+
+        map.clear();
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(copy.size(), 2);
+    }
+
+    TEST(StaticUnorderedMap, Full)
+    {
+        // One slot more than capacity rounds up to the minimum group, fill it up entirely
+        orion::static_unordered_map<int, int, 1> single;
+        single.try_emplace(7, 7);
+        EXPECT_EQ(single.size(), single.max_size());
+        EXPECT_FALSE(single.contains(8));
+        single.erase(7);
+        single.try_emplace(8, 8);
+        EXPECT_EQ(single.at(8), 8);
+
+        orion::static_unordered_map<int, int, 100> map;
+        for (int i = 0; i < 100; ++i) {
+            map.try_emplace(i * 7919, i);
+        }
+        for (int i = 0; i < 100; ++i) {
+            EXPECT_EQ(map.at(i * 7919), i);
+        }
+        EXPECT_FALSE(map.contains(1));
+    }
+} // namespace
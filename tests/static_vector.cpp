@@ -1,7 +1,15 @@
 #include "orion-utils/static_vector.h"
 
-#include <algorithm> // std::all_of
+#include <algorithm> // std::all_of, std::ranges::equal, std::find_if, std::lower_bound
+#include <array>     // std::array
+#include <cstddef>   // std::size_t
 #include <gtest/gtest.h>
+#include <iterator>    // std::istream_iterator
+#include <ranges>      // std::views::iota, std::views::transform
+#include <sstream>     // std::istringstream
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
 
 namespace
 {
@@ -158,6 +166,169 @@ namespace
         EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin()));
     }
 
+    TEST(StaticVector, InsertRangeMiddle)
+    {
+        const std::array expected{1, 6, 7, 8, 2, 3};
+        const std::vector inserted{6, 7, 8};
+        orion::static_vector<int, 6> vector;
+        vector.insert(vector.begin(), {1, 2, 3});
+
+        auto iter = vector.insert(vector.begin() + 1, inserted.begin(), inserted.end());
+        EXPECT_EQ(iter, vector.begin() + 1);
+        EXPECT_EQ(vector.size(), expected.size());
+        EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin()));
+    }
+
+    TEST(StaticVector, InsertRangeNonTrivial)
+    {
+        const std::array<std::string, 5> expected{"a", "d", "e", "b", "c"};
+        orion::static_vector<std::string, 5> vector;
+        vector.insert(vector.begin(), {"a", "b", "c"});
+
+        vector.insert(vector.begin() + 1, {"d", "e"});
+        EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()));
+    }
+
+    TEST(StaticVector, InsertRangeInputIterator)
+    {
+        const std::array expected{1, 4, 5, 2, 3};
+        std::istringstream stream{"4 5"};
+        orion::static_vector<int, 5> vector;
+        vector.insert(vector.begin(), {1, 2, 3});
+
+        auto iter = vector.insert(vector.begin() + 1, std::istream_iterator<int>{stream}, std::istream_iterator<int>{});
+        EXPECT_EQ(iter, vector.begin() + 1);
+        EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()));
+    }
+
+    TEST(StaticVector, InsertRangeShiftsOnce)
+    {
+        struct MoveCounter {
+            MoveCounter(int val, int& counter)
+                : value(val)
+                , moves(&counter)
+            {
+            }
+            MoveCounter(const MoveCounter&) = default;
+            MoveCounter(MoveCounter&& other) noexcept
+                : value(other.value)
+                , moves(other.moves)
+            {
+                ++*moves;
+            }
+            MoveCounter& operator=(const MoveCounter&) = default;
+            MoveCounter& operator=(MoveCounter&& other) noexcept
+            {
+                value = other.value;
+                moves = other.moves;
+                ++*moves;
+                return *this;
+            }
+            ~MoveCounter() = default;
+
+            int value;
+            int* moves;
+        };
+
+        int moves = 0;
+        const std::vector<MoveCounter> inserted(4, MoveCounter(0, moves));
+        orion::static_vector<MoveCounter, 16> vector(8, MoveCounter(1, moves));
+        moves = 0;
+
+        vector.insert(vector.begin(), inserted.begin(), inserted.end());
+        EXPECT_EQ(vector.size(), 12);
+        EXPECT_EQ(moves, 8);
+    }
+
+    TEST(StaticVector, InsertCount)
+    {
+        const std::array expected{1, 9, 9, 9, 2};
+        orion::static_vector<int, 5> vector;
+        vector.insert(vector.begin(), {1, 2});
+
+        auto iter = vector.insert(vector.begin() + 1, 3, 9);
+        EXPECT_EQ(iter, vector.begin() + 1);
+        EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()));
+    }
+
+    TEST(StaticVector, AppendRange)
+    {
+        const std::array expected{1, 2, 3, 4};
+        orion::static_vector<int, 4> vector;
+        vector.insert(vector.begin(), {1, 2});
+
+        vector.append_range(std::array{3, 4});
+        EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()));
+    }
+
+    TEST(StaticVector, InsertRangeView)
+    {
+        const std::array expected{0, 2, 4, 6, 1};
+        orion::static_vector<int, 5> vector;
+        vector.push_back(1);
+
+        vector.insert_range(vector.begin(), std::views::iota(0, 4) | std::views::transform([](int i) { return i * 2; }));
+        EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()));
+    }
+
+    TEST(StaticVector, Assign)
+    {
+        orion::static_vector<std::string, 4> vector;
+        vector.insert(vector.begin(), {"a", "b"});
+
+        // Grow
+        vector.assign(3, "x");
+        EXPECT_EQ(vector.size(), 3);
+        EXPECT_TRUE(std::all_of(vector.begin(), vector.end(), [](const auto& str) { return str == "x"; }));
+
+        // Shrink
+        vector.assign({"y"});
+        EXPECT_EQ(vector.size(), 1);
+        EXPECT_EQ(vector.front(), "y");
+    }
+
+    TEST(StaticVector, AssignRange)
+    {
+        const std::array<std::string, 4> expected{"a", "b", "c", "d"};
+        orion::static_vector<std::string, 4> vector;
+        vector.insert(vector.begin(), {"x", "y"});
+
+        vector.assign_range(expected);
+        EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()));
+
+        std::istringstream stream{"e f"};
+        vector.assign(std::istream_iterator<std::string>{stream}, std::istream_iterator<std::string>{});
+        EXPECT_EQ(vector.size(), 2);
+        EXPECT_EQ(vector[0], "e");
+        EXPECT_EQ(vector[1], "f");
+    }
+
+#if ORION_ASSERTION_LEVEL >= 1
+    TEST(StaticVector, OversizedRangeAsserts)
+    {
+        // 260 elements would wrap around to 4 in the 8-bit size type of the vector
+        const auto range = std::views::iota(0, 260);
+        orion::static_vector<int, 10> vector;
+        EXPECT_DEATH(vector.assign_range(range), "Assertion failed");
+        EXPECT_DEATH(vector.insert_range(vector.end(), range), "Assertion failed");
+    }
+#endif
+
+    TEST(StaticVector, Resize)
+    {
+        orion::static_vector<DefaultConstructible, 5> vector;
+
+        vector.resize(3);
+        EXPECT_EQ(vector.size(), 3);
+        EXPECT_TRUE(std::all_of(vector.begin(), vector.end(), [](auto obj) { return obj.value == DefaultConstructible::expected; }));
+
+        vector.resize(1);
+        EXPECT_EQ(vector.size(), 1);
+
+        vector.resize(4, DefaultConstructible{});
+        EXPECT_EQ(vector.size(), 4);
+    }
+
     TEST(StaticVector, Erase)
     {
         const std::array expected{3, 1};
@@ -187,6 +358,115 @@ namespace
         EXPECT_EQ(*iter, 5);
     }
 
+    TEST(StaticVector, EraseNonTrivial)
+    {
+        const std::array<std::string, 2> expected{"a long string that does not fit into sso", "d"};
+        orion::static_vector<std::string, 4> vector;
+        vector.insert(vector.begin(), {expected[0], "b", "another long string that does not fit into sso", "d"});
+
+        auto iter = vector.erase(vector.begin() + 1, vector.begin() + 3);
+        EXPECT_EQ(*iter, "d");
+        EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()));
+
+        iter = vector.erase(vector.begin());
+        EXPECT_EQ(*iter, "d");
+        EXPECT_EQ(vector.size(), 1);
+    }
+
+    TEST(StaticVector, EraseUnordered)
+    {
+        orion::static_vector<int, 5> vector;
+        vector.assign({1, 2, 3, 4, 5});
+        auto iter = vector.erase_unordered(vector.begin() + 1);
+        EXPECT_EQ(*iter, 5);
+        EXPECT_TRUE(std::ranges::equal(vector, std::array{1, 5, 3, 4}));
+
+        // Erasing the last element
+        iter = vector.swap_remove(vector.end() - 1);
+        EXPECT_EQ(iter, vector.end());
+        EXPECT_TRUE(std::ranges::equal(vector, std::array{1, 5, 3}));
+    }
+
+    TEST(StaticVector, EraseUnorderedNonTrivial)
+    {
+        const std::string long_string = "a long string that does not fit into sso";
+        orion::static_vector<std::string, 3> vector;
+        vector.assign({"a", "b", long_string});
+        vector.erase_unordered(vector.begin());
+        EXPECT_TRUE(std::ranges::equal(vector, std::array<std::string, 2>{long_string, "b"}));
+        vector.erase_unordered(vector.begin());
+        vector.erase_unordered(vector.begin());
+        EXPECT_TRUE(vector.empty());
+    }
+
+    TEST(StaticVector, EraseIf)
+    {
+        orion::static_vector<int, 8> vector;
+        vector.assign({1, 2, 3, 4, 5, 6, 7, 8});
+        EXPECT_EQ(orion::erase_if(vector, [](int value) { return value % 3 == 0; }), 2);
+        EXPECT_TRUE(std::ranges::equal(vector, std::array{1, 2, 4, 5, 7, 8}));
+        EXPECT_EQ(orion::erase_if(vector, [](int) { return false; }), 0);
+        EXPECT_EQ(vector.size(), 6);
+
+        orion::static_vector<std::string, 4> strings;
+        strings.assign({"a", "b", "a", "c"});
+        EXPECT_EQ(orion::erase(strings, "a"), 2);
+        EXPECT_TRUE(std::ranges::equal(strings, std::array<std::string, 2>{"b", "c"}));
+    }
+
+    TEST(StaticVector, RemoveIndices)
+    {
+        orion::static_vector<int, 8> vector;
+        vector.assign({0, 1, 2, 3, 4, 5, 6, 7});
+        const std::array<std::size_t, 4> indices{0, 3, 4, 7};
+        vector.remove_indices(indices);
+        EXPECT_TRUE(std::ranges::equal(vector, std::array{1, 2, 5, 6}));
+
+        vector.remove_indices({});
+        EXPECT_EQ(vector.size(), 4);
+
+        const std::array<std::size_t, 4> all{0, 1, 2, 3};
+        vector.remove_indices(all);
+        EXPECT_TRUE(vector.empty());
+    }
+
+    TEST(StaticVector, RemoveIndicesNonTrivial)
+    {
+        const std::string long_string = "a long string that does not fit into sso";
+        orion::static_vector<std::string, 5> vector;
+        vector.assign({"a", long_string, "c", long_string, "e"});
+        const std::vector<std::size_t> indices{1, 2};
+        vector.remove_indices(indices);
+        EXPECT_TRUE(std::ranges::equal(vector, std::array<std::string, 3>{"a", long_string, "e"}));
+    }
+
+    TEST(StaticVector, EmplaceAliasing)
+    {
+        const std::string first = "a long string that does not fit into sso";
+        const std::string second = "another long string that does not fit into sso";
+        const std::array expected{second, first, second, second};
+        orion::static_vector<std::string, 4> vector;
+        vector.insert(vector.begin(), {first, second});
+
+        // Both arguments refer to elements that get shifted by the insertion
+        vector.emplace(vector.begin(), vector.back());
+        vector.insert(vector.begin() + 2, 1, vector.back());
+        EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()));
+    }
+
+    TEST(StaticVector, MoveRelocatable)
+    {
+        orion::static_vector<int, 3> vector(3, 42);
+        const auto moved(std::move(vector));
+        EXPECT_EQ(moved.size(), 3);
+        EXPECT_TRUE(std::all_of(moved.begin(), moved.end(), [](int value) { return value == 42; }));
+
+        auto assigned = orion::static_vector<int, 3>(1, 0);
+        assigned = orion::static_vector<int, 3>(2, 7);
+        EXPECT_EQ(assigned.size(), 2);
+        EXPECT_TRUE(std::all_of(assigned.begin(), assigned.end(), [](int value) { return value == 7; }));
+    }
+
     TEST(StaticVector, PopBack)
     {
         const std::array expected{1, 2};
@@ -223,5 +503,91 @@ namespace
             return vector.size();
         }();
         static_assert(result == 0);
+
+        static constexpr std::array expected{1, 2, 3, 4, 5};
+        constexpr auto inserted = []() {
+            orion::static_vector<int, 6> vector;
+            vector.assign({1, 5});
+            vector.insert(vector.begin() + 1, {2, 3, 4});
+            vector.append_range(std::array{6});
+            vector.erase(vector.begin() + 1);
+            vector.insert(vector.begin() + 1, 2);
+            vector.resize(5);
+            return vector;
+        }();
+        static_assert(inserted.size() == expected.size());
+        static_assert(std::equal(inserted.begin(), inserted.end(), expected.begin()));
+
+        constexpr auto removed = []() {
+            orion::static_vector<int, 8> vector;
+            vector.assign({0, 1, 2, 3, 4, 5, 6, 7});
+            vector.erase_unordered(vector.begin());
+            orion::erase(vector, 3);
+            const std::array<std::size_t, 2> indices{0, 4};
+            vector.remove_indices(indices);
+            return vector;
+        }();
+        static_assert(std::ranges::equal(removed, std::array{1, 2, 4, 6}));
+    }
+
+    // Not trivially default constructible, so it used to live in byte storage
+    struct Keyword {
+        std::string_view name;
+        int token = -1;
+
+        constexpr bool operator==(const Keyword&) const = default;
+    };
+
+    constexpr auto build_keywords = []() {
+        orion::static_vector<Keyword, 16> keywords;
+        int token = 0;
+        for (std::string_view name : {"while", "if", "return", "else", "for", "break", "goto"}) {
+            // Sorted insertion shifts the non-trivial elements in constant evaluation
+            const auto position = std::find_if(keywords.begin(), keywords.end(), [name](const Keyword& keyword) { return keyword.name > name; });
+            keywords.insert(position, Keyword{name, token++});
+        }
+        orion::erase_if(keywords, [](const Keyword& keyword) { return keyword.name == "goto"; });
+        return keywords;
+    };
+
+    // Sorted keyword table built at compile time
+    static constexpr auto keywords = orion::fit_static_vector<build_keywords>();
+
+    constexpr int find_token(std::string_view name)
+    {
+        const auto found = std::lower_bound(keywords.begin(), keywords.end(), name, [](const Keyword& keyword, std::string_view key) { return keyword.name < key; });
+        return found != keywords.end() && found->name == name ? found->token : -1;
+    }
+
+    TEST(StaticVector, ConstexprNonTrivial)
+    {
+        static_assert(!orion::UninitializedStorage<Keyword, 1>::is_trivial_storage());
+        static_assert(keywords.size() == 6);
+        static_assert(keywords.capacity() == 6);
+        static_assert(keywords.front() == Keyword{"break", 5});
+        static_assert(find_token("return") == 2);
+        static_assert(find_token("goto") == -1);
+        EXPECT_EQ(find_token("while"), 0);
+
+        // Every operation works on elements with non-trivial lifetimes during constant evaluation
+        constexpr auto lengths = []() {
+            orion::static_vector<std::string, 8> vector(3, "a string that is too long for the small string optimization");
+            vector.emplace(vector.begin() + 1, "b");
+            vector.erase(vector.begin());
+            vector.erase_unordered(vector.begin() + 1);
+            vector.push_back("c");
+            auto copy = vector;
+            auto moved = std::move(copy);
+            moved.resize(5);
+            moved.pop_back();
+            const std::array<std::size_t, 1> indices{2};
+            moved.remove_indices(indices);
+            std::size_t total = 0;
+            for (const auto& element : moved) {
+                total = total * 100 + element.size();
+            }
+            return total;
+        }();
+        static_assert(lengths == 1'59'00);
     }
-} // namespace
\ No newline at end of file
+} // namespace
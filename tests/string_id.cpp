@@ -0,0 +1,63 @@
+// Checks the reverse lookup in every build type
+#define ORION_STRING_ID_LOOKUP 1
+#include "orion-utils/string_id.h"
+
+#include <cstdint> // std::uint64_t
+#include <gtest/gtest.h>
+#include <string>        // std::string
+#include <string_view>   // std::string_view
+#include <unordered_map> // std::unordered_map
+
+#include <fmt/format.h> // fmt::format
+
+namespace
+{
+    using namespace orion::literals;
+
+    static_assert("transform"_sid == orion::make_string_id("transform"));
+    static_assert("transform"_sid.value() == orion::hash_bytes("transform"));
+    static_assert("transform"_sid != "mesh"_sid);
+    static_assert(orion::string_id{}.value() == 0);
+    static_assert(sizeof(orion::string_id) == sizeof(std::uint64_t));
+
+    TEST(StringId, RunTimeMatchesLiteral)
+    {
+        const std::string name = "rigid_body";
+        const orion::string_id id{name};
+        EXPECT_EQ(id, "rigid_body"_sid);
+        EXPECT_NE(id, "rigid_bodies"_sid);
+        EXPECT_EQ(orion::string_id::from_value(id.value()), id);
+    }
+
+    TEST(StringId, ReverseLookup)
+    {
+        // Literals are recorded at startup, ids from make_string_id are not
+        EXPECT_EQ("only_at_compile_time"_sid.name(), "only_at_compile_time");
+        constexpr auto constant = orion::make_string_id("only_in_make_string_id");
+        EXPECT_TRUE(constant.name().empty());
+
+        const orion::string_id id{std::string{"audio_source"}};
+        EXPECT_EQ(id.name(), "audio_source");
+        // Literals of a name hashed at run time are known too
+        EXPECT_EQ("audio_source"_sid.name(), "audio_source");
+    }
+
+    TEST(StringId, Format)
+    {
+        const orion::string_id id{std::string_view{"camera"}};
+        EXPECT_EQ(fmt::format("{}", id), "camera");
+        EXPECT_EQ(fmt::format("[{:>8}]", id), "[  camera]");
+        EXPECT_EQ(fmt::format("{}", orion::string_id::from_value(0xabc)), "#0000000000000abc");
+    }
+
+    TEST(StringId, HashAndOrder)
+    {
+        std::unordered_map<orion::string_id, int> components{{"transform"_sid, 1}, {"mesh"_sid, 2}};
+        EXPECT_EQ(components.at(orion::string_id{std::string_view{"mesh"}}), 2);
+        EXPECT_EQ(components.count("light"_sid), 0);
+
+        const auto a = orion::string_id::from_value(1);
+        const auto b = orion::string_id::from_value(2);
+        EXPECT_LT(a, b);
+    }
+} // namespace
@@ -22,6 +22,15 @@ namespace
         static_assert(!orion::not_empty<>);
     }
 
+    TEST(Type, MinUnsigned)
+    {
+        static_assert(std::is_same_v<orion::min_unsigned_t<0>, std::uint8_t>);
+        static_assert(std::is_same_v<orion::min_unsigned_t<255>, std::uint8_t>);
+        static_assert(std::is_same_v<orion::min_unsigned_t<256>, std::uint16_t>);
+        static_assert(std::is_same_v<orion::min_unsigned_t<65536>, std::uint32_t>);
+        static_assert(std::is_same_v<orion::min_unsigned_t<(1ull << 32)>, std::uint64_t>);
+    }
+
     TEST(Type, ToUnderlying)
     {
         using underlying = std::uint8_t;
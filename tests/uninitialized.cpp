@@ -1,5 +1,6 @@
 #include "orion-utils/uninitialized.h"
 
+#include <algorithm> // std::all_of
 #include <gtest/gtest.h>
 
 namespace
@@ -28,6 +29,35 @@ namespace
         }
     };
 
+    struct Relocatable {
+        Relocatable(int val)
+            : value(val)
+        {
+        }
+        Relocatable(Relocatable&& other) noexcept
+            : value(other.value)
+        {
+        }
+        ~Relocatable() {} // NOLINT(modernize-use-equals-default)
+
+        int value;
+    };
+} // namespace
+
+template<>
+struct orion::is_trivially_relocatable<Relocatable> : std::true_type {
+};
+
+namespace
+{
+    TEST(Uninitialized, IsTriviallyRelocatable)
+    {
+        static_assert(orion::is_trivially_relocatable_v<int>);
+        static_assert(!orion::is_trivially_relocatable_v<std::string>);
+        static_assert(!orion::is_trivially_relocatable_v<MoveCopyTest>);
+        static_assert(orion::is_trivially_relocatable_v<Relocatable>);
+    }
+
     TEST(Uninitialized, DefaultContruct)
     {
         constexpr int count{3};
@@ -103,4 +133,78 @@ namespace
 
         std::destroy(first, last);
     }
+
+    TEST(Uninitialized, CopyTrivial)
+    {
+        const std::array source{1, 2, 3, 4};
+        std::array<int, 4> destination{};
+
+        auto last = orion::uninitialized_copy(source.begin(), source.end(), destination.begin());
+        EXPECT_EQ(last, destination.end());
+        EXPECT_EQ(source, destination);
+    }
+
+    TEST(Uninitialized, FillTrivial)
+    {
+        std::array<int, 4> destination{};
+        orion::uninitialized_fill(destination.begin(), destination.end(), 7);
+        EXPECT_TRUE(std::all_of(destination.begin(), destination.end(), [](int value) { return value == 7; }));
+    }
+
+    TEST(Uninitialized, Relocate)
+    {
+        constexpr int count{3};
+        alignas(alignof(MoveCopyTest)) unsigned char source_memory[count * sizeof(MoveCopyTest)];
+        alignas(alignof(MoveCopyTest)) unsigned char memory[count * sizeof(MoveCopyTest)];
+
+        auto source{reinterpret_cast<MoveCopyTest*>(source_memory)};
+        orion::uninitialized_default_construct(source, source + count);
+
+        auto first{reinterpret_cast<MoveCopyTest*>(memory)};
+        auto last{orion::uninitialized_relocate(source, source + count, first)};
+        EXPECT_EQ(last, first + count);
+
+        for (auto it = first; it != last; ++it) {
+            EXPECT_TRUE(it->move_ctor);
+        }
+
+        std::destroy(first, last);
+    }
+
+    TEST(Uninitialized, RelocateOverlapping)
+    {
+        constexpr int count{5};
+        alignas(alignof(Relocatable)) unsigned char memory[count * sizeof(Relocatable)];
+        auto first{reinterpret_cast<Relocatable*>(memory)};
+        for (int i = 0; i < 3; ++i) {
+            std::construct_at(first + i, i);
+        }
+
+        // Shift up by two, [0, 2) becomes uninitialized
+        auto out_first = orion::uninitialized_relocate_backward(first, first + 3, first + 5);
+        EXPECT_EQ(out_first, first + 2);
+        EXPECT_EQ(first[2].value, 0);
+        EXPECT_EQ(first[3].value, 1);
+        EXPECT_EQ(first[4].value, 2);
+
+        // Shift back down by two, [3, 5) becomes uninitialized
+        auto last = orion::uninitialized_relocate(first + 2, first + 5, first);
+        EXPECT_EQ(last, first + 3);
+        EXPECT_EQ(first[0].value, 0);
+        EXPECT_EQ(first[1].value, 1);
+        EXPECT_EQ(first[2].value, 2);
+
+        std::destroy(first, last);
+    }
+
+    TEST(Uninitialized, RelocateConstexpr)
+    {
+        constexpr auto result = []() {
+            std::array<int, 4> array{1, 2, 3, 0};
+            orion::uninitialized_relocate_backward(array.begin(), array.begin() + 3, array.end());
+            orion::uninitialized_relocate(array.begin() + 1, array.end(), array.begin());
+            return array;
+        }();
+        static_assert(result[0] == 1 && result[1] == 2 && result[2] == 3);
+    }
 } // namespace